@@ -0,0 +1,65 @@
+/*
+	Baked lighting for "size" static objects of 512 vertices on a grid, with one small light
+	moving every frame: relighting only the dirty region against relighting everything.
+*/
+
+#include <cmath>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "benchHarness.h"
+
+#include "lightBaker.h"
+
+static void buildScene(lightBaker& baker, int count)
+{
+	std::vector<glm::vec3> positions, normals;
+	for (int i = 0; i < 512; i++)
+	{
+		float a = (float)i * 0.37f, b = (float)i * 0.11f;
+		glm::vec3 n(std::cos(a) * std::sin(b), std::cos(b), std::sin(a) * std::sin(b));
+		positions.push_back(n * 0.5f);
+		normals.push_back(n);
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		glm::mat4 model(1.0f);
+		model[3] = glm::vec4((float)(i % 64) * 2.0f, 0.0f, (float)(i / 64) * 2.0f, 1.0f);
+		baker.addObject(positions.data(), normals.data(), nullptr, positions.size(), model);
+	}
+}
+
+static void runBake(benchState& state, bool incremental)
+{
+	lightBaker baker;
+	buildScene(baker, state.size);
+	int lamp = baker.addLight({ glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f), 1.0f, 4.0f });
+	baker.bake();
+
+	float t = 0.0f;
+	size_t vertices = 0;
+	while (state.keepRunning())
+	{
+		t += 0.05f;
+		baker.setLight(lamp, { glm::vec3(std::fmod(t, 128.0f), 1.0f, 2.0f), glm::vec3(1.0f), 1.0f, 4.0f });
+		if (!incremental)
+			baker.invalidate();
+		baker.bake();
+		vertices = baker.lastBakedVertices;
+	}
+
+	state.counterName = "vertices_baked";
+	state.counter = (double)vertices;
+}
+
+BENCH_CASE(bake_incremental, { 64, 1024, 4096 })
+{
+	runBake(state, true);
+}
+
+BENCH_CASE(bake_everything, { 64, 1024, 4096 })
+{
+	runBake(state, false);
+}
@@ -0,0 +1,56 @@
+/*
+	CPU side of one frame with "size" point lights over 256 objects, forward against deferred
+	shading. Forward uploads every light as uniforms (up to its limit), deferred draws all of
+	them in one instanced call.
+*/
+
+#include <vector>
+
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+#include <gtc/type_ptr.hpp>
+
+#include "benchHarness.h"
+
+#include "deferredRenderer.h"
+
+static void runShading(benchState& state, shadingMode mode)
+{
+	deferredRenderer renderer(OGL_SHADER_DIR, 1280, 720);
+	renderer.mode = mode;
+
+	std::vector<pointLight> lights;
+	for (int i = 0; i < state.size; i++)
+		lights.push_back({ glm::vec3((float)(i % 16) * 4.0f, 1.0f, -(float)(i / 16) * 4.0f), 5.0f, glm::vec3(1.0f, 0.8f, 0.6f), 1.0f });
+
+	glm::mat4 view = glm::lookAt(glm::vec3(30.0f, 10.0f, 10.0f), glm::vec3(30.0f, 0.0f, -30.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 200.0f);
+	glm::mat4 model(1.0f);
+
+	while (state.keepRunning())
+	{
+		renderer.setLights(lights);
+		renderer.begin(view, projection);
+		GLint modelLocation = glGetUniformLocation(renderer.geometryShader().ID, "model");
+		for (int i = 0; i < 256; i++)
+		{
+			glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(model));
+			glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+		}
+		renderer.end();
+	}
+
+	state.counterName = "target_mb";
+	state.counter = (double)renderer.targetBytes() / (1024.0 * 1024.0);
+	renderer.del();
+}
+
+BENCH_CASE(shading_forward, { 1, 16, 64 })
+{
+	runShading(state, forwardShading);
+}
+
+BENCH_CASE(shading_deferred, { 1, 16, 64, 1024 })
+{
+	runShading(state, deferredShading);
+}
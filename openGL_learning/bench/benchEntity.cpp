@@ -0,0 +1,69 @@
+/*
+	Entity store: creating and destroying "size" entities with a transform and bounds each,
+	and one pass of the world matrix and world box systems over them.
+*/
+
+#include "benchHarness.h"
+
+#include "entityStore.h"
+
+static void fillScene(entityStore& scene, int count)
+{
+	scene.reserve(count);
+	for (int i = 0; i < count; i++)
+	{
+		entity e = scene.create();
+		glm::vec3 position((float)(i % 256), (float)((i / 256) % 256), (float)(i / 65536));
+		scene.transforms.add(e, position, glm::vec3(0.001f * i, 0.002f * i, 0.0f), glm::vec3(1.0f + (i % 3)));
+		scene.bounds.add(e, glm::vec3(-0.5f), glm::vec3(0.5f));
+	}
+}
+
+BENCH_CASE(entity_create_destroy, { 1024, 65536 })
+{
+	std::vector<entity> created(state.size);
+
+	while (state.keepRunning())
+	{
+		entityStore scene;
+		for (int i = 0; i < state.size; i++)
+		{
+			created[i] = scene.create();
+			scene.transforms.add(created[i], glm::vec3(0.0f));
+		}
+		// Every other one first, so removal moves slots around
+		for (int i = 0; i < state.size; i += 2)
+			scene.destroy(created[i]);
+		for (int i = 1; i < state.size; i += 2)
+			scene.destroy(created[i]);
+		benchKeep(scene.size());
+	}
+
+	state.counterName = "entities";
+	state.counter = state.size;
+}
+
+BENCH_CASE(entity_update_world, { 1024, 65536, 1048576 })
+{
+	entityStore scene;
+	fillScene(scene, state.size);
+
+	while (state.keepRunning())
+	{
+		entityUpdateWorld(scene);
+		benchKeep(scene.transforms.world.back());
+	}
+}
+
+BENCH_CASE(entity_update_bounds, { 1024, 65536, 1048576 })
+{
+	entityStore scene;
+	fillScene(scene, state.size);
+	entityUpdateWorld(scene);
+
+	while (state.keepRunning())
+	{
+		entityUpdateBounds(scene);
+		benchKeep(scene.bounds.worldMax.back());
+	}
+}
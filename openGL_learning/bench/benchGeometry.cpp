@@ -0,0 +1,79 @@
+/*
+	Geometry registry: "size" props registered and released, each one of 16 distinct meshes
+	(spheres and cylinders of primitives.h), so all but 16 of the uploads are found by hash.
+	The counter is the bytes saved as a percentage of a copy per prop.
+*/
+
+#include "benchHarness.h"
+
+#include "geometryRegistry.h"
+#include "primitives.h"
+
+template <typename Mesh>
+static void addMesh(std::vector<std::pair<const void*, GLsizeiptr>>& vertices, std::vector<std::pair<const void*, GLsizeiptr>>& indices, const Mesh& mesh)
+{
+	vertices.emplace_back(mesh.vertices.data(), (GLsizeiptr)sizeof(mesh.vertices));
+	indices.emplace_back(mesh.indices.data(), (GLsizeiptr)sizeof(mesh.indices));
+}
+
+static constexpr primitiveVec3 white = { 1.0f, 1.0f, 1.0f };
+static constexpr auto sphere0 = primitiveSphere<positionNormalUvLayout, 8, 16>({ 0.0f, 0.0f, 0.0f }, 0.5f, white);
+static constexpr auto sphere1 = primitiveSphere<positionNormalUvLayout, 8, 16>({ 0.0f, 0.0f, 0.0f }, 1.0f, white);
+static constexpr auto sphere2 = primitiveSphere<positionNormalUvLayout, 16, 32>({ 0.0f, 0.0f, 0.0f }, 0.5f, white);
+static constexpr auto sphere3 = primitiveSphere<positionNormalUvLayout, 16, 32>({ 0.0f, 0.0f, 0.0f }, 1.0f, white);
+static constexpr auto cylinder0 = primitiveCylinder<positionNormalUvLayout, 8>({ 0.0f, 0.0f, 0.0f }, 0.5f, 1.0f, white);
+static constexpr auto cylinder1 = primitiveCylinder<positionNormalUvLayout, 8>({ 0.0f, 0.0f, 0.0f }, 0.5f, 2.0f, white);
+static constexpr auto cylinder2 = primitiveCylinder<positionNormalUvLayout, 16>({ 0.0f, 0.0f, 0.0f }, 0.5f, 1.0f, white);
+static constexpr auto cylinder3 = primitiveCylinder<positionNormalUvLayout, 16>({ 0.0f, 0.0f, 0.0f }, 0.5f, 2.0f, white);
+static constexpr auto cylinder4 = primitiveCylinder<positionNormalUvLayout, 32>({ 0.0f, 0.0f, 0.0f }, 0.5f, 1.0f, white);
+static constexpr auto cylinder5 = primitiveCylinder<positionNormalUvLayout, 32>({ 0.0f, 0.0f, 0.0f }, 0.5f, 2.0f, white);
+static constexpr auto box0 = primitiveBox<positionNormalUvLayout>({ 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, white);
+static constexpr auto box1 = primitiveBox<positionNormalUvLayout>({ 0.0f, 0.0f, 0.0f }, { 2.0f, 1.0f, 1.0f }, white);
+static constexpr auto box2 = primitiveBox<positionNormalUvLayout>({ 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 1.0f }, white);
+static constexpr auto box3 = primitiveBox<positionNormalUvLayout>({ 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 2.0f }, white);
+static constexpr auto plane0 = primitivePlane<positionNormalUvLayout, 4>({ 0.0f, 0.0f, 0.0f }, 1.0f, 1.0f, white);
+static constexpr auto plane1 = primitivePlane<positionNormalUvLayout, 16>({ 0.0f, 0.0f, 0.0f }, 1.0f, 1.0f, white);
+
+BENCH_CASE(geometry_register_props, { 256, 4096 })
+{
+	std::vector<std::pair<const void*, GLsizeiptr>> vertices, indices;
+	addMesh(vertices, indices, sphere0);
+	addMesh(vertices, indices, sphere1);
+	addMesh(vertices, indices, sphere2);
+	addMesh(vertices, indices, sphere3);
+	addMesh(vertices, indices, cylinder0);
+	addMesh(vertices, indices, cylinder1);
+	addMesh(vertices, indices, cylinder2);
+	addMesh(vertices, indices, cylinder3);
+	addMesh(vertices, indices, cylinder4);
+	addMesh(vertices, indices, cylinder5);
+	addMesh(vertices, indices, box0);
+	addMesh(vertices, indices, box1);
+	addMesh(vertices, indices, box2);
+	addMesh(vertices, indices, box3);
+	addMesh(vertices, indices, plane0);
+	addMesh(vertices, indices, plane1);
+
+	geometryRegistry geometry;
+	std::vector<geometryRange> ranges(state.size * 2);
+	double saved = 0.0;
+	while (state.keepRunning())
+	{
+		for (int i = 0; i < state.size; i++)
+		{
+			size_t mesh = (size_t)i % vertices.size();
+			ranges[i * 2] = geometry.addVertices(vertices[mesh].first, vertices[mesh].second, positionNormalUvLayout::floats * sizeof(float));
+			ranges[i * 2 + 1] = geometry.addIndices(indices[mesh].first, indices[mesh].second);
+		}
+
+		geometryRegistryStats stats = geometry.stats();
+		saved = 100.0 * (double)stats.savedBytes() / (double)stats.referencedBytes;
+
+		for (const geometryRange& range : ranges)
+			geometry.release(range);
+	}
+
+	state.counterName = "percent_bytes_saved";
+	state.counter = saved;
+	geometry.del();
+}
@@ -0,0 +1,77 @@
+/*
+	CPU cost of submitting "size" objects: the GPU driven path (a few moved objects uploaded,
+	one dispatch, one multi draw) against the GL 3.3 fallback (sphere test, uniform and draw
+	per object).
+*/
+
+#include <vector>
+
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "benchHarness.h"
+
+#include "gpuCuller.h"
+
+static const char* cullPath = OGL_SHADER_DIR "gpuCull.comp";
+static const char* pyramidPath = OGL_SHADER_DIR "depthPyramid.comp";
+
+static const glm::vec3 sceneEye(0.0f, 2.0f, 5.0f);
+
+static void fillScene(gpuCuller& culler, int count)
+{
+	uint32_t cube = culler.addMesh(36, 0, 0);
+	for (int i = 0; i < count; i++)
+	{
+		glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3((float)(i % 256) * 2.0f - 256.0f, 0.0f, -(float)(i / 256) * 2.0f));
+		culler.addObject(cube, model, glm::vec3(-0.5f), glm::vec3(0.5f));
+	}
+}
+
+static glm::mat4 sceneViewProjection()
+{
+	glm::mat4 view = glm::lookAt(sceneEye, glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	return glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 300.0f) * view;
+}
+
+BENCH_CASE(submit_gpu_driven, { 1024, 16384, 131072 })
+{
+	gpuCuller culler(cullPath, pyramidPath);
+	fillScene(culler, state.size);
+	glm::mat4 viewProjection = sceneViewProjection();
+	int frame = 0;
+
+	while (state.keepRunning())
+	{
+		// About one object in a hundred moves every frame
+		for (int i = frame % 100; i < state.size; i += 100)
+			culler.setModel((uint32_t)i, glm::translate(glm::mat4(1.0f), glm::vec3((float)(i % 256) * 2.0f - 256.0f, (float)(frame % 8), -(float)(i / 256) * 2.0f)));
+		frame++;
+
+		culler.cull(viewProjection, sceneEye);
+		culler.draw(GL_UNSIGNED_SHORT);
+	}
+
+	culler.del();
+}
+
+BENCH_CASE(submit_cpu_fallback, { 1024, 16384, 131072 })
+{
+	gpuCuller culler(cullPath, pyramidPath);
+	fillScene(culler, state.size);
+	glm::mat4 viewProjection = sceneViewProjection();
+	int frame = 0;
+
+	while (state.keepRunning())
+	{
+		for (int i = frame % 100; i < state.size; i += 100)
+			culler.setModel((uint32_t)i, glm::translate(glm::mat4(1.0f), glm::vec3((float)(i % 256) * 2.0f - 256.0f, (float)(frame % 8), -(float)(i / 256) * 2.0f)));
+		frame++;
+
+		culler.drawFallback(viewProjection, 0, GL_UNSIGNED_SHORT);
+	}
+
+	state.counterName = "objects_drawn";
+	state.counter = (double)culler.lastDrawn;
+	culler.del();
+}
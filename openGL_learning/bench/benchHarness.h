@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef BENCH_HARNESS_CLASS
+#define BENCH_HARNESS_CLASS
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+	A very small benchmark harness.
+
+	A case does its setup first and then loops on keepRunning(), only the loop is timed:
+
+		BENCH_CASE(draw_submission, { 1, 64, 1024 })
+		{
+			... build a scene of state.size objects ...
+			while (state.keepRunning())
+				... submit the scene once ...
+		}
+
+	The clock is only read once per batch, and the batch doubles until the case has run
+	for at least minSeconds, so very cheap operations are not swamped by timer overhead.
+*/
+
+class benchState
+{
+	public:
+		// Scene size this run was asked for
+		int size;
+
+		// Extra value reported next to the timings, e.g. bytes or triangles per op
+		double counter = 0.0;
+		std::string counterName;
+
+		benchState(int size, double minSeconds);
+
+		bool keepRunning();
+
+		long long iterations() const;
+		double seconds() const;
+
+	private:
+		double minSeconds;
+		long long done = 0;
+		long long batch = 1;
+		long long batchLeft = 0;
+		bool started = false;
+		std::chrono::steady_clock::time_point start;
+		std::chrono::steady_clock::time_point end;
+};
+
+typedef std::function<void(benchState&)> benchFunction;
+
+struct benchCase
+{
+	std::string name;
+	std::vector<int> sizes;
+	benchFunction run;
+};
+
+std::vector<benchCase>& benchCases();
+
+struct benchRegistrar
+{
+	benchRegistrar(const char* name, std::vector<int> sizes, benchFunction run);
+};
+
+#define BENCH_CASE(name, ...) \
+	static void bench_##name(benchState& state); \
+	static benchRegistrar benchRegistrar_##name(#name, std::vector<int>(__VA_ARGS__), &bench_##name); \
+	static void bench_##name(benchState& state)
+
+// Keeps the optimiser from dropping a computed value by letting its address escape
+extern const void* volatile benchSink;
+
+template <typename T>
+inline void benchKeep(const T& value)
+{
+	benchSink = &value;
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+	Transform hierarchy update over a tree of "size" nodes, four children each. "sparse" moves
+	one node in a hundred (a leaf, mostly) before every update, "full" moves the root so every
+	world matrix changes.
+*/
+
+#include "benchHarness.h"
+
+#include "transformHierarchy.h"
+
+static std::vector<entity> buildTree(entityStore& scene, transformHierarchy& hierarchy, int count)
+{
+	std::vector<entity> nodes(count);
+	for (int i = 0; i < count; i++)
+	{
+		nodes[i] = scene.create();
+		entity parent = i > 0 ? nodes[(i - 1) / 4] : entity();
+		hierarchy.add(nodes[i], parent, glm::vec3(0.5f, 0.0f, 0.25f), glm::vec3(0.0f, 0.1f, 0.0f));
+	}
+	hierarchy.update();
+	return nodes;
+}
+
+BENCH_CASE(hierarchy_update_sparse, { 4096, 65536, 1048576 })
+{
+	entityStore scene;
+	transformHierarchy hierarchy;
+	std::vector<entity> nodes = buildTree(scene, hierarchy, state.size);
+
+	unsigned seed = 1;
+	float offset = 0.0f;
+	size_t changed = 0;
+	while (state.keepRunning())
+	{
+		offset += 0.01f;
+		for (int i = 0; i < state.size / 100; i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			hierarchy.setPosition(nodes[seed % state.size], glm::vec3(offset, 0.0f, 0.25f));
+		}
+		hierarchy.update();
+		changed += hierarchy.changed().size();
+	}
+
+	state.counterName = "changed_per_update";
+	state.counter = (double)changed / state.iterations();
+}
+
+BENCH_CASE(hierarchy_update_full, { 4096, 65536, 1048576 })
+{
+	entityStore scene;
+	transformHierarchy hierarchy;
+	std::vector<entity> nodes = buildTree(scene, hierarchy, state.size);
+
+	float offset = 0.0f;
+	while (state.keepRunning())
+	{
+		offset += 0.01f;
+		hierarchy.setPosition(nodes[0], glm::vec3(offset, 0.0f, 0.0f));
+		hierarchy.update();
+		benchKeep(hierarchy.worlds().back());
+	}
+
+	state.counterName = "levels";
+	state.counter = (double)hierarchy.levels();
+}
@@ -0,0 +1,32 @@
+/*
+	One frame of the performance overlay keeping "size" frames of history (240 in the app):
+	percentiles, layout of every glyph and bar, upload and the one draw. The budget for all of
+	it is 0.1 ms.
+*/
+
+#include <cmath>
+
+#include "benchHarness.h"
+
+#include "perfHud.h"
+
+BENCH_CASE(perf_hud, { 60, 240, 960 })
+{
+	perfHud hud(OGL_SHADER_DIR);
+	hud.cpu = frameTimeHistory(state.size);
+	hud.gpu = frameTimeHistory(state.size);
+
+	int frame = 0;
+	while (state.keepRunning())
+	{
+		// A new sample every frame, as in the app
+		hud.addCpuTime(6.0f + 2.0f * std::sin(frame * 0.3f));
+		hud.addGpuTime(9.0f + 3.0f * std::sin(frame * 0.2f));
+		hud.draw(1920, 1080);
+		frame++;
+	}
+
+	state.counterName = "quads";
+	state.counter = (double)hud.quadCount();
+	hud.del();
+}
@@ -0,0 +1,101 @@
+/*
+	OBJ import throughput on generated terrain grids of "size" MB, parsed on the shared
+	job system and on a single thread for comparison.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "benchHarness.h"
+
+#include "jobSystem.h"
+#include "meshImport.h"
+
+// A grid with positions, uvs and normals, every corner is shared by up to six triangles
+static size_t writeGridOBJ(const std::string& path, int megabytes)
+{
+	// Roughly 150 bytes of text per grid point
+	int side = std::max(2, (int)std::sqrt(megabytes * 1000000.0 / 150.0));
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+		return 0;
+
+	std::string text;
+	char line[256];
+
+	auto flush = [&]()
+	{
+		std::fwrite(text.data(), 1, text.size(), file);
+		text.clear();
+	};
+
+	for (int z = 0; z < side; z++)
+	{
+		for (int x = 0; x < side; x++)
+		{
+			float height = 0.25f * std::sin(x * 0.05f) * std::cos(z * 0.05f);
+			int n = std::snprintf(line, sizeof(line), "v %.5f %.5f %.5f\nvt %.5f %.5f\nvn 0 1 0\n",
+				x * 0.1f, height, z * 0.1f, x / (float)(side - 1), z / (float)(side - 1));
+			text.append(line, (size_t)n);
+		}
+
+		if (text.size() > (1 << 20))
+			flush();
+	}
+
+	for (int z = 0; z + 1 < side; z++)
+	{
+		for (int x = 0; x + 1 < side; x++)
+		{
+			int a = z * side + x + 1, b = a + 1, c = a + side, d = c + 1;
+			int n = std::snprintf(line, sizeof(line), "f %d/%d/%d %d/%d/%d %d/%d/%d\nf %d/%d/%d %d/%d/%d %d/%d/%d\n",
+				a, a, a, c, c, c, b, b, b, b, b, b, c, c, c, d, d, d);
+			text.append(line, (size_t)n);
+		}
+
+		if (text.size() > (1 << 20))
+			flush();
+	}
+
+	flush();
+	std::fclose(file);
+	return (size_t)std::filesystem::file_size(path);
+}
+
+static std::string benchObjPath(int megabytes)
+{
+	return (std::filesystem::temp_directory_path() / ("ogl_bench_" + std::to_string(megabytes) + "mb.obj")).string();
+}
+
+static void runImport(benchState& state, jobSystem& jobs)
+{
+	std::string path = benchObjPath(state.size);
+	size_t bytes = writeGridOBJ(path, state.size);
+
+	importedMesh mesh;
+	while (state.keepRunning())
+	{
+		importOBJ(path.c_str(), mesh, jobs);
+		benchKeep(mesh.indices.size());
+	}
+
+	state.counterName = "mb_per_s";
+	state.counter = bytes / 1e6 / (state.seconds() / state.iterations());
+
+	std::filesystem::remove(path);
+}
+
+BENCH_CASE(import_obj_parallel, { 4, 64, 256 })
+{
+	runImport(state, jobSystem::shared());
+}
+
+BENCH_CASE(import_obj_serial, { 4, 64, 256 })
+{
+	jobSystem serial(0);
+	runImport(state, serial);
+}
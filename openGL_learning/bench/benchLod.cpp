@@ -0,0 +1,100 @@
+/*
+	LOD chain generation on a bumpy "size" x "size" terrain grid, and per frame level selection
+	for "size" objects spread out in front of the camera.
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "benchHarness.h"
+
+#include "meshLod.h"
+
+static void bumpyGrid(int side, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+	vertices.clear();
+	indices.clear();
+
+	for (int z = 0; z < side; z++)
+	{
+		for (int x = 0; x < side; x++)
+		{
+			float height = 0.5f * std::sin(x * 0.2f) * std::cos(z * 0.15f);
+			float v[8] = { (float)x, height, (float)z, 0.0f, 1.0f, 0.0f, (float)x / side, (float)z / side };
+			vertices.insert(vertices.end(), v, v + 8);
+		}
+	}
+
+	for (int z = 0; z + 1 < side; z++)
+	{
+		for (int x = 0; x + 1 < side; x++)
+		{
+			uint32_t a = (uint32_t)(z * side + x), b = a + 1, c = a + side, d = c + 1;
+			uint32_t triangles[6] = { a, c, b, b, c, d };
+			indices.insert(indices.end(), triangles, triangles + 6);
+		}
+	}
+}
+
+BENCH_CASE(lod_build, { 32, 128, 512 })
+{
+	std::vector<float> sourceVertices;
+	std::vector<uint32_t> sourceIndices;
+	bumpyGrid(state.size, sourceVertices, sourceIndices);
+
+	std::vector<float> vertices;
+	std::vector<uint32_t> indices;
+	lodChain chain;
+
+	while (state.keepRunning())
+	{
+		vertices = sourceVertices;
+		indices = sourceIndices;
+		buildLodChain(vertices, indices, 8, chain);
+		benchKeep(chain);
+	}
+
+	std::cerr << " ";
+	for (const meshLod& lod : chain.levels)
+		std::cerr << " " << lod.indexCount / 3 << " (" << lod.error << ")";
+	std::cerr << std::endl;
+
+	state.counterName = "levels";
+	state.counter = (double)chain.levels.size();
+}
+
+BENCH_CASE(lod_select, { 64, 1024, 16384 })
+{
+	std::vector<float> vertices;
+	std::vector<uint32_t> indices;
+	lodChain chain;
+	bumpyGrid(64, vertices, indices);
+	buildLodChain(vertices, indices, 8, chain);
+
+	std::vector<glm::vec3> centres;
+	std::vector<int> levels(state.size, 0);
+	for (int i = 0; i < state.size; i++)
+		centres.push_back(glm::vec3((float)(i % 128) * 80.0f, 0.0f, -(float)(i / 128) * 80.0f - 100.0f));
+
+	lodSelector selector;
+	float drift = 0.0f;
+
+	while (state.keepRunning())
+	{
+		// The camera moves a little every frame so levels keep changing near the switch points
+		drift += 0.5f;
+		selector.setView(glm::vec3(0.0f, 10.0f, std::fmod(drift, 400.0f)), 45.0f, 1080);
+
+		for (int i = 0; i < state.size; i++)
+			levels[i] = selector.select(chain, centres[i], 1.0f, levels[i]);
+		benchKeep(levels);
+	}
+
+	size_t triangles = 0;
+	for (int level : levels)
+		triangles += chain.levels[level].indexCount / 3;
+
+	state.counterName = "triangles_drawn";
+	state.counter = (double)triangles;
+}
@@ -0,0 +1,216 @@
+/*
+	CPU side benchmarks for the renderer.
+
+	Runs every registered BENCH_CASE against the null GL backend (no window, no driver) and
+	writes the results as JSON, one entry per case and scene size. Built with
+	OGL_GL_INSTRUMENT every entry also has the GL calls and draws per op (setup included,
+	spread over all iterations):
+
+		openGL_learning_bench [--out results.json] [--filter name] [--min-time seconds] [--repetitions n]
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "benchHarness.h"
+#include "glInstrument.h"
+#include "glModern.h"
+#include "nullGL.h"
+
+const void* volatile benchSink = nullptr;
+
+benchState::benchState(int size, double minSeconds)
+{
+	benchState::size = size;
+	benchState::minSeconds = minSeconds;
+}
+
+bool benchState::keepRunning()
+{
+	if (batchLeft > 0)
+	{
+		batchLeft--;
+		done++;
+		return true;
+	}
+
+	if (!started)
+	{
+		started = true;
+		start = std::chrono::steady_clock::now();
+	}
+	else
+	{
+		end = std::chrono::steady_clock::now();
+		if (seconds() >= minSeconds)
+			return false;
+		batch *= 2;
+	}
+
+	batchLeft = batch - 1;
+	done++;
+	return true;
+}
+
+long long benchState::iterations() const
+{
+	return done;
+}
+
+double benchState::seconds() const
+{
+	return std::chrono::duration<double>(end - start).count();
+}
+
+std::vector<benchCase>& benchCases()
+{
+	static std::vector<benchCase> cases;
+	return cases;
+}
+
+benchRegistrar::benchRegistrar(const char* name, std::vector<int> sizes, benchFunction run)
+{
+	benchCases().push_back({ name, sizes, run });
+}
+
+struct benchResult
+{
+	std::string name;
+	int size;
+	long long iterations;
+	double nsPerOp;
+	double minNsPerOp;
+	double maxNsPerOp;
+	double counter;
+	std::string counterName;
+	double glCallsPerOp;
+	double drawsPerOp;
+};
+
+static std::string jsonString(const std::string& text)
+{
+	std::string out = "\"";
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+			out += '\\';
+		out += c;
+	}
+	return out + "\"";
+}
+
+static void writeJson(std::ostream& out, const std::vector<benchResult>& results, double minSeconds, int repetitions)
+{
+	out << "{\n";
+	out << "  \"backend\": \"null\",\n";
+	out << "  \"min_time_s\": " << minSeconds << ",\n";
+	out << "  \"repetitions\": " << repetitions << ",\n";
+	out << "  \"results\": [\n";
+
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const benchResult& r = results[i];
+		out << "    { \"name\": " << jsonString(r.name)
+			<< ", \"scene_size\": " << r.size
+			<< ", \"iterations\": " << r.iterations
+			<< ", \"ns_per_op\": " << r.nsPerOp
+			<< ", \"ns_per_object\": " << r.nsPerOp / std::max(r.size, 1)
+			<< ", \"min_ns_per_op\": " << r.minNsPerOp
+			<< ", \"max_ns_per_op\": " << r.maxNsPerOp;
+		if (!r.counterName.empty())
+			out << ", " << jsonString(r.counterName) << ": " << r.counter;
+#ifdef OGL_GL_INSTRUMENT
+		out << ", \"gl_calls_per_op\": " << r.glCallsPerOp << ", \"draws_per_op\": " << r.drawsPerOp;
+#endif
+		out << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+
+	out << "  ]\n";
+	out << "}\n";
+}
+
+int main(int argc, char** argv)
+{
+	const char* outPath = nullptr;
+	const char* filter = nullptr;
+	double minSeconds = 0.1;
+	int repetitions = 3;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+			outPath = argv[++i];
+		else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+			filter = argv[++i];
+		else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+			minSeconds = std::atof(argv[++i]);
+		else if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+			repetitions = std::max(1, std::atoi(argv[++i]));
+		else
+		{
+			std::cout << "usage: " << argv[0] << " [--out file] [--filter name] [--min-time seconds] [--repetitions n]" << std::endl;
+			return 1;
+		}
+	}
+
+	if (!nullGLLoad())
+	{
+		std::cout << "Failed to load the null GL backend!" << std::endl;
+		return -1;
+	}
+	loadGLModern((GLADloadproc)nullGLGetProcAddress);
+	glInstrumentInstall();
+
+	std::vector<benchResult> results;
+
+	for (benchCase& c : benchCases())
+	{
+		if (filter && c.name.find(filter) == std::string::npos)
+			continue;
+
+		for (int size : c.sizes)
+		{
+			std::vector<double> nsPerOp;
+			benchResult result = { c.name, size, 0, 0.0, 0.0, 0.0, 0.0, "", 0.0, 0.0 };
+
+			for (int rep = 0; rep < repetitions; rep++)
+			{
+				benchState state(size, minSeconds);
+				glInstrumentEndFrame();
+				c.run(state);
+				glInstrumentEndFrame();
+
+				const glFrameCounters& calls = glInstrumentLastFrame();
+				result.glCallsPerOp = (double)calls.calls / std::max(state.iterations(), 1LL);
+				result.drawsPerOp = (double)calls.draws / std::max(state.iterations(), 1LL);
+
+				nsPerOp.push_back(state.seconds() * 1e9 / std::max(state.iterations(), 1LL));
+				result.iterations += state.iterations();
+				result.counter = state.counter;
+				result.counterName = state.counterName;
+			}
+
+			std::sort(nsPerOp.begin(), nsPerOp.end());
+			result.nsPerOp = nsPerOp[nsPerOp.size() / 2];
+			result.minNsPerOp = nsPerOp.front();
+			result.maxNsPerOp = nsPerOp.back();
+			results.push_back(result);
+
+			std::cerr << c.name << "/" << size << ": " << result.nsPerOp << " ns/op" << std::endl;
+		}
+	}
+
+	if (outPath)
+	{
+		std::ofstream file(outPath);
+		writeJson(file, results, minSeconds, repetitions);
+	}
+	else
+		writeJson(std::cout, results, minSeconds, repetitions);
+
+	return 0;
+}
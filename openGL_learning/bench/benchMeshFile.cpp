@@ -0,0 +1,94 @@
+/*
+	Startup cost of .oglm meshes: map the file, check the header, hand the blobs to GL.
+*/
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "benchHarness.h"
+
+#include "Cuboid.h"
+#include "EBO.h"
+#include "VAO.h"
+#include "VBO.h"
+#include "meshFile.h"
+
+static const meshAttribute cuboidLayout[5] = {
+	{ 0, 3, GL_FLOAT, GL_FALSE, 0 * sizeof(float) },
+	{ 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float) },
+	{ 2, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float) },
+	{ 3, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float) },
+	{ 4, 3, GL_FLOAT, GL_FALSE, 12 * sizeof(float) },
+};
+
+static std::string benchMeshPath(int i)
+{
+	return (std::filesystem::temp_directory_path() / ("ogl_bench_" + std::to_string(i) + ".oglm")).string();
+}
+
+// Loading and uploading "size" separate mesh files, the time per asset should stay flat
+BENCH_CASE(mesh_file_load, { 1, 64, 1024 })
+{
+	std::vector<std::string> paths;
+
+	for (int i = 0; i < state.size; i++)
+	{
+		Cuboid box(glm::vec3((float)i, 0.0f, 0.0f), glm::vec3(0.5f), glm::vec3(0.5f));
+		paths.push_back(benchMeshPath(i));
+		meshFile::write(paths.back().c_str(), cuboidLayout, 5, Cuboid::floatsPerVertex * sizeof(float),
+			box.vertices, Cuboid::vertexCount, Cuboid::indices, Cuboid::indexCount, GL_UNSIGNED_INT);
+	}
+
+	while (state.keepRunning())
+	{
+		for (const std::string& path : paths)
+		{
+			meshFile mesh(path.c_str());
+
+			VAO vao;
+			vao.bind();
+			VBO vbo(mesh.vertexData(), mesh.vertexBytes());
+			EBO ebo(mesh.indexData(), mesh.indexBytes(), mesh.header().indexType);
+			mesh.linkAttributes(vao, vbo);
+			vao.unbind();
+
+			vao.del();
+			vbo.del();
+			ebo.del();
+		}
+	}
+
+	for (const std::string& path : paths)
+		std::filesystem::remove(path);
+}
+
+// One mesh of "size" thousand cuboids, mapping cost should not grow with the file
+BENCH_CASE(mesh_file_map_large, { 1, 64, 1024 })
+{
+	std::vector<GLfloat> vertices;
+	std::vector<GLint> indices;
+
+	for (int i = 0; i < state.size * 1000; i++)
+	{
+		Cuboid box(glm::vec3((float)i, 0.0f, 0.0f), glm::vec3(0.5f), glm::vec3(0.5f));
+		vertices.insert(vertices.end(), box.vertices, box.vertices + Cuboid::vertexCount * Cuboid::floatsPerVertex);
+		for (GLint index : Cuboid::indices)
+			indices.push_back(index + i * Cuboid::vertexCount);
+	}
+
+	std::string path = benchMeshPath(-1);
+	meshFile::write(path.c_str(), cuboidLayout, 5, Cuboid::floatsPerVertex * sizeof(float),
+		vertices.data(), (uint32_t)(vertices.size() / Cuboid::floatsPerVertex), indices.data(), (uint32_t)indices.size(), GL_UNSIGNED_INT);
+
+	while (state.keepRunning())
+	{
+		meshFile mesh(path.c_str());
+		benchKeep(mesh.header().vertexCount);
+	}
+
+	state.counterName = "file_bytes";
+	state.counter = (double)(vertices.size() * sizeof(GLfloat) + indices.size() * sizeof(GLint));
+
+	std::filesystem::remove(path);
+}
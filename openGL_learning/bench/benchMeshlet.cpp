@@ -0,0 +1,96 @@
+/*
+	Meshlet building on a "size" x "size" segment sphere, and per frame meshlet culling of
+	the same sphere seen from outside: about half of it faces away, part of it is off screen.
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "benchHarness.h"
+
+#include "meshlet.h"
+
+static void uvSphere(int segments, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+	vertices.clear();
+	indices.clear();
+
+	const float pi = 3.14159265f;
+	for (int y = 0; y <= segments; y++)
+	{
+		for (int x = 0; x <= segments; x++)
+		{
+			float theta = pi * y / segments, phi = 2.0f * pi * x / segments;
+			glm::vec3 p(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+			vertices.insert(vertices.end(), { p.x * 10.0f, p.y * 10.0f, p.z * 10.0f, p.x, p.y, p.z });
+		}
+	}
+
+	for (int y = 0; y < segments; y++)
+	{
+		for (int x = 0; x < segments; x++)
+		{
+			uint32_t a = (uint32_t)(y * (segments + 1) + x), b = a + 1, c = a + segments + 1, d = c + 1;
+			uint32_t triangles[6] = { a, b, c, b, d, c };
+			indices.insert(indices.end(), triangles, triangles + 6);
+		}
+	}
+}
+
+BENCH_CASE(meshlet_build, { 64, 256, 1024 })
+{
+	std::vector<float> vertices;
+	std::vector<uint32_t> sourceIndices, indices;
+	uvSphere(state.size, vertices, sourceIndices);
+	meshletSet set;
+
+	while (state.keepRunning())
+	{
+		indices = sourceIndices;
+		buildMeshlets(set, indices.data(), indices.size(), vertices.data(), vertices.size() / 6, 6);
+		benchKeep(set);
+	}
+
+	size_t vertexSum = 0, triangleSum = 0;
+	for (const meshlet& m : set.meshlets)
+	{
+		vertexSum += m.vertexCount;
+		triangleSum += m.indexCount / 3;
+	}
+	std::cerr << "  " << set.meshlets.size() << " meshlets, " << (double)vertexSum / set.meshlets.size() << " vertices / "
+		<< (double)triangleSum / set.meshlets.size() << " triangles on average" << std::endl;
+
+	state.counterName = "meshlets";
+	state.counter = (double)set.meshlets.size();
+}
+
+BENCH_CASE(meshlet_cull, { 64, 256, 1024 })
+{
+	std::vector<float> vertices;
+	std::vector<uint32_t> indices;
+	uvSphere(state.size, vertices, indices);
+	meshletSet set;
+	buildMeshlets(set, indices.data(), indices.size(), vertices.data(), vertices.size() / 6, 6);
+
+	glm::vec3 eye(0.0f, 4.0f, 18.0f);
+	glm::mat4 view = glm::lookAt(eye, glm::vec3(4.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 viewProjection = glm::perspective(glm::radians(50.0f), 16.0f / 9.0f, 0.1f, 100.0f) * view;
+
+	std::vector<uint32_t> visible;
+	meshletCullStats stats;
+
+	while (state.keepRunning())
+	{
+		cullMeshlets(set, indices.data(), glm::mat4(1.0f), viewProjection, eye, visible, &stats);
+		benchKeep(visible);
+	}
+
+	std::cerr << "  " << stats.tested << " tested, " << stats.outside << " outside, " << stats.backfacing << " backfacing" << std::endl;
+
+	state.counterName = "triangles_kept";
+	state.counter = (double)(visible.size() / 3) / (indices.size() / 3);
+}
@@ -0,0 +1,52 @@
+/*
+	One frame of software occlusion culling: a row of wall boxes in front of a field of
+	"size" small cuboids, rasterize the walls and test every cuboid against the Hi-Z pyramid.
+*/
+
+#include <vector>
+
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "benchHarness.h"
+
+#include "occlusionCuller.h"
+
+BENCH_CASE(occlusion_cull, { 1024, 16384, 65536 })
+{
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, 2.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+	glm::mat4 viewProjection = projection * view;
+
+	// Walls with gaps between them, some of the field shows through
+	std::vector<glm::vec3> wallMins, wallMaxs;
+	for (int i = -8; i < 8; i++)
+	{
+		wallMins.push_back(glm::vec3(i * 6.0f, 0.0f, -20.0f));
+		wallMaxs.push_back(glm::vec3(i * 6.0f + 5.0f, 8.0f, -19.0f));
+	}
+
+	std::vector<glm::vec3> mins, maxs;
+	int columns = 128;
+	for (int i = 0; i < state.size; i++)
+	{
+		glm::vec3 centre((i % columns - columns / 2) * 1.5f, 0.5f, -25.0f - (i / columns) * 1.5f);
+		mins.push_back(centre - glm::vec3(0.5f));
+		maxs.push_back(centre + glm::vec3(0.5f));
+	}
+
+	occlusionCuller culler;
+	std::vector<unsigned char> visible(state.size);
+
+	while (state.keepRunning())
+	{
+		culler.beginFrame(viewProjection);
+		for (size_t i = 0; i < wallMins.size(); i++)
+			culler.addOccluder(wallMins[i], wallMaxs[i]);
+		culler.rasterize();
+		culler.testBounds(mins.data(), maxs.data(), mins.size(), visible.data());
+	}
+
+	state.counterName = "culled_fraction";
+	state.counter = (double)(culler.lastOccluded + culler.lastOutside) / state.size;
+}
@@ -0,0 +1,77 @@
+/*
+	Index reordering on "size" x "size" vertex grids whose triangles were shuffled, like a
+	mesh coming out of an exporter with no care for the vertex cache. The ACMR / ATVR before
+	and after are printed once per scene size.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "benchHarness.h"
+
+#include "EBO.h"
+#include "meshOptimize.h"
+
+static void shuffledGrid(int side, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+	vertices.clear();
+	indices.clear();
+
+	for (int z = 0; z < side; z++)
+	{
+		for (int x = 0; x < side; x++)
+		{
+			float v[8] = { (float)x, 0.0f, (float)z, 0.0f, 1.0f, 0.0f, (float)x / side, (float)z / side };
+			vertices.insert(vertices.end(), v, v + 8);
+		}
+	}
+
+	std::vector<uint32_t> quads;
+	for (int z = 0; z + 1 < side; z++)
+	{
+		for (int x = 0; x + 1 < side; x++)
+			quads.push_back((uint32_t)(z * side + x));
+	}
+
+	std::mt19937 random(1234);
+	std::shuffle(quads.begin(), quads.end(), random);
+
+	for (uint32_t a : quads)
+	{
+		uint32_t b = a + 1, c = a + side, d = c + 1;
+		uint32_t triangles[6] = { a, c, b, b, c, d };
+		indices.insert(indices.end(), triangles, triangles + 6);
+	}
+}
+
+BENCH_CASE(mesh_optimize, { 16, 64, 256 })
+{
+	std::vector<float> sourceVertices;
+	std::vector<uint32_t> sourceIndices;
+	shuffledGrid(state.size, sourceVertices, sourceIndices);
+
+	std::vector<float> vertices;
+	std::vector<uint32_t> indices;
+	meshOptimizeReport report;
+
+	while (state.keepRunning())
+	{
+		vertices = sourceVertices;
+		indices = sourceIndices;
+		report = optimizeMesh(vertices, indices, 8);
+		benchKeep(report);
+	}
+
+	std::vector<unsigned char> narrowed;
+	GLenum type = EBO::narrowestType((GLuint)(vertices.size() / 8 - 1));
+	EBO::narrow(indices.data(), indices.size(), type, narrowed);
+
+	std::cerr << "  acmr " << report.before.acmr << " -> " << report.after.acmr
+		<< ", atvr " << report.before.atvr << " -> " << report.after.atvr
+		<< ", index bytes " << indices.size() * sizeof(uint32_t) << " -> " << narrowed.size() << std::endl;
+
+	state.counterName = "acmr_after";
+	state.counter = report.after.acmr;
+}
@@ -0,0 +1,25 @@
+/*
+	Cost of PROFILE_SCOPE: "size" nested scopes per op. Built without OGL_PROFILE the macro is
+	empty and this measures the loop alone, the difference is the overhead of a scope.
+*/
+
+#include "benchHarness.h"
+
+#include "profiler.h"
+
+static int nested(int depth)
+{
+	PROFILE_SCOPE("nested");
+	return depth > 1 ? nested(depth - 1) + 1 : 1;
+}
+
+BENCH_CASE(profile_scope, { 1, 8, 64 })
+{
+	uint64_t before = profilerCpuScopes();
+
+	while (state.keepRunning())
+		benchKeep(nested(state.size));
+
+	state.counterName = "scopes_recorded";
+	state.counter = (double)(profilerCpuScopes() - before);
+}
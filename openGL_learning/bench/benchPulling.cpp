@@ -0,0 +1,94 @@
+/*
+	Drawing "size" small meshes in three different vertex layouts: one VAO per mesh with
+	its own attribute setup, against vertex pulling from shared buffers through one VAO.
+*/
+
+#include <vector>
+
+#include "benchHarness.h"
+
+#include "EBO.h"
+#include "VAO.h"
+#include "VBO.h"
+#include "shader.h"
+#include "vertexPuller.h"
+
+static const pulledFormat formats[3] = {
+	{ 3, 0, -1, -1, -1 },   // position
+	{ 6, 0, 3, -1, -1 },    // position, normal
+	{ 8, 0, 3, 6, -1 },     // position, normal, uv
+};
+
+static const GLuint quadIndices[6] = { 0, 1, 2, 2, 1, 3 };
+
+BENCH_CASE(draw_vao_per_mesh, { 64, 1024, 16384 })
+{
+	std::vector<float> vertices(4 * 8, 0.5f);
+	std::vector<VAO> vaos;
+	std::vector<VBO> vbos;
+	std::vector<EBO> ebos;
+
+	for (int i = 0; i < state.size; i++)
+	{
+		const pulledFormat& f = formats[i % 3];
+		vaos.emplace_back();
+		vaos.back().bind();
+		vbos.emplace_back((const void*)vertices.data(), (GLsizeiptr)(4 * f.stride * sizeof(float)));
+		ebos.emplace_back(quadIndices, (GLsizeiptr)sizeof(quadIndices));
+
+		GLsizeiptr stride = f.stride * sizeof(float);
+		vaos.back().linkArray(vbos.back(), 0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
+		if (f.normal >= 0)
+			vaos.back().linkArray(vbos.back(), 1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(f.normal * sizeof(float)));
+		if (f.uv >= 0)
+			vaos.back().linkArray(vbos.back(), 2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(f.uv * sizeof(float)));
+		vaos.back().unbind();
+	}
+
+	while (state.keepRunning())
+	{
+		for (int i = 0; i < state.size; i++)
+		{
+			vaos[i].bind();
+			glDrawElements(GL_TRIANGLES, ebos[i].indexCount(), ebos[i].indexType(), 0);
+		}
+		glBindVertexArray(0);
+	}
+
+	for (int i = 0; i < state.size; i++)
+	{
+		vaos[i].del();
+		vbos[i].del();
+		ebos[i].del();
+	}
+}
+
+BENCH_CASE(draw_vertex_pulling, { 64, 1024, 16384 })
+{
+	shader sh(OGL_SHADER_DIR "pulledVertex.vert", OGL_SHADER_DIR "fragmentShader.frag");
+	std::vector<float> vertices(4 * 8, 0.5f);
+	uint32_t indices[6] = { 0, 1, 2, 2, 1, 3 };
+
+	vertexPuller puller(1 << 16, 1 << 14);
+	std::vector<pulledMesh> meshes;
+	// Sorted by layout, the way a renderer would batch them
+	for (int f = 0; f < 3; f++)
+	{
+		for (int i = f; i < state.size; i += 3)
+			meshes.push_back(puller.add(vertices.data(), 4, formats[f], indices, 6));
+	}
+
+	while (state.keepRunning())
+	{
+		puller.begin(sh);
+		for (const pulledMesh& mesh : meshes)
+			puller.draw(mesh);
+		puller.end();
+	}
+
+	state.counterName = "arena_bytes";
+	state.counter = (double)(puller.vertexArena().used() + puller.indexArena().used());
+
+	puller.del();
+	sh.del();
+}
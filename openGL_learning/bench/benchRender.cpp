@@ -0,0 +1,126 @@
+/*
+	The per-frame CPU work Source.cpp does, scaled up to scenes of "size" objects.
+*/
+
+#include <vector>
+
+#include "benchHarness.h"
+
+#include "Cuboid.h"
+#include "EBO.h"
+#include "VAO.h"
+#include "VBO.h"
+#include "camera.h"
+#include "shader.h"
+
+static const char* vertexPath = OGL_SHADER_DIR "vertexShader.vert";
+static const char* fragmentPath = OGL_SHADER_DIR "fragmentShader.frag";
+
+// glGetUniformLocation + glUniform for the light direction and intensity of every object
+BENCH_CASE(uniform_update, { 1, 64, 1024, 16384 })
+{
+	shader sh(vertexPath, fragmentPath);
+	sh.use();
+
+	glm::vec3 lightCentre = { -0.175f, 0.675f, 0.875f };
+	std::vector<glm::vec3> centres;
+	for (int i = 0; i < state.size; i++)
+		centres.push_back(glm::vec3((float)(i % 32), 0.0f, (float)(i / 32)));
+
+	while (state.keepRunning())
+	{
+		for (const glm::vec3& centre : centres)
+		{
+			GLint directionLocation = glGetUniformLocation(sh.ID, "direction");
+			GLint intensityLocation = glGetUniformLocation(sh.ID, "intensity");
+
+			glm::vec3 direction = centre - lightCentre;
+			glUniform1f(intensityLocation, 0.5f);
+			glUniform3fv(directionLocation, 1, glm::value_ptr(direction));
+		}
+	}
+
+	sh.del();
+}
+
+// camera::matrix rebuilds view and projection and uploads them, once per object here
+BENCH_CASE(camera_matrix, { 1, 64, 1024, 16384 })
+{
+	shader sh(vertexPath, fragmentPath);
+	camera cam(800, 600, glm::vec3(0.0f, 0.0f, 2.0f));
+
+	while (state.keepRunning())
+	{
+		for (int i = 0; i < state.size; i++)
+		{
+			cam.position.x = (float)i * 0.001f;
+			cam.matrix(90.0f, 0.1f, 1000.0f, sh, "proview");
+		}
+	}
+
+	sh.del();
+}
+
+// One VAO / VBO / EBO per cuboid, then bind + glDrawElements for each
+BENCH_CASE(draw_submission, { 1, 64, 1024, 16384 })
+{
+	std::vector<VAO> vaos;
+	std::vector<VBO> vbos;
+	std::vector<EBO> ebos;
+
+	for (int i = 0; i < state.size; i++)
+	{
+		Cuboid box(glm::vec3((float)i, 0.0f, 0.0f), glm::vec3(0.5f), glm::vec3(0.5f));
+
+		vaos.emplace_back();
+		vaos.back().bind();
+
+		vbos.emplace_back(box.vertices, (int)sizeof(box.vertices));
+		ebos.emplace_back((GLint*)Cuboid::indices, (GLsizeiptr)sizeof(Cuboid::indices));
+
+		for (GLuint attribute = 0; attribute < 5; attribute++)
+			vaos.back().linkArray(vbos.back(), attribute, 3, GL_FLOAT, GL_FALSE, Cuboid::floatsPerVertex * sizeof(float), (void*)(attribute * 3 * sizeof(float)));
+		vaos.back().unbind();
+	}
+
+	while (state.keepRunning())
+	{
+		for (size_t i = 0; i < vaos.size(); i++)
+		{
+			vaos[i].bind();
+			glDrawElements(GL_TRIANGLES, ebos[i].indexCount(), ebos[i].indexType(), 0);
+		}
+	}
+
+	state.counterName = "triangles_per_op";
+	state.counter = (double)state.size * Cuboid::indexCount / 3;
+}
+
+// Reading both stages from disk, compiling and linking
+BENCH_CASE(shader_load, { 1, 8 })
+{
+	while (state.keepRunning())
+	{
+		for (int i = 0; i < state.size; i++)
+		{
+			shader sh(vertexPath, fragmentPath);
+			sh.del();
+		}
+	}
+}
+
+// Filling the vertex arrays of every cuboid in the scene
+BENCH_CASE(mesh_generation, { 1, 64, 1024, 16384 })
+{
+	while (state.keepRunning())
+	{
+		for (int i = 0; i < state.size; i++)
+		{
+			Cuboid box(glm::vec3((float)i, 0.0f, 0.0f), glm::vec3(0.5f), glm::vec3(0.5f, 0.0f, 0.0f));
+			benchKeep(box.vertices);
+		}
+	}
+
+	state.counterName = "bytes_per_op";
+	state.counter = (double)state.size * sizeof(Cuboid::vertices);
+}
@@ -0,0 +1,55 @@
+/*
+	Dynamic resolution controller against a simulated GPU: a scene costing "size" ms at full
+	resolution, with a spike of twice that every 200 frames, and a 14 ms budget. Reports how
+	many frames went over budget after the controller settled.
+*/
+
+#include <cmath>
+#include <iostream>
+
+#include "benchHarness.h"
+
+#include "dynamicResolution.h"
+
+BENCH_CASE(resolution_controller, { 8, 16, 24, 40 })
+{
+	resolutionController controller;
+	size_t frames = 0, overBudget = 0;
+	float scaleSum = 0.0f;
+
+	while (state.keepRunning())
+	{
+		float scale = controller.scale();
+		float fullCost = (float)state.size * (frames % 200 < 10 ? 2.0f : 1.0f) * (1.0f + 0.05f * std::sin(frames * 0.7f));
+		float gpuMs = fullCost * scale * scale;
+
+		if (frames >= 50 && gpuMs > controller.budgetMs)
+			overBudget++;
+		scaleSum += scale;
+		frames++;
+
+		benchKeep(controller.update(gpuMs, scale));
+	}
+
+	std::cerr << "  average scale " << scaleSum / frames << std::endl;
+
+	state.counterName = "over_budget_pct";
+	state.counter = frames > 50 ? 100.0 * overBudget / (frames - 50) : 0.0;
+}
+
+// begin / end of one frame: query polling, target bind and upscale blit
+BENCH_CASE(resolution_frame, { 1 })
+{
+	dynamicResolution resolution(1920, 1080);
+
+	while (state.keepRunning())
+	{
+		resolution.resize(1920, 1080);
+		resolution.begin();
+		resolution.end();
+	}
+
+	state.counterName = "history";
+	state.counter = (double)resolution.history().size();
+	resolution.del();
+}
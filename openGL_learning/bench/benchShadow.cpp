@@ -0,0 +1,60 @@
+/*
+	Shadow atlas updates for "size" point lights over a scene of 256 static casters, with
+	one moving caster near the first light: the cached path against re-rendering every
+	light every frame.
+*/
+
+#include <glm.hpp>
+
+#include "benchHarness.h"
+
+#include "shadowAtlas.h"
+
+static const char* depthVertexPath = OGL_SHADER_DIR "shadowDepth.vert";
+static const char* depthFragmentPath = OGL_SHADER_DIR "shadowDepth.frag";
+
+static void runShadows(benchState& state, bool cached)
+{
+	shadowAtlas atlas(depthVertexPath, depthFragmentPath, 8192, 128);
+	for (int i = 0; i < state.size; i++)
+	{
+		int light = atlas.addLight(pointShadow, 256);
+		atlas.setPoint(light, glm::vec3((float)(i % 8) * 10.0f, 3.0f, (float)(i / 8) * 10.0f), 6.0f);
+	}
+
+	GLint modelLocation = glGetUniformLocation(atlas.depthShader().ID, "model");
+	glm::mat4 model(1.0f);
+	auto drawCasters = [&](const glm::mat4& lightViewProjection, bool dynamicCasters)
+	{
+		int count = dynamicCasters ? 1 : 256;
+		for (int i = 0; i < count; i++)
+		{
+			glUniformMatrix4fv(modelLocation, 1, GL_FALSE, &model[0][0]);
+			glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_BYTE, 0);
+		}
+	};
+
+	size_t faces = 0;
+	while (state.keepRunning())
+	{
+		if (!cached)
+			atlas.staticGeometryChanged();
+		atlas.addDynamicCaster(glm::vec3(1.0f), glm::vec3(2.0f));
+		atlas.update(drawCasters);
+		faces = atlas.lastStaticRenders + atlas.lastDynamicRenders;
+	}
+
+	state.counterName = "faces_rendered";
+	state.counter = (double)faces;
+	atlas.del();
+}
+
+BENCH_CASE(shadow_update_cached, { 1, 16, 64 })
+{
+	runShadows(state, true);
+}
+
+BENCH_CASE(shadow_update_uncached, { 1, 16, 64 })
+{
+	runShadows(state, false);
+}
@@ -0,0 +1,98 @@
+/*
+	Voxel worlds of "size" chunks (32 is a million voxels) of rolling terrain.
+
+	voxel_greedy_mesh meshes every chunk on the jobs, the counter is the triangles drawn as a
+	percentage of drawing every solid voxel as a 12 triangle cube. voxel_edit is one voxel
+	changed and the world brought up to date: two chunks remeshed when it is on a border, one
+	otherwise, and the upload.
+*/
+
+#include <cmath>
+
+#include "benchHarness.h"
+
+#include "jobSystem.h"
+#include "voxelWorld.h"
+
+// Columns up to a height of sin waves, stone under a layer of grass
+static void fillTerrain(voxelWorld& world)
+{
+	glm::ivec3 size = world.size();
+	for (int z = 0; z < size.z; z++)
+	{
+		for (int x = 0; x < size.x; x++)
+		{
+			int height = (int)(size.y * (0.45f + 0.2f * std::sin(x * 0.09f) * std::cos(z * 0.07f)));
+			world.fill(glm::ivec3(x, 0, z), glm::ivec3(x, height - 2, z), 1);
+			world.fill(glm::ivec3(x, height - 1, z), glm::ivec3(x, height, z), 2);
+		}
+	}
+}
+
+static glm::ivec3 chunkGrid(int chunks)
+{
+	int side = (int)std::sqrt((double)chunks);
+	return glm::ivec3(side, 1, chunks / side);
+}
+
+BENCH_CASE(voxel_greedy_mesh, { 1, 8, 32 })
+{
+	voxelWorld world(chunkGrid(state.size));
+	fillTerrain(world);
+
+	// The chunk copies the world makes for its jobs, taken once
+	glm::ivec3 chunks = world.size() / voxelChunkSize;
+	std::vector<std::vector<uint8_t>> padded(state.size, std::vector<uint8_t>(voxelPaddedSize * voxelPaddedSize * voxelPaddedSize));
+	std::vector<glm::ivec3> origins(state.size);
+	for (int i = 0; i < state.size; i++)
+	{
+		origins[i] = glm::ivec3(i % chunks.x, 0, i / chunks.x) * voxelChunkSize;
+		for (int z = -1; z <= voxelChunkSize; z++)
+			for (int y = -1; y <= voxelChunkSize; y++)
+				for (int x = -1; x <= voxelChunkSize; x++)
+					padded[i][voxelPaddedIndex(x, y, z)] = world.get(origins[i] + glm::ivec3(x, y, z));
+	}
+
+	std::vector<std::vector<voxelVertex>> meshes(state.size);
+	std::vector<size_t> quads(state.size);
+	while (state.keepRunning())
+	{
+		jobSystem::shared().parallelFor(state.size, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				meshes[i].clear();
+				quads[i] = voxelGreedyMesh(padded[i].data(), origins[i], meshes[i]);
+			}
+		});
+		benchKeep(quads);
+	}
+
+	size_t total = 0;
+	for (size_t q : quads)
+		total += q;
+	state.counterName = "percent_of_cube_triangles";
+	state.counter = 100.0 * (double)(total * 2) / ((double)world.solidVoxels() * 12);
+	world.del();
+}
+
+BENCH_CASE(voxel_edit, { 8, 32 })
+{
+	voxelWorld world(chunkGrid(state.size));
+	fillTerrain(world);
+	world.finish();
+
+	glm::ivec3 size = world.size();
+	unsigned seed = 7;
+	while (state.keepRunning())
+	{
+		seed = seed * 1664525u + 1013904223u;
+		glm::ivec3 voxel((int)(seed % size.x), size.y / 2, (int)((seed >> 12) % size.z));
+		world.set(voxel, world.get(voxel) ? 0 : 1);
+		world.finish();
+	}
+
+	state.counterName = "quads";
+	state.counter = (double)world.quadCount();
+	world.del();
+}
@@ -1 +1,21 @@
 #include "Cuboid.h"
+
+// Generates the 8 corners of a box around centre, in the order of primitiveCornerSigns
+Cuboid::Cuboid(glm::vec3 centre, glm::vec3 dims, glm::vec3 colour)
+{
+	Cuboid::centre = centre;
+
+	glm::vec3 half = dims / 2.0f;
+
+	for (int i = 0; i < vertexCount; i++)
+	{
+		const float* sign = primitiveCornerSigns[i];
+
+		// The signs double as the normals, sceneLayout splits them per axis
+		primitivePoint p = {};
+		p.position = { centre.x + sign[0] * half.x, centre.y + sign[1] * half.y, centre.z + sign[2] * half.z };
+		p.normal = { sign[0], sign[1], sign[2] };
+		p.colour = { colour.x, colour.y, colour.z };
+		sceneLayout::write(&vertices[i * floatsPerVertex], p);
+	}
+}
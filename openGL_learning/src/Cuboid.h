@@ -1,11 +1,22 @@
 #pragma once
 
-#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+#include <glm.hpp>
+
+#include "primitives.h"
 
 class Cuboid
 {
-	GLfloat vertices[8] = {};
-	GLint indices[];
+	public:
+		// Same layout as vertexShader.vert: position, colour, x/y/z normals
+		static const int vertexCount = 8;
+		static const int floatsPerVertex = 15;
+		static const int indexCount = 36;
+		static constexpr const GLint (&indices)[indexCount] = primitiveCornerIndices;
 
-};
+		GLfloat vertices[vertexCount * floatsPerVertex] = {};
+		glm::vec3 centre;
 
+		// primitiveCorners<sceneLayout> for boxes only known at run time
+		Cuboid(glm::vec3 centre, glm::vec3 dims, glm::vec3 colour);
+};
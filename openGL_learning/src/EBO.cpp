@@ -1,10 +1,74 @@
 #include "EBO.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "gpuMemory.h"
+
 EBO::EBO(GLint* indices, GLsizeiptr size)
 {
+	upload((const GLuint*)indices, (size_t)size / sizeof(GLint));
+}
+
+EBO::EBO(const GLuint* indices, GLsizeiptr size)
+{
+	upload(indices, (size_t)size / sizeof(GLuint));
+}
+
+EBO::EBO(const void* indices, GLsizeiptr size, GLenum indexType)
+{
+	type = indexType;
+	count = (GLsizei)(size / typeSize(indexType));
+
 	glGenBuffers(1, &ID);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ID);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, GL_STATIC_DRAW);
+	gpuMemoryAllocate(gpuMemoryIndex, GL_BUFFER, ID, (size_t)size, "EBO");
+}
+
+EBO::~EBO()
+{
+	del();
+}
+
+EBO::EBO(EBO&& other) noexcept
+	: ID(other.ID), type(other.type), count(other.count)
+{
+	other.ID = 0;
+	other.count = 0;
+}
+
+EBO& EBO::operator=(EBO&& other) noexcept
+{
+	if (this != &other)
+	{
+		del();
+		ID = other.ID;
+		type = other.type;
+		count = other.count;
+		other.ID = 0;
+		other.count = 0;
+	}
+	return *this;
+}
+
+void EBO::upload(const GLuint* indices, size_t indexCount)
+{
+	GLuint maxIndex = 0;
+	for (size_t i = 0; i < indexCount; i++)
+		maxIndex = std::max(maxIndex, indices[i]);
+
+	type = narrowestType(maxIndex);
+	count = (GLsizei)indexCount;
+
+	std::vector<unsigned char> narrowed;
+	narrow(indices, indexCount, type, narrowed);
+
+	glGenBuffers(1, &ID);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ID);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)narrowed.size(), narrowed.data(), GL_STATIC_DRAW);
+	gpuMemoryAllocate(gpuMemoryIndex, GL_BUFFER, ID, narrowed.size(), "EBO");
 }
 
 void EBO::bind()
@@ -19,5 +83,63 @@ void EBO::unbind()
 
 void EBO::del()
 {
-	glDeleteVertexArrays(1, &ID);
+	if (ID == 0)
+		return;
+
+	gpuMemoryRelease(GL_BUFFER, ID);
+	glDeleteBuffers(1, &ID);
+	ID = 0;
+}
+
+GLenum EBO::indexType() const
+{
+	return type;
+}
+
+GLsizei EBO::indexCount() const
+{
+	return count;
+}
+
+GLenum EBO::narrowestType(GLuint maxIndex)
+{
+	if (maxIndex <= 0xFF)
+		return GL_UNSIGNED_BYTE;
+	if (maxIndex <= 0xFFFF)
+		return GL_UNSIGNED_SHORT;
+	return GL_UNSIGNED_INT;
+}
+
+void EBO::narrow(const GLuint* indices, size_t count, GLenum indexType, std::vector<unsigned char>& out)
+{
+	out.resize(count * (size_t)typeSize(indexType));
+
+	switch (indexType)
+	{
+	case GL_UNSIGNED_BYTE:
+		for (size_t i = 0; i < count; i++)
+			out[i] = (unsigned char)indices[i];
+		break;
+	case GL_UNSIGNED_SHORT:
+	{
+		uint16_t* shorts = (uint16_t*)out.data();
+		for (size_t i = 0; i < count; i++)
+			shorts[i] = (uint16_t)indices[i];
+		break;
+	}
+	default:
+		if (count > 0)
+			std::memcpy(out.data(), indices, count * sizeof(GLuint));
+		break;
+	}
+}
+
+GLsizeiptr EBO::typeSize(GLenum indexType)
+{
+	switch (indexType)
+	{
+	case GL_UNSIGNED_BYTE: return 1;
+	case GL_UNSIGNED_SHORT: return 2;
+	default: return 4;
+	}
 }
@@ -5,15 +5,52 @@
 
 #include <glad/glad.h>
 
+#include <cstddef>
+#include <vector>
+
+/*
+	Index buffer. Indices handed over as GLint / GLuint are stored in the narrowest type
+	that can hold the largest index (GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT),
+	so draws must use indexType() and indexCount() instead of assuming 32 bit indices.
+
+	Owns the GL buffer like VBO: deleted with the object, moved but never copied, counted as
+	index memory in the ledger (gpuMemory.h).
+*/
+
 class EBO
 {
-	GLuint ID;
+	GLuint ID = 0;
+	GLenum type = GL_UNSIGNED_INT;
+	GLsizei count = 0;
 
 	public:
 		EBO(GLint* indices, GLsizeiptr size);
+		EBO(const GLuint* indices, GLsizeiptr size);
+		// Raw bytes already in their final type, e.g. an index blob mapped straight from a mesh file
+		EBO(const void* indices, GLsizeiptr size, GLenum indexType = GL_UNSIGNED_INT);
+		~EBO();
+
+		EBO(EBO&& other) noexcept;
+		EBO& operator=(EBO&& other) noexcept;
+		EBO(const EBO&) = delete;
+		EBO& operator=(const EBO&) = delete;
+
 		void bind();
 		void unbind();
+		// Deletes the buffer now instead of in the destructor
 		void del();
+
+		GLenum indexType() const;
+		GLsizei indexCount() const;
+
+		// Smallest index type able to address maxIndex
+		static GLenum narrowestType(GLuint maxIndex);
+		// Copies count indices into out as the given type, out is resized to fit
+		static void narrow(const GLuint* indices, size_t count, GLenum indexType, std::vector<unsigned char>& out);
+		static GLsizeiptr typeSize(GLenum indexType);
+
+	private:
+		void upload(const GLuint* indices, size_t indexCount);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -25,7 +25,12 @@
 	 - Without something like GLAD we would have to manually specify / give the function pointers at run time. GLAD just simply eliminates the extra work!
 */
 
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 //#include <KHR/khrplatform.h>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h> // openGL is a platform independant library so the platform specific functionality needs to be specified
@@ -43,18 +48,43 @@
 #include "VBO.h"
 #include "EBO.h"
 #include "light.h"
+#include "glModern.h"
+#include "gpuCuller.h"
+#include "glInstrument.h"
+#include "glTrace.h"
+#include "shadowAtlas.h"
+#include "lightBaker.h"
+#include "dynamicResolution.h"
+#include "gpuMemory.h"
+#include "perfHud.h"
+#include "profiler.h"
+#include "entityStore.h"
+#include "voxelWorld.h"
+#include "primitives.h"
+#include "geometryRegistry.h"
+#include "redrawScheduler.h"
+#include "vertexPuller.h"
+#include "deferredRenderer.h"
+#include "renderGraph.h"
 
 static void glfwError(int id, const char* description)
 {
 	std::cout << description << std::endl;
 }
 
-void frameBufferSizeCallback(GLFWwindow* window, int width, int height)
+// The passes that draw into the window, renderScene() sets it while its graph exists
+static renderGraph* windowGraph = nullptr;
+
+void frameBufferSizeCallback(GLFWwindow*, int width, int height)
 {
-	glViewport(width, height, 0, 0);
+	glViewport(0, 0, width, height);
+	if (windowGraph)
+		windowGraph->resize(width, height);
 }
 
-int main()
+static void renderScene(GLFWwindow* window);
+
+int main(int argc, char** argv)
 {
 	glfwSetErrorCallback(&glfwError);
 	if (!glfwInit())
@@ -99,6 +129,39 @@ int main()
 		std::cout << "Failed to initialize glad!" << std::endl;
 		return -1;
 	}
+
+	/*
+		GL 4.3+ functions for the GPU driven path (gpuCuller), the VAO / EBO draws below
+		work without them
+	*/
+	if (loadGLModern((GLADloadproc)glfwGetProcAddress))
+	{
+		std::cout << "GPU driven culling available" << (glModern.indirectCount ? " (indirect count)" : "") << std::endl;
+	}
+
+	/*
+		Per frame GL call counts in the title, only in builds with OGL_GL_INSTRUMENT (Debug)
+	*/
+	if (glInstrumentInstall(true))
+	{
+		glInstrumentDebugOutput((GLADloadproc)glfwGetProcAddress);
+	}
+
+	/*
+		"--trace file" records frames 300 to 304 for openGL_learning_replay, started before
+		anything is created so the trace holds every object those frames use.
+		"--profile file" writes the CPU / GPU timeline of the last frames at exit (builds with
+		OGL_PROFILE, Debug), for chrome://tracing or ui.perfetto.dev
+	*/
+	const char* profilePath = nullptr;
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--trace") == 0)
+			glTraceStart(argv[++i], 300, 5);
+		else if (std::strcmp(argv[i], "--profile") == 0)
+			profilePath = argv[++i];
+	}
+	profilerThreadName("main");
 	
 	/*
 		Gives the specifications for the actual viewport, dimensions
@@ -112,6 +175,26 @@ int main()
 	*/
 	glfwSetFramebufferSizeCallback(window, frameBufferSizeCallback);
 
+	renderScene(window);
+
+	if (profilePath)
+	{
+		profilerExportChromeTrace(profilePath);
+	}
+
+	// Every GL object of the scene is gone by now, whatever the ledger still holds leaked
+	gpuMemoryReportLeaks();
+
+	glfwDestroyWindow(window);
+
+	glfwTerminate();
+}
+
+/*
+	Everything that owns GL objects lives here, so it is destroyed while the context still exists
+*/
+static void renderScene(GLFWwindow* window)
+{
 	/*
 		A shader class created to handle all operations related to shader loading
 	*/
@@ -119,155 +202,101 @@ int main()
 	shader sh2("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\lightShader.vert", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\lightShader.frag");
 
 	/*
-		Defines the vertices for the shape to be drawn
+		The boxes of the scene, generated at compile time into read only data (primitives.h).
+		The lamp has no normals, so vertexShader.vert draws it in its flat white
 	*/
-	float vertices1[] = {
-		0.0f, 0.5f, 0.0f,   0.5f, 0.5f, 0.5f,   -1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// a 0
-		0.5f, 0.5f, 0.0f,   0.5f, 0.5f, 0.5f,    1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// b 1
-		0.5f, 0.0f, 0.0f,   0.5f, 0.5f, 0.5f,    1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// c 2 
-		0.0f, 0.0f, 0.0f,   0.5f, 0.5f, 0.5f,   -1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// d 3
-		0.0f, 0.5f, 0.5f,   0.5f, 0.5f, 0.5f,   -1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f,  1.0f,// e 4
-		0.5f, 0.5f, 0.5f,   0.5f, 0.5f, 0.5f,    1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f,  1.0f,// f 5
-		0.5f, 0.0f, 0.5f,   0.5f, 0.5f, 0.5f,    1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f,  1.0f,// g 6
-		0.0f, 0.0f, 0.5f,   0.5f, 0.5f, 0.5f,   -1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f,  1.0f // h 7
-	};
-
-	glm::vec3 rect1Centre = { 0.25f, 0.25f, 0.25f };
-
-	int indices1[] = {
-		// North
-		3,0,1, // acd
-		3,1,2, // abc
+	static constexpr primitiveVec3 lampCentre = { -0.175f, 0.675f, 0.875f };
+	static constexpr primitiveVec3 lampSize = { 0.15f, 0.15f, 0.15f };
 
-	    // South
-		6,5,4, // feh
-		6,4,7, // fhg
+	static constexpr auto box1 = primitiveCorners<sceneLayout>({ 0.25f, 0.25f, 0.25f }, { 0.5f, 0.5f, 0.5f }, { 0.5f, 0.5f, 0.5f });
+	static constexpr auto lampBox = primitiveCorners<sceneUnlitLayout>(lampCentre, lampSize, { 1.0f, 1.0f, 1.0f });
+	static constexpr auto box3 = primitiveCorners<sceneLayout>({ 0.25f, -0.15f, 0.25f }, { 1.0f, 0.3f, 1.0f }, { 0.5f, 0.0f, 0.0f });
 
-		// east
-		7,4,0, // eah
-		7,0,3, // adh
-
-		// West
-		2,1,5, // bfg
-		2,5,6, // bgc
+	/*
+		Their vertices and indices go through the geometry registry, which uploads each distinct
+		blob once: the three index tables are the same bytes, so they are one range of the
+		index arena. Everything is registered before the VAOs capture the arena buffers
+	*/
+	geometryRegistry geometry(4 << 10, 256);
 
-		// Top
-		0,4,5, // aef 
-		0,5,1, // afb
+	geometryRange vertices1 = geometry.addVertices(box1.vertices.data(), sizeof(box1.vertices), box1.stride);
+	geometryRange indices1 = geometry.addIndices(box1.indices.data(), sizeof(box1.indices));
+	geometryRange lampVertices = geometry.addVertices(lampBox.vertices.data(), sizeof(lampBox.vertices), lampBox.stride);
+	geometryRange lampIndices = geometry.addIndices(lampBox.indices.data(), sizeof(lampBox.indices));
+	geometryRange vertices3 = geometry.addVertices(box3.vertices.data(), sizeof(box3.vertices), box3.stride);
+	geometryRange indices3 = geometry.addIndices(box3.indices.data(), sizeof(box3.indices));
 
-		// Bottom
-		6,7,3, // dch ghd
-		6,3,2 // cgh gdc
+	geometryRegistryStats shared = geometry.stats();
+	std::cout << "Geometry: " << shared.blobs << " blobs for " << shared.references << " ranges, " << shared.savedBytes() << " bytes shared" << std::endl;
 
+	// Position, colour and the three normals, 3 floats each
+	auto linkBox = [&](VAO& vao, const geometryRange& vertices)
+	{
+		vao.bind();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.indexBuffer());
+		for (GLuint layout = 0; layout < 5; layout++)
+			vao.linkArray(geometry.vertexBuffer(), layout, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)(vertices.offset + layout * 3 * sizeof(float)));
+		vao.unbind();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	};
 
 	VAO vao1;
-	vao1.bind();
-
-	VBO vbo1(vertices1, sizeof(vertices1));
-	EBO ebo1(indices1, sizeof(indices1));
-	
-	//vbo1.bind();
-
-	vao1.linkArray(vbo1, 0, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)0);
-	/*vao1.linkArray(vbo1, 1, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(3 * sizeof(float)));
-	vao1.linkArray(vbo1, 2, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(6 * sizeof(float)));
-	vao1.linkArray(vbo1, 3, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(9 * sizeof(float)));
-	vao1.linkArray(vbo1, 4, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(12 * sizeof(float)));*/
-	
-	vao1.unbind();
-	vbo1.unbind();
-	ebo1.unbind();
+	linkBox(vao1, vertices1);
 
-	glm::vec3 dims = { 0.15f, 0.15f, 0.15f };
+	glm::vec3 dims = { lampSize.x, lampSize.y, lampSize.z };
 	
-	glm::vec3 lightCentre = { -0.175, 0.675f, 0.875f };
-	
-	float vertices[] = {
-			(lightCentre.x - dims.x / 2.0f), (lightCentre.y + dims.y / 2.0f), (lightCentre.z + dims.z / 2.0f),   1.0f, 1.0f, 1.0f,    0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x + dims.x / 2.0f), (lightCentre.y + dims.y / 2.0f), (lightCentre.z + dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x + dims.x / 2.0f), (lightCentre.y - dims.y / 2.0f), (lightCentre.z + dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x - dims.x / 2.0f), (lightCentre.y - dims.y / 2.0f), (lightCentre.z + dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x - dims.x / 2.0f), (lightCentre.y + dims.y / 2.0f), (lightCentre.z - dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x + dims.x / 2.0f), (lightCentre.y + dims.y / 2.0f), (lightCentre.z - dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x + dims.x / 2.0f), (lightCentre.y - dims.y / 2.0f), (lightCentre.z - dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,
-			(lightCentre.x - dims.x / 2.0f), (lightCentre.y - dims.y / 2.0f), (lightCentre.z - dims.z / 2.0f),   1.0f, 1.0f, 1.0f,	  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f
-	};
-	
-
-	int indices2[] = {
-		// North
-		3,0,1, // acd
-		3,1,2, // abc
-
-		// South
-		6,5,4, // feh
-		6,4,7, // fhg
-
-		// east
-		7,4,0, // eah
-		7,0,3, // adh
-
-		// West
-		2,1,5, // bfg
-		2,5,6, // bgc
-
-		// Top
-		0,4,5, // aef 
-		0,5,1, // afb
-
-		// Bottom
-		6,7,3, // dch ghd
-		6,3,2 // cgh gdc
-
-	};
+	glm::vec3 lightCentre = { lampCentre.x, lampCentre.y, lampCentre.z };
 
 	VAO lightVao1;
+	linkBox(lightVao1, lampVertices);
 
-	lightVao1.bind();
-	
-	VBO lightVbo1(vertices, sizeof(vertices));
-	EBO lightEbo1(indices2, sizeof(indices2));
+	VAO vao3;
+	linkBox(vao3, vertices3);
 
-	//lightVbo1.bind();
-	
-	lightVao1.linkArray(lightVbo1, 0, 3, GL_FALSE, GL_FALSE, 6 * sizeof(float), (void*)0);
-	/*lightVao1.linkArray(lightVbo1, 1, 3, GL_FALSE, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+	/*
+		The scene objects. Their vertices are already in world space, a transform carries the
+		centre the lighting is aimed with and where the lamp is, I/J/K/L move it
 	*/
-	lightVao1.unbind();
-	lightVbo1.unbind();
-	lightEbo1.unbind();
-
-	float vertices3[] = {
-		-0.25f,  0.0f,  -0.25f,   0.5f, 0.0f, 0.0f,   -1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// a 0
-		 0.75f,  0.0f,  -0.25f,   0.5f, 0.0f, 0.0f,    1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// b 1
-		 0.75f, -0.3f,  -0.25f,   0.5f, 0.0f, 0.0f,    1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// c 2 
-		-0.25f, -0.3f,  -0.25f,   0.5f, 0.0f, 0.0f,   -1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f, -1.0f,// d 3
-		-0.25f,  0.0f,   0.75f,   0.5f, 0.0f, 0.0f,   -1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f,  1.0f,// e 4
-		 0.75f,  0.0f,   0.75f,   0.5f, 0.0f, 0.0f,    1.0f, 0.0f, 0.0f,   0.0f,  1.0f, 0.0f,   0.0f, 0.0f,  1.0f,// f 5
-		 0.75f, -0.3f,   0.75f,   0.5f, 0.0f, 0.0f,    1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f,  1.0f,// g 6
-		-0.25f, -0.3f,   0.75f,   0.5f, 0.0f, 0.0f,   -1.0f, 0.0f, 0.0f,   0.0f, -1.0f, 0.0f,   0.0f, 0.0f,  1.0f // h 7
+	entityStore scene;
+
+	entity cuboid1 = scene.create();
+	scene.transforms.add(cuboid1, glm::vec3(0.25f, 0.25f, 0.25f));
+	scene.bounds.add(cuboid1, glm::vec3(-0.25f), glm::vec3(0.25f));
+	scene.meshes.add(cuboid1, vao1.ID, (GLsizei)box1.indexCount, box1.indexType, indices1.offset);
+	scene.materials.add(cuboid1, sh1.ID);
+
+	entity cuboid3 = scene.create();
+	scene.transforms.add(cuboid3, glm::vec3(0.25f, -0.15f, 0.25f));
+	scene.bounds.add(cuboid3, glm::vec3(-0.5f, -0.15f, -0.5f), glm::vec3(0.5f, 0.15f, 0.5f));
+	scene.meshes.add(cuboid3, vao3.ID, (GLsizei)box3.indexCount, box3.indexType, indices3.offset);
+	scene.materials.add(cuboid3, sh1.ID);
+
+	entity lamp = scene.create();
+	scene.transforms.add(lamp, lightCentre);
+	scene.bounds.add(lamp, -dims / 2.0f, dims / 2.0f);
+	scene.meshes.add(lamp, lightVao1.ID, (GLsizei)lampBox.indexCount, lampBox.indexType, lampIndices.offset);
+	scene.materials.add(lamp, sh1.ID, false);
+	scene.lights.add(lamp, glm::vec3(1.0f), 1.0f, 3.0f);
+
+	// Slots move when entities are removed, so they are looked up each time
+	auto position = [&](entity e) -> glm::vec3& { return scene.transforms.position[scene.transforms.slot(e)]; };
+	auto lampLight = [&]() -> bakedLight
+	{
+		uint32_t slot = scene.lights.slot(lamp);
+		return { position(lamp), scene.lights.colour[slot], scene.lights.intensity[slot], scene.lights.radius[slot] };
 	};
 
-	glm::vec3 rect2Centre = { 0.25f, -0.15f, 0.25f };
-
-	VAO vao3;
-	vao3.bind();
-
-	VBO vbo3(vertices3, sizeof(vertices3));
-	EBO ebo3(indices1, sizeof(indices1));
-
-	//vbo3.bind();
-
-	vao3.linkArray(vbo3, 0, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)0);
-	/*vao3.linkArray(vbo3, 1, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(3 * sizeof(float)));
-	vao3.linkArray(vbo3, 2, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(6 * sizeof(float)));
-	vao3.linkArray(vbo3, 3, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(9 * sizeof(float)));
-	vao3.linkArray(vbo3, 4, 3, GL_FALSE, GL_FALSE, 15 * sizeof(float), (void*)(12 * sizeof(float)));*/
-
-	vao3.unbind();
-	vbo3.unbind();
-	ebo3.unbind();
+	auto drawShadowCasters = [&]()
+	{
+		for (size_t i = 0; i < scene.meshes.size(); i++)
+		{
+			uint32_t material = scene.materials.slot(scene.meshes.owners()[i]);
+			if (material == componentPool::npos || !scene.materials.castsShadows[material])
+				continue;
+			glBindVertexArray(scene.meshes.vao[i]);
+			glDrawElements(GL_TRIANGLES, scene.meshes.indexCount[i], scene.meshes.indexType[i], (const void*)scene.meshes.indexOffset[i]);
+		}
+	};
 
 	float greenValue = 0.0;	
 	float redValue = 0.0;	
@@ -303,8 +332,267 @@ int main()
 
 	//light li(0.5f, glm::vec3(0.75f, 0.75f, 0.25f), vertices2, indices2);
 
+	/*
+		Point light shadows of the two cuboids, the cached depth is only rendered again when
+		I/J/K/L move the light
+	*/
+	shadowAtlas shadows("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\shadowDepth.vert", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\shadowDepth.frag", 2048, 256);
+	int lampShadow = shadows.addLight(pointShadow, 512);
+	glm::mat4 identity = glm::mat4(1.0f);
+
+	auto setShadowUniforms = [&](shader& sh)
+	{
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, shadows.texture());
+		glUniform1i(glGetUniformLocation(sh.ID, "shadowMap"), 0);
+		glUniform1i(glGetUniformLocation(sh.ID, "shadowsOn"), 1);
+		glUniform3fv(glGetUniformLocation(sh.ID, "shadowLight"), 1, glm::value_ptr(position(lamp)));
+		for (int face = 0; face < 6; face++)
+		{
+			glm::mat4 shadowMatrix = shadows.atlasMatrix(lampShadow, face);
+			std::string name = "shadowMatrices[" + std::to_string(face) + "]";
+			glUniformMatrix4fv(glGetUniformLocation(sh.ID, name.c_str()), 1, GL_FALSE, glm::value_ptr(shadowMatrix));
+		}
+	};
+
+	/*
+		Baked lighting, B toggles it: the cuboids are lit on the CPU into their own colour
+		stream (location 5), and only lit again when the light moves near them
+	*/
+	shader sh3("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\bakedVertex.vert", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\fragmentShader.frag");
+	lightBaker baker;
+
+	auto addBaked = [&](const float* cuboid)
+	{
+		glm::vec3 positions[8], normals[8], colours[8];
+		for (int i = 0; i < 8; i++)
+		{
+			const float* v = cuboid + i * 15;
+			positions[i] = glm::vec3(v[0], v[1], v[2]);
+			colours[i] = glm::vec3(v[3], v[4], v[5]);
+			// The three face normals of the corner
+			normals[i] = glm::vec3(v[6], v[7], v[8]) + glm::vec3(v[9], v[10], v[11]) + glm::vec3(v[12], v[13], v[14]);
+		}
+		return baker.addObject(positions, normals, colours, 8, identity);
+	};
+
+	int baked1 = addBaked(box1.vertices.data());
+	int baked3 = addBaked(box3.vertices.data());
+	int bakedLamp = baker.addLight(lampLight());
+	baker.bake();
+
+	VBO bakedVbo1((const void*)baker.colours(baked1).data(), (GLsizeiptr)(baker.colours(baked1).size() * sizeof(float)));
+	VBO bakedVbo3((const void*)baker.colours(baked3).data(), (GLsizeiptr)(baker.colours(baked3).size() * sizeof(float)));
+
+	vao1.bind();
+	vao1.linkArray(bakedVbo1, 5, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	vao3.bind();
+	vao3.linkArray(bakedVbo3, 5, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	vao3.unbind();
+
+	bool bakedMode = false;
+	bool bakeKeyDown = false;
+
+	/*
+		GPU driven path when the GL 4.3 functions loaded, G toggles it: the boxes are objects
+		of the culler, culled by a compute pass and drawn with one multi draw straight out of
+		the geometry arenas. Without them, and with baking on, the VAO / EBO draws are used
+	*/
+	gpuCuller culler("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\gpuCull.comp", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\depthPyramid.comp");
+	std::unique_ptr<shader> gpuShader;
+	VAO gpuVao;
+	if (culler.gpuDriven())
+	{
+		gpuShader.reset(new shader("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\gpuDriven.vert", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\fragmentShader.frag"));
+
+		// Every box out of the same arenas, the base vertex of a draw picks the box
+		geometryRange arena;
+		arena.offset = 0;
+		linkBox(gpuVao, arena);
+		gpuVao.bind();
+		culler.linkObjectAttribute(5);
+		gpuVao.unbind();
+
+		// The vertices are in world space already, so the model is the identity and the
+		// bounds are the world box around each transform
+		auto addCulled = [&](entity e, const geometryRange& vertices, const geometryRange& indices)
+		{
+			uint32_t slot = scene.meshes.slot(e);
+			uint32_t bounds = scene.bounds.slot(e);
+			uint32_t mesh = culler.addMesh((GLuint)scene.meshes.indexCount[slot], (GLuint)(indices.offset / EBO::typeSize(box1.indexType)), (GLint)(vertices.offset / box1.stride));
+			culler.addObject(mesh, identity, position(e) + scene.bounds.localMin[bounds], position(e) + scene.bounds.localMax[bounds]);
+		};
+		addCulled(cuboid1, vertices1, indices1);
+		addCulled(cuboid3, vertices3, indices3);
+		addCulled(lamp, lampVertices, lampIndices);
+	}
+	bool gpuDrivenOn = culler.gpuDriven();
+	bool gpuKeyDown = false;
+
+	/*
+		Vertex pulling, P toggles it: the same boxes in the puller's shared buffers, all
+		drawn through its one VAO by pulledVertex.vert. The texture buffer takes unit 1,
+		the shadow map has unit 0
+	*/
+	shader pulledShader("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\pulledVertex.vert", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\fragmentShader.frag");
+	vertexPuller puller(4 << 10, 1 << 10);
+	puller.textureUnit = 1;
+
+	// Position, colour and the three face normals of every corner
+	const pulledFormat boxFormat = { sceneLayout::floats, sceneLayout::position, 6, -1, sceneLayout::colour, 3 };
+	auto addPulled = [&](const auto& box)
+	{
+		std::vector<uint32_t> boxIndices(box.indices.begin(), box.indices.end());
+		return puller.add(box.vertices.data(), box.vertexCount, boxFormat, boxIndices.data(), boxIndices.size());
+	};
+	pulledMesh pulledBoxes[3] = { addPulled(box1), addPulled(box3), addPulled(lampBox) };
+	bool pullingOn = false;
+	bool pullKeyDown = false;
+
+	/*
+		Deferred shading of the entity store, F toggles it: the meshes fill the G-buffer, the
+		store's lights are lit as volumes, and the lights themselves are drawn forward on top
+		against the scene depth end() copies over. deferredGeometry.vert takes one normal at
+		location 2, the corner's three face normals summed like the baker does
+	*/
+	deferredRenderer deferred("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\", 800, 600);
+
+	auto cornerNormals = [](const auto& box)
+	{
+		std::vector<float> normals;
+		for (size_t i = 0; i < box.vertexCount; i++)
+		{
+			const float* v = box.vertices.data() + i * 15;
+			for (int axis = 0; axis < 3; axis++)
+				normals.push_back(v[6 + axis] + v[9 + axis] + v[12 + axis]);
+		}
+		return normals;
+	};
+	std::vector<float> normals1 = cornerNormals(box1);
+	std::vector<float> normals3 = cornerNormals(box3);
+	VBO deferredNormals1((const void*)normals1.data(), (GLsizeiptr)(normals1.size() * sizeof(float)));
+	VBO deferredNormals3((const void*)normals3.data(), (GLsizeiptr)(normals3.size() * sizeof(float)));
+
+	// Position and colour out of the arena, the normal from its own buffer
+	auto linkDeferred = [&](VAO& vao, const geometryRange& vertices, VBO& normals)
+	{
+		vao.bind();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.indexBuffer());
+		for (GLuint layout = 0; layout < 2; layout++)
+			vao.linkArray(geometry.vertexBuffer(), layout, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)(vertices.offset + layout * 3 * sizeof(float)));
+		vao.linkArray(normals, 2, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+		vao.unbind();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	};
+
+	VAO deferredVao1;
+	linkDeferred(deferredVao1, vertices1, deferredNormals1);
+	VAO deferredVao3;
+	linkDeferred(deferredVao3, vertices3, deferredNormals3);
+
+	bool deferredOn = false;
+	bool deferredKeyDown = false;
+
+	/*
+		The scene is drawn at a scale of the window that keeps the GPU time under budget,
+		the title shows the scale once a second
+	*/
+	dynamicResolution resolution(800, 600);
+	float titleTime = glfwGetTime();
+
+	/*
+		Frame times, GL counters and GPU memory drawn over the frame, H toggles it
+	*/
+	perfHud hud("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\");
+	bool hudKeyDown = false;
+
+	/*
+		What goes into the window each frame: the upscale of the scene, then the HUD on top.
+		The size callback marks the graph, and the passes get the new window size on the
+		next execute
+	*/
+	int graphWidth, graphHeight;
+	glfwGetFramebufferSize(window, &graphWidth, &graphHeight);
+	renderGraph frameGraph(graphWidth, graphHeight);
+	windowGraph = &frameGraph;
+
+	int screen = frameGraph.importFramebuffer("window", 0);
+	int upscalePass = frameGraph.addPass("upscale", [&](const renderPassContext&)
+	{
+		PROFILE_GPU_SCOPE("upscale");
+		resolution.end();
+	});
+	frameGraph.write(upscalePass, screen);
+
+	int hudPass = frameGraph.addPass("hud", [&](const renderPassContext& pass)
+	{
+		PROFILE_GPU_SCOPE("hud");
+		hud.draw(pass.width, pass.height);
+	});
+	frameGraph.read(hudPass, screen);
+	frameGraph.write(hudPass, screen);
+
+	/*
+		Voxel terrain under the cuboids, V toggles it. Edited chunks are meshed on the jobs
+		and the whole terrain is one draw
+	*/
+	shader voxelShader("D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\voxel.vert", "D:\\VS_Codes\\openGL_learning\\openGL_learning\\src\\shaders\\fragmentShader.frag");
+	voxelWorld terrain(glm::ivec3(4, 1, 4));
+	terrain.voxelSize = 0.02f;
+	terrain.origin = glm::vec3(-1.03f, -0.75f, -1.03f);
+	terrain.setColour(1, glm::vec3(0.45f, 0.42f, 0.4f));
+	terrain.setColour(2, glm::vec3(0.3f, 0.6f, 0.25f));
+	for (int z = 0; z < terrain.size().z; z++)
+	{
+		for (int x = 0; x < terrain.size().x; x++)
+		{
+			int height = 12 + (int)(4.0f * std::sin(x * 0.09f) * std::cos(z * 0.07f));
+			terrain.fill(glm::ivec3(x, 0, z), glm::ivec3(x, height - 2, z), 1);
+			terrain.fill(glm::ivec3(x, height - 1, z), glm::ivec3(x, height, z), 2);
+		}
+	}
+	bool voxelsOn = false;
+	bool voxelKeyDown = false;
+
+	/*
+		Frames are only drawn when something changed: input, a resize, terrain meshes coming
+		back from the jobs. The terrain only damages the part of the window its chunks cover,
+		and only that part of the resolution target is drawn again. O toggles it off
+	*/
+	redrawScheduler redraw(window);
+	bool redrawKeyDown = false;
+	int drawnWidth = 0;
+	int drawnHeight = 0;
+
 	while (!glfwWindowShouldClose(window))
 	{
+		redraw.wait();
+
+		int windowWidth, windowHeight;
+		glfwGetFramebufferSize(window, &windowWidth, &windowHeight);
+
+		if (voxelsOn)
+		{
+			terrain.update();
+			glm::mat4 viewProjection = cam.viewProjection(fov, nearPlane, farPlane);
+			for (const glm::ivec3& chunk : terrain.uploadedChunks())
+			{
+				glm::vec3 chunkMin, chunkMax;
+				terrain.chunkBounds(chunk, chunkMin, chunkMax);
+				redrawRect rect;
+				if (redrawProjectBox(chunkMin, chunkMax, viewProjection, windowWidth, windowHeight, rect))
+					redraw.invalidate(rect);
+				else
+					redraw.invalidate();
+			}
+		}
+
+		if (!redraw.due())
+			continue;
+
+		PROFILE_SCOPE("frame");
+		double frameStart = glfwGetTime();
+
 		// *** Input ***
 		
 		// *** Remdering Commands ***
@@ -363,6 +651,54 @@ int main()
 		/*
 			Sets the rendering mode and the default color of the viewport
 		*/
+		// The lamp moves before its shadow is placed, or the shadow trails a frame behind
+		glm::vec3& lampCentre = position(lamp);
+		if (glfwGetKey(window, GLFW_KEY_I) == GLFW_PRESS)
+			lampCentre.y += 0.05f;
+		if (glfwGetKey(window, GLFW_KEY_J) == GLFW_PRESS)
+			lampCentre.x -= 0.05f;
+		if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS)
+			lampCentre.x += 0.05f;
+		if (glfwGetKey(window, GLFW_KEY_K) == GLFW_PRESS)
+			lampCentre.y -= 0.05f;
+
+		shadows.setPoint(lampShadow, lampCentre, 5.0f);
+		{
+			PROFILE_GPU_SCOPE("shadows");
+			shadows.update([&](const glm::mat4&, bool dynamicCasters)
+			{
+				// Everything in this scene is static
+				if (dynamicCasters)
+					return;
+
+				glUniformMatrix4fv(glGetUniformLocation(shadows.depthShader().ID, "model"), 1, GL_FALSE, glm::value_ptr(identity));
+				drawShadowCasters();
+			});
+		}
+
+		resolution.resize(windowWidth, windowHeight);
+		resolution.begin();
+
+		// The rest of the target still holds the last frame unless its size changed, the
+		// upscale in resolution.end() covers the whole window either way
+		if (!redraw.fullFrame() && resolution.renderWidth() == drawnWidth && resolution.renderHeight() == drawnHeight)
+		{
+			redrawRect damage = redraw.damageBounds();
+			float scaleX = (float)resolution.renderWidth() / windowWidth;
+			float scaleY = (float)resolution.renderHeight() / windowHeight;
+			int x0 = (int)std::floor(damage.x * scaleX);
+			int y0 = (int)std::floor(damage.y * scaleY);
+			int x1 = (int)std::ceil((damage.x + damage.width) * scaleX);
+			int y1 = (int)std::ceil((damage.y + damage.height) * scaleY);
+			glEnable(GL_SCISSOR_TEST);
+			glScissor(x0, y0, x1 - x0, y1 - y0);
+		}
+		drawnWidth = resolution.renderWidth();
+		drawnHeight = resolution.renderHeight();
+
+		// The uniforms below go to the current program
+		sh1.use();
+
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -401,16 +737,7 @@ int main()
 		
 		glUniform1f(intensityLocation, intensity);
 
-		if (glfwGetKey(window, GLFW_KEY_I) == GLFW_PRESS)
-			lightCentre.y += 0.05f;
-		if (glfwGetKey(window, GLFW_KEY_J) == GLFW_PRESS)
-			lightCentre.x -= 0.05f;
-		if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS)
-			lightCentre.x += 0.05f;
-		if (glfwGetKey(window, GLFW_KEY_K) == GLFW_PRESS)
-			lightCentre.y -= 0.05f;
-		
-		direction = rect1Centre - lightCentre;
+		direction = position(cuboid1) - lampCentre;
 		glUniform3fv(directionLocation, 1, glm::value_ptr(direction));
 
 		//direction = rect2Centre - lightCentre;
@@ -420,6 +747,63 @@ int main()
 		glUniform3fv(glGetUniformLocation(sh1.ID, "centre2"), 1, glm::value_ptr(rect2Centre));*/
 
 		sh1.use();
+		setShadowUniforms(sh1);
+
+		if (glfwGetKey(window, GLFW_KEY_V) == GLFW_PRESS && !voxelKeyDown)
+			voxelsOn = !voxelsOn;
+		voxelKeyDown = glfwGetKey(window, GLFW_KEY_V) == GLFW_PRESS;
+
+		if (glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS && !bakeKeyDown)
+			bakedMode = !bakedMode;
+		bakeKeyDown = glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS;
+
+		// Each path replaces the VAO / EBO draws, so turning one on turns the others off
+		if (glfwGetKey(window, GLFW_KEY_G) == GLFW_PRESS && !gpuKeyDown && culler.gpuDriven())
+		{
+			gpuDrivenOn = !gpuDrivenOn;
+			pullingOn = false;
+			deferredOn = false;
+		}
+		gpuKeyDown = glfwGetKey(window, GLFW_KEY_G) == GLFW_PRESS;
+
+		if (glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS && !pullKeyDown)
+		{
+			pullingOn = !pullingOn;
+			gpuDrivenOn = false;
+			deferredOn = false;
+		}
+		pullKeyDown = glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS;
+
+		if (glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS && !deferredKeyDown)
+		{
+			deferredOn = !deferredOn;
+			gpuDrivenOn = false;
+			pullingOn = false;
+		}
+		deferredKeyDown = glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS;
+
+		if (glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS && !redrawKeyDown)
+			redraw.onDemand = !redraw.onDemand;
+		redrawKeyDown = glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS;
+
+		if (bakedMode)
+		{
+			baker.setLight(bakedLamp, lampLight());
+			if (baker.bake())
+			{
+				for (int object : baker.changed())
+				{
+					VBO& bakedVbo = object == baked1 ? bakedVbo1 : bakedVbo3;
+					bakedVbo.bind();
+					glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr)(baker.colours(object).size() * sizeof(float)), baker.colours(object).data());
+					bakedVbo.unbind();
+				}
+			}
+
+			sh3.use();
+			cam.matrix(fov, nearPlane, farPlane, sh3, "proview");
+			setShadowUniforms(sh3);
+		}
 
 		/*for (int i = 0; i <= 36; i += 3)
 		{
@@ -431,31 +815,157 @@ int main()
 			li.lightup((glm::dot(normal, li.orientation)) / (glm::length(normal) * glm::length(li.orientation)));
 		}*/
 
-		vao1.bind();
-		glDrawElements(GL_TRIANGLES, sizeof(indices1), GL_UNSIGNED_INT, 0);
+		{
+			PROFILE_GPU_SCOPE("scene");
+
+			if (gpuDrivenOn && !bakedMode)
+			{
+				// The compute pass leaves its own program bound
+				culler.cull(cam.viewProjection(fov, nearPlane, farPlane), cam.position);
+
+				gpuShader->use();
+				cam.matrix(fov, nearPlane, farPlane, *gpuShader, "proview");
+				glUniform3fv(glGetUniformLocation(gpuShader->ID, "direction"), 1, glm::value_ptr(direction));
+				glUniform1f(glGetUniformLocation(gpuShader->ID, "intensity"), intensity);
+				setShadowUniforms(*gpuShader);
+
+				gpuVao.bind();
+				culler.draw(box1.indexType);
+				gpuVao.unbind();
+			}
+			else if (pullingOn && !bakedMode)
+			{
+				puller.begin(pulledShader);
+				cam.matrix(fov, nearPlane, farPlane, pulledShader, "proview");
+				glUniformMatrix4fv(glGetUniformLocation(pulledShader.ID, "model"), 1, GL_FALSE, glm::value_ptr(identity));
+				glUniform3fv(glGetUniformLocation(pulledShader.ID, "direction"), 1, glm::value_ptr(direction));
+				glUniform1f(glGetUniformLocation(pulledShader.ID, "intensity"), intensity);
+				setShadowUniforms(pulledShader);
+
+				for (const pulledMesh& box : pulledBoxes)
+					puller.draw(box);
+				puller.end();
+			}
+			else if (deferredOn && !bakedMode)
+			{
+				std::vector<pointLight> lights;
+				for (size_t i = 0; i < scene.lights.size(); i++)
+				{
+					entity e = scene.lights.owners()[i];
+					lights.push_back({ position(e), scene.lights.radius[i], scene.lights.colour[i], scene.lights.intensity[i] });
+				}
+				deferred.setLights(lights);
+
+				// Same size and lower left corner as the resolution target's scaled frame
+				deferred.resize(resolution.renderWidth(), resolution.renderHeight());
+				deferred.outputFramebuffer = resolution.targetFramebuffer();
+				// The camera only hands out view x projection, which is the view under an identity projection
+				deferred.begin(cam.viewProjection(fov, nearPlane, farPlane), identity);
+				glUniformMatrix4fv(glGetUniformLocation(deferred.geometryShader().ID, "model"), 1, GL_FALSE, glm::value_ptr(identity));
+				for (size_t i = 0; i < scene.meshes.size(); i++)
+				{
+					entity e = scene.meshes.owners()[i];
+					if (scene.lights.has(e))
+						continue;
+					glBindVertexArray(e == cuboid1 ? deferredVao1.ID : deferredVao3.ID);
+					glDrawElements(GL_TRIANGLES, scene.meshes.indexCount[i], scene.meshes.indexType[i], (const void*)scene.meshes.indexOffset[i]);
+				}
+				deferred.end();
+
+				// The lights in their flat colour, depth tested against the deferred scene. The
+				// G-buffer took unit 0 from the shadow map
+				sh1.use();
+				setShadowUniforms(sh1);
+				for (size_t i = 0; i < scene.meshes.size(); i++)
+				{
+					if (!scene.lights.has(scene.meshes.owners()[i]))
+						continue;
+					glBindVertexArray(scene.meshes.vao[i]);
+					glDrawElements(GL_TRIANGLES, scene.meshes.indexCount[i], scene.meshes.indexType[i], (const void*)scene.meshes.indexOffset[i]);
+				}
+			}
+			else
+			{
+				// With baking on the lit objects are drawn by sh3, lights have no baked colours
+				GLuint bound = bakedMode ? sh3.ID : sh1.ID;
+				for (size_t i = 0; i < scene.meshes.size(); i++)
+				{
+					entity e = scene.meshes.owners()[i];
+					uint32_t material = scene.materials.slot(e);
+					GLuint program = material != componentPool::npos ? scene.materials.program[material] : sh1.ID;
+					if (bakedMode && program == sh1.ID && !scene.lights.has(e))
+						program = sh3.ID;
+					if (program != bound)
+					{
+						glUseProgram(program);
+						bound = program;
+					}
+
+					glBindVertexArray(scene.meshes.vao[i]);
+					glDrawElements(GL_TRIANGLES, scene.meshes.indexCount[i], scene.meshes.indexType[i], (const void*)scene.meshes.indexOffset[i]);
+				}
+			}
+
+			if (voxelsOn)
+			{
+				voxelShader.use();
+				cam.matrix(fov, nearPlane, farPlane, voxelShader, "proview");
+				glUniform3fv(glGetUniformLocation(voxelShader.ID, "direction"), 1, glm::value_ptr(direction));
+				glUniform1f(glGetUniformLocation(voxelShader.ID, "intensity"), intensity);
+				setShadowUniforms(voxelShader);
+				terrain.draw(voxelShader);
+			}
+		}
 
-		vao3.bind();
-		glDrawElements(GL_TRIANGLES, sizeof(indices1), GL_UNSIGNED_INT, 0);
+		glDisable(GL_SCISSOR_TEST);
 
-		//sh2.use();
+		// CPU time up to here, the wait in glfwSwapBuffers is not part of it
+		hud.addCpuTime((float)((glfwGetTime() - frameStart) * 1000.0));
+		for (float gpuMs : resolution.arrivedGpuTimes())
+			hud.addGpuTime(gpuMs);
 
-		lightVao1.bind();
-		glDrawElements(GL_TRIANGLES, sizeof(indices2), GL_UNSIGNED_INT, 0);
+		if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS && !hudKeyDown)
+			hud.visible = !hud.visible;
+		hudKeyDown = glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS;
 
+		frameGraph.execute();
+
+		if (currTime - titleTime >= 1.0f)
+		{
+			const resolutionFrame& frame = resolution.history().back();
+			std::string title = "yo - " + std::to_string(frame.width) + "x" + std::to_string(frame.height) + " (" + std::to_string((int)(frame.scale * 100.0f + 0.5f)) + "%)";
+#ifdef OGL_GL_INSTRUMENT
+			const glFrameCounters& calls = glInstrumentLastFrame();
+			title += " - " + std::to_string(calls.calls) + " GL calls, " + std::to_string(calls.draws) + " draws, " + std::to_string(calls.uploadBytes) + " bytes uploaded";
+#endif
+			glfwSetWindowTitle(window, title.c_str());
+			titleTime = currTime;
+		}
 
 		// *** Events and swap buffers ***
-		glfwPollEvents();
+		// The events were taken by redraw.wait() at the top
 		glfwSwapBuffers(window);
+		redraw.drawn();
+		glInstrumentEndFrame();
+		glTraceEndFrame();
+		profilerEndFrame();
 		
 	}
 
-	vao1.del();
-	vbo1.del();
-	ebo1.del();
-
-	glfwDestroyWindow(window);
-
-	glfwTerminate();
+	shadows.del();
+	culler.del();
+	puller.del();
+	deferred.del();
+	windowGraph = nullptr;
+	frameGraph.del();
+	deferredVao1.del();
+	deferredVao3.del();
+	deferredNormals1.del();
+	deferredNormals3.del();
+	resolution.del();
+	hud.del();
+	terrain.del();
+	geometry.del();
 
 	//glfwSet
 
@@ -8,25 +8,45 @@ VAO::VAO()
 	glGenVertexArrays(1, &ID);
 }
 
+VAO::~VAO()
+{
+	del();
+}
+
+VAO::VAO(VAO&& other) noexcept
+{
+	ID = other.ID;
+	other.ID = 0;
+}
+
+VAO& VAO::operator=(VAO&& other) noexcept
+{
+	if (this != &other)
+	{
+		del();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
+}
+
 // Links the data to shader, such as position, colour, etc.
-void VAO::linkArray(VBO vbo, GLuint layout, GLint size, GLenum type, GLboolean normalize, GLsizeiptr stride, const void* pointerOffset)
+void VAO::linkArray(VBO& vbo, GLuint layout, GLint size, GLenum type, GLboolean normalize, GLsizeiptr stride, const void* pointerOffset)
 {
-	//glVertexAttribPointer(layout, size, type, normalize, stride, pointerOffset); // position
-	//glEnableVertexAttribArray(layout);
 	vbo.bind();
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)(3 * sizeof(float)));
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)(6 * sizeof(float)));
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)(9 * sizeof(float)));
-	glEnableVertexAttribArray(3);
-	glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, 15 * sizeof(float), (void*)(12 * sizeof(float)));
-	glEnableVertexAttribArray(4);
+	glVertexAttribPointer(layout, size, type, normalize, (GLsizei)stride, pointerOffset);
+	glEnableVertexAttribArray(layout);
 	vbo.unbind();
 }
 
+void VAO::linkArray(GLuint buffer, GLuint layout, GLint size, GLenum type, GLboolean normalize, GLsizeiptr stride, const void* pointerOffset)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glVertexAttribPointer(layout, size, type, normalize, (GLsizei)stride, pointerOffset);
+	glEnableVertexAttribArray(layout);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 // Binds VAO
 void VAO::bind()
 {
@@ -42,5 +62,9 @@ void VAO::unbind()
 // Deletes VAO
 void VAO::del()
 {
+	if (ID == 0)
+		return;
+
 	glDeleteVertexArrays(1, &ID);
+	ID = 0;
 }
\ No newline at end of file
@@ -7,17 +7,28 @@
 
 #include "VBO.h"
 
+// Owns the vertex array: deleted with the object, moved but never copied
 class VAO
 {
 public:
-	GLuint ID;
+	GLuint ID = 0;
 
 	public:
 
 		VAO();
-		void linkArray(VBO vbo, GLuint layout, GLint size, GLenum type, GLboolean normalize, GLsizeiptr stride, const void* pointerOffset);
+		~VAO();
+
+		VAO(VAO&& other) noexcept;
+		VAO& operator=(VAO&& other) noexcept;
+		VAO(const VAO&) = delete;
+		VAO& operator=(const VAO&) = delete;
+
+		void linkArray(VBO& vbo, GLuint layout, GLint size, GLenum type, GLboolean normalize, GLsizeiptr stride, const void* pointerOffset);
+		// The same for a buffer the VAO does not own, e.g. a range of a bufferArena
+		void linkArray(GLuint buffer, GLuint layout, GLint size, GLenum type, GLboolean normalize, GLsizeiptr stride, const void* pointerOffset);
 		void bind();
 		void unbind();
+		// Deletes the vertex array now instead of in the destructor
 		void del();
 };
 
@@ -2,11 +2,45 @@
 
 #include <iostream>
 
+#include "gpuMemory.h"
+
 VBO::VBO(GLfloat* vertices, int size)
 {
 	glGenBuffers(1, &ID);
 	glBindBuffer(GL_ARRAY_BUFFER, ID);
 	glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);  // BUFFER DATA takes a pointer to the actual data, so you pass the vertices as it is... NOT the pointer's reference
+	gpuMemoryAllocate(gpuMemoryVertex, GL_BUFFER, ID, (size_t)size, "VBO");
+}
+
+// Raw bytes, e.g. a vertex blob mapped straight from a mesh file
+VBO::VBO(const void* data, GLsizeiptr size)
+{
+	glGenBuffers(1, &ID);
+	glBindBuffer(GL_ARRAY_BUFFER, ID);
+	glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+	gpuMemoryAllocate(gpuMemoryVertex, GL_BUFFER, ID, (size_t)size, "VBO");
+}
+
+VBO::~VBO()
+{
+	del();
+}
+
+VBO::VBO(VBO&& other) noexcept
+{
+	ID = other.ID;
+	other.ID = 0;
+}
+
+VBO& VBO::operator=(VBO&& other) noexcept
+{
+	if (this != &other)
+	{
+		del();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
 }
 
 void VBO::bind()
@@ -21,5 +55,10 @@ void VBO::unbind()
 
 void VBO::del()
 {
-	glDeleteVertexArrays(1, &ID);
-}
\ No newline at end of file
+	if (ID == 0)
+		return;
+
+	gpuMemoryRelease(GL_BUFFER, ID);
+	glDeleteBuffers(1, &ID);
+	ID = 0;
+}
@@ -5,15 +5,29 @@
 
 #include <glad/glad.h>
 
+/*
+	Vertex buffer. Owns the GL buffer: it is deleted with the object, moved but never copied,
+	and its size is in the GPU memory ledger (gpuMemory.h) as vertex memory.
+*/
+
 class VBO
 {
 	public:
 		
-		GLuint ID;
+		GLuint ID = 0;
 	
 		VBO(GLfloat* vertices, int size);
+		VBO(const void* data, GLsizeiptr size);
+		~VBO();
+
+		VBO(VBO&& other) noexcept;
+		VBO& operator=(VBO&& other) noexcept;
+		VBO(const VBO&) = delete;
+		VBO& operator=(const VBO&) = delete;
+
 		void bind();
 		void unbind();
+		// Deletes the buffer now instead of in the destructor
 		void del();
 };
 
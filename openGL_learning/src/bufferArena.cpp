@@ -0,0 +1,164 @@
+#include "bufferArena.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "gpuMemory.h"
+
+bufferArena::bufferArena(GLenum target, GLsizeiptr initialSize, GLenum usage)
+	: bindTarget(target), usage(usage)
+{
+	size = std::max(initialSize, (GLsizeiptr)256);
+
+	// Everything goes through the copy targets, binding an element buffer here would
+	// change whatever VAO happens to be bound
+	glGenBuffers(1, &ID);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, ID);
+	glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, usage);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	gpuMemoryAllocate(gpuMemoryBufferCategory(target), GL_BUFFER, ID, (size_t)size, "bufferArena");
+
+	freeRanges[0] = size;
+}
+
+GLintptr bufferArena::allocate(GLsizeiptr bytes, GLsizeiptr alignment)
+{
+	bytes = std::max(bytes, (GLsizeiptr)1);
+	alignment = std::max(alignment, (GLsizeiptr)1);
+
+	for (int attempt = 0; attempt < 2; attempt++)
+	{
+		for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it)
+		{
+			GLintptr start = (it->first + alignment - 1) / alignment * alignment;
+			GLintptr end = it->first + it->second;
+			if (start + bytes > end)
+				continue;
+
+			// Whatever is left in front of and behind the allocation stays free
+			GLintptr rangeStart = it->first;
+			freeRanges.erase(it);
+			if (start > rangeStart)
+				freeRanges[rangeStart] = start - rangeStart;
+			if (start + bytes < end)
+				freeRanges[start + bytes] = end - (start + bytes);
+
+			allocations[start] = bytes;
+			usedBytes += bytes;
+			peakBytes = std::max(peakBytes, usedBytes);
+			return start;
+		}
+
+		grow(size + bytes + alignment);
+	}
+
+	std::cout << "ERROR::BUFFER_ARENA::OUT_OF_MEMORY" << std::endl;
+	return -1;
+}
+
+void bufferArena::release(GLintptr offset)
+{
+	auto it = allocations.find(offset);
+	if (it == allocations.end())
+	{
+		std::cout << "ERROR::BUFFER_ARENA::UNKNOWN_RANGE" << std::endl;
+		return;
+	}
+
+	usedBytes -= it->second;
+	addFree(it->first, it->second);
+	allocations.erase(it);
+}
+
+void bufferArena::addFree(GLintptr offset, GLsizeiptr bytes)
+{
+	auto next = freeRanges.lower_bound(offset);
+
+	if (next != freeRanges.begin())
+	{
+		auto previous = std::prev(next);
+		if (previous->first + previous->second == offset)
+		{
+			offset = previous->first;
+			bytes += previous->second;
+			freeRanges.erase(previous);
+		}
+	}
+
+	if (next != freeRanges.end() && offset + bytes == next->first)
+	{
+		bytes += next->second;
+		freeRanges.erase(next);
+	}
+
+	freeRanges[offset] = bytes;
+}
+
+void bufferArena::upload(GLintptr offset, const void* data, GLsizeiptr bytes)
+{
+	glBindBuffer(GL_COPY_WRITE_BUFFER, ID);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, offset, bytes, data);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+void bufferArena::grow(GLsizeiptr minimumSize)
+{
+	GLsizeiptr newSize = std::max(size * 2, minimumSize);
+
+	GLuint newID;
+	glGenBuffers(1, &newID);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, newID);
+	glBufferData(GL_COPY_WRITE_BUFFER, newSize, nullptr, usage);
+	glBindBuffer(GL_COPY_READ_BUFFER, ID);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, size);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	gpuMemoryRelease(GL_BUFFER, ID);
+	glDeleteBuffers(1, &ID);
+	gpuMemoryAllocate(gpuMemoryBufferCategory(bindTarget), GL_BUFFER, newID, (size_t)newSize, "bufferArena");
+
+	ID = newID;
+	addFree(size, newSize - size);
+	size = newSize;
+	grown++;
+}
+
+GLuint bufferArena::buffer() const
+{
+	return ID;
+}
+
+GLenum bufferArena::target() const
+{
+	return bindTarget;
+}
+
+unsigned bufferArena::generation() const
+{
+	return grown;
+}
+
+GLsizeiptr bufferArena::capacity() const
+{
+	return size;
+}
+
+GLsizeiptr bufferArena::used() const
+{
+	return usedBytes;
+}
+
+GLsizeiptr bufferArena::peak() const
+{
+	return peakBytes;
+}
+
+void bufferArena::del()
+{
+	gpuMemoryRelease(GL_BUFFER, ID);
+	glDeleteBuffers(1, &ID);
+	ID = 0;
+	freeRanges.clear();
+	allocations.clear();
+	usedBytes = 0;
+}
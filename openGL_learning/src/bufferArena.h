@@ -0,0 +1,65 @@
+#pragma once
+
+#ifndef BUFFER_ARENA_CLASS
+#define BUFFER_ARENA_CLASS
+
+#include <glad/glad.h>
+
+#include <map>
+
+/*
+	One big GL buffer handed out in ranges, so many meshes share a buffer and a binding
+	instead of owning one each.
+
+		bufferArena arena(GL_ARRAY_BUFFER, 16 << 20);
+		GLintptr offset = arena.allocate(bytes, alignment);
+		arena.upload(offset, data, bytes);
+		...
+		arena.release(offset);
+
+	Free space is kept as a list of ranges sorted by offset, first fit, and neighbours are
+	merged when a range is released. When nothing fits the buffer is replaced by one twice
+	the size and the old contents are copied over on the GPU, which changes buffer(), so
+	anything that captured the name (a VAO, a texture buffer) checks generation().
+*/
+
+class bufferArena
+{
+	public:
+		bufferArena(GLenum target, GLsizeiptr initialSize, GLenum usage = GL_DYNAMIC_DRAW);
+
+		// Returns the offset of size bytes, a multiple of alignment
+		GLintptr allocate(GLsizeiptr size, GLsizeiptr alignment = 4);
+		void release(GLintptr offset);
+		void upload(GLintptr offset, const void* data, GLsizeiptr size);
+
+		GLuint buffer() const;
+		// What the ranges are for, e.g. GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER
+		GLenum target() const;
+		// Goes up every time the buffer is replaced by a bigger one
+		unsigned generation() const;
+
+		GLsizeiptr capacity() const;
+		GLsizeiptr used() const;
+		GLsizeiptr peak() const;
+
+		void del();
+
+	private:
+		GLuint ID = 0;
+		GLenum bindTarget;
+		GLenum usage;
+		GLsizeiptr size = 0;
+		GLsizeiptr usedBytes = 0;
+		GLsizeiptr peakBytes = 0;
+		unsigned grown = 0;
+
+		// offset -> size
+		std::map<GLintptr, GLsizeiptr> freeRanges;
+		std::map<GLintptr, GLsizeiptr> allocations;
+
+		void grow(GLsizeiptr minimumSize);
+		void addFree(GLintptr offset, GLsizeiptr bytes);
+};
+
+#endif
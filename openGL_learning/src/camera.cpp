@@ -12,6 +12,11 @@ camera::camera(int width, int height, glm::vec3 position)
 }
 
 void camera::matrix(float fov, float nearPlane, float farPlane, shader& shader, const char* uniform)
+{
+	glUniformMatrix4fv(glGetUniformLocation(shader.ID, uniform), 1, GL_FALSE, glm::value_ptr(viewProjection(fov, nearPlane, farPlane)));
+}
+
+glm::mat4 camera::viewProjection(float fov, float nearPlane, float farPlane) const
 {
 	glm::mat4 view = glm::mat4(1.0f);
 	glm::mat4 projection = glm::mat4(1.0f);
@@ -22,7 +27,7 @@ void camera::matrix(float fov, float nearPlane, float farPlane, shader& shader,
 	// using perspective projection matrix to transform into screen coordinates
 	projection = glm::perspective(glm::radians(fov), (float)(width / height), nearPlane, farPlane); 
 
-	glUniformMatrix4fv(glGetUniformLocation(shader.ID, uniform), 1, GL_FALSE, glm::value_ptr(projection * view));
+	return projection * view;
 }
 
 void camera::inputs(GLFWwindow* window)
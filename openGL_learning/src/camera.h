@@ -28,6 +28,8 @@ class camera
 		camera(int width, int height, glm::vec3 position);
 
 		void matrix(float fov, float nearPlane, float farPlane, shader& shader, const char* uniform);
+		// What matrix() sets the uniform to
+		glm::mat4 viewProjection(float fov, float nearPlane, float farPlane) const;
 
 		void inputs(GLFWwindow* window);
 };
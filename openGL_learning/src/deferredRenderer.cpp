@@ -0,0 +1,357 @@
+#include "deferredRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <gtc/type_ptr.hpp>
+
+#include "gpuMemory.h"
+#include "profiler.h"
+
+deferredRenderer::deferredRenderer(const std::string& shaderDirectory, int width, int height)
+	: gbufferProgram((shaderDirectory + "deferredGeometry.vert").c_str(), (shaderDirectory + "deferredGeometry.frag").c_str()),
+	forwardProgram((shaderDirectory + "deferredGeometry.vert").c_str(), (shaderDirectory + "forwardLights.frag").c_str()),
+	ambientProgram((shaderDirectory + "deferredAmbient.vert").c_str(), (shaderDirectory + "deferredAmbient.frag").c_str()),
+	lightProgram((shaderDirectory + "deferredLight.vert").c_str(), (shaderDirectory + "deferredLight.frag").c_str())
+{
+	glGenVertexArrays(1, &emptyVao);
+	createVolume();
+	resize(width, height);
+}
+
+// Icosahedron around the unit sphere, its faces are 0.795 from the centre
+void deferredRenderer::createVolume()
+{
+	const float t = (1.0f + std::sqrt(5.0f)) * 0.5f;
+	const float s = 1.0f / 0.7947f / std::sqrt(1.0f + t * t);
+	float vertices[] = {
+		-1, t, 0,   1, t, 0,   -1, -t, 0,   1, -t, 0,
+		0, -1, t,   0, 1, t,   0, -1, -t,   0, 1, -t,
+		t, 0, -1,   t, 0, 1,   -t, 0, -1,   -t, 0, 1,
+	};
+	for (float& v : vertices)
+		v *= s;
+
+	GLubyte indices[] = {
+		0, 11, 5,   0, 5, 1,    0, 1, 7,    0, 7, 10,   0, 10, 11,
+		1, 5, 9,    5, 11, 4,   11, 10, 2,  10, 7, 6,   7, 1, 8,
+		3, 9, 4,    3, 4, 2,    3, 2, 6,    3, 6, 8,    3, 8, 9,
+		4, 9, 5,    2, 4, 11,   6, 2, 10,   8, 6, 7,    9, 8, 1,
+	};
+
+	glGenVertexArrays(1, &volumeVao);
+	glGenBuffers(1, &volumeVertices);
+	glGenBuffers(1, &volumeIndices);
+	glGenBuffers(1, &instanceBuffer);
+
+	glBindVertexArray(volumeVao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, volumeVertices);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	gpuMemoryAllocate(gpuMemoryVertex, GL_BUFFER, volumeVertices, sizeof(vertices), "deferredRenderer volume");
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, volumeIndices);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	gpuMemoryAllocate(gpuMemoryIndex, GL_BUFFER, volumeIndices, sizeof(indices), "deferredRenderer volume");
+
+	// One pointLight per instance: position + radius, colour + intensity
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(pointLight), (void*)0);
+	glVertexAttribDivisor(3, 1);
+	glEnableVertexAttribArray(3);
+	glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(pointLight), (void*)(4 * sizeof(float)));
+	glVertexAttribDivisor(4, 1);
+	glEnableVertexAttribArray(4);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static GLuint createTarget(GLenum internalFormat, GLenum format, GLenum type, int width, int height)
+{
+	GLuint texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, nullptr);
+	gpuMemoryAllocate(gpuMemoryRenderTarget, GL_TEXTURE, texture, (size_t)width * height * gpuMemoryFormatBytes(internalFormat), "deferredRenderer G-buffer");
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	return texture;
+}
+
+void deferredRenderer::createTargets()
+{
+	albedoTexture = createTarget(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, width, height);
+	normalTexture = createTarget(GL_RG16_SNORM, GL_RG, GL_SHORT, width, height);
+	depthTexture = createTarget(GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, width, height);
+	lightTexture = createTarget(GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, width, height);
+	lightDepthTexture = createTarget(GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, width, height);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenFramebuffers(1, &gbuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, gbuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, albedoTexture, 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, normalTexture, 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, depthTexture, 0);
+	GLenum buffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+	glDrawBuffers(2, buffers);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		std::cout << "ERROR::DEFERRED_RENDERER::GBUFFER_INCOMPLETE" << std::endl;
+
+	// Light accumulation depth tests against a copy of the G-buffer depth, the light pass
+	// samples depthTexture and a texture attached to the bound framebuffer is a feedback loop
+	glGenFramebuffers(1, &lightFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, lightFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, lightTexture, 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, lightDepthTexture, 0);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		std::cout << "ERROR::DEFERRED_RENDERER::LIGHT_BUFFER_INCOMPLETE" << std::endl;
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void deferredRenderer::deleteTargets()
+{
+	if (gbuffer == 0)
+		return;
+
+	GLuint framebuffers[2] = { gbuffer, lightFramebuffer };
+	GLuint textures[5] = { albedoTexture, normalTexture, depthTexture, lightTexture, lightDepthTexture };
+	glDeleteFramebuffers(2, framebuffers);
+	for (GLuint texture : textures)
+		gpuMemoryRelease(GL_TEXTURE, texture);
+	glDeleteTextures(5, textures);
+	gbuffer = 0;
+	checkedOutput = -1;
+}
+
+void deferredRenderer::resize(int newWidth, int newHeight)
+{
+	newWidth = std::max(newWidth, 1);
+	newHeight = std::max(newHeight, 1);
+	if (newWidth == width && newHeight == height)
+		return;
+
+	width = newWidth;
+	height = newHeight;
+	deleteTargets();
+	createTargets();
+}
+
+void deferredRenderer::setLights(const std::vector<pointLight>& newLights)
+{
+	lights = newLights;
+
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	if (lights.size() > instanceCapacity)
+	{
+		instanceCapacity = std::max(lights.size(), instanceCapacity * 2);
+		glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(pointLight), nullptr, GL_DYNAMIC_DRAW);
+		gpuMemoryAllocate(gpuMemoryVertex, GL_BUFFER, instanceBuffer, instanceCapacity * sizeof(pointLight), "deferredRenderer lights");
+	}
+	if (!lights.empty())
+		glBufferSubData(GL_ARRAY_BUFFER, 0, lights.size() * sizeof(pointLight), lights.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void deferredRenderer::begin(const glm::mat4& view, const glm::mat4& projection)
+{
+	PROFILE_SCOPE("deferredRenderer::begin");
+
+	viewProjection = projection * view;
+
+	if (mode == deferredShading)
+	{
+		dropped = 0;
+		glBindFramebuffer(GL_FRAMEBUFFER, gbuffer);
+		glViewport(0, 0, width, height);
+		glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+		glEnable(GL_DEPTH_TEST);
+		glDepthMask(GL_TRUE);
+
+		gbufferProgram.use();
+		glUniformMatrix4fv(glGetUniformLocation(gbufferProgram.ID, "viewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
+		return;
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+	glViewport(0, 0, width, height);
+	glEnable(GL_DEPTH_TEST);
+
+	forwardProgram.use();
+	glUniformMatrix4fv(glGetUniformLocation(forwardProgram.ID, "viewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
+	glUniform3fv(glGetUniformLocation(forwardProgram.ID, "ambient"), 1, glm::value_ptr(ambient));
+	glUniform3fv(glGetUniformLocation(forwardProgram.ID, "sunDirection"), 1, glm::value_ptr(sunDirection));
+	glUniform3fv(glGetUniformLocation(forwardProgram.ID, "sunColour"), 1, glm::value_ptr(sunColour));
+
+	int count = (int)std::min(lights.size(), (size_t)maxForwardLights);
+	size_t left = lights.size() - (size_t)count;
+	if (left != dropped && left > 0)
+		std::cout << "ERROR::DEFERRED_RENDERER::TOO_MANY_FORWARD_LIGHTS " << left << " dropped" << std::endl;
+	dropped = left;
+
+	// pointLight is two vec4s, exactly the two uniform arrays
+	std::vector<glm::vec4> positions(count), colours(count);
+	for (int i = 0; i < count; i++)
+	{
+		positions[i] = glm::vec4(lights[i].position, lights[i].radius);
+		colours[i] = glm::vec4(lights[i].colour, lights[i].intensity);
+	}
+	glUniform1i(glGetUniformLocation(forwardProgram.ID, "lightCount"), count);
+	if (count > 0)
+	{
+		glUniform4fv(glGetUniformLocation(forwardProgram.ID, "lightPositionRadius"), count, glm::value_ptr(positions[0]));
+		glUniform4fv(glGetUniformLocation(forwardProgram.ID, "lightColour"), count, glm::value_ptr(colours[0]));
+	}
+}
+
+shader& deferredRenderer::geometryShader()
+{
+	return mode == deferredShading ? gbufferProgram : forwardProgram;
+}
+
+void deferredRenderer::end()
+{
+	PROFILE_SCOPE("deferredRenderer::end");
+
+	if (mode != deferredShading)
+		return;
+
+	glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+	glm::vec2 screenSize((float)width, (float)height);
+
+	// Same format both sides, so the depth copy is always a valid blit
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, gbuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, lightFramebuffer);
+	glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, lightFramebuffer);
+	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, albedoTexture);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, normalTexture);
+	glActiveTexture(GL_TEXTURE2);
+	glBindTexture(GL_TEXTURE_2D, depthTexture);
+
+	// Ambient and sun everywhere, one triangle over the screen
+	glDisable(GL_DEPTH_TEST);
+	glDepthMask(GL_FALSE);
+
+	ambientProgram.use();
+	glUniform1i(glGetUniformLocation(ambientProgram.ID, "albedoMap"), 0);
+	glUniform1i(glGetUniformLocation(ambientProgram.ID, "normalMap"), 1);
+	glUniform3fv(glGetUniformLocation(ambientProgram.ID, "ambient"), 1, glm::value_ptr(ambient));
+	glUniform3fv(glGetUniformLocation(ambientProgram.ID, "sunDirection"), 1, glm::value_ptr(sunDirection));
+	glUniform3fv(glGetUniformLocation(ambientProgram.ID, "sunColour"), 1, glm::value_ptr(sunColour));
+	glBindVertexArray(emptyVao);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	// Point lights add up, only where the scene is inside the volume's far side
+	if (!lights.empty())
+	{
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_ONE, GL_ONE);
+		glEnable(GL_DEPTH_TEST);
+		glDepthFunc(GL_GEQUAL);
+		glEnable(GL_CULL_FACE);
+		glCullFace(GL_FRONT);
+
+		lightProgram.use();
+		glUniform1i(glGetUniformLocation(lightProgram.ID, "albedoMap"), 0);
+		glUniform1i(glGetUniformLocation(lightProgram.ID, "normalMap"), 1);
+		glUniform1i(glGetUniformLocation(lightProgram.ID, "depthMap"), 2);
+		glUniformMatrix4fv(glGetUniformLocation(lightProgram.ID, "viewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
+		glUniformMatrix4fv(glGetUniformLocation(lightProgram.ID, "inverseViewProjection"), 1, GL_FALSE, glm::value_ptr(inverseViewProjection));
+		glUniform2fv(glGetUniformLocation(lightProgram.ID, "screenSize"), 1, glm::value_ptr(screenSize));
+
+		glBindVertexArray(volumeVao);
+		glDrawElementsInstanced(GL_TRIANGLES, 60, GL_UNSIGNED_BYTE, 0, (GLsizei)lights.size());
+
+		glCullFace(GL_BACK);
+		glDisable(GL_CULL_FACE);
+		glDepthFunc(GL_LESS);
+		glDisable(GL_BLEND);
+	}
+
+	glBindVertexArray(0);
+	glDepthMask(GL_TRUE);
+	glEnable(GL_DEPTH_TEST);
+
+	// Lit colour and scene depth to the output, so forward drawn things can go on top. Depth
+	// only blits between matching formats, otherwise the output gets the colour alone
+	GLbitfield mask = GL_COLOR_BUFFER_BIT;
+	if (outputTakesDepth())
+		mask |= GL_DEPTH_BUFFER_BIT;
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, lightFramebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFramebuffer);
+	glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, mask, GL_NEAREST);
+	glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+}
+
+// Asked once per output framebuffer and size, the answer does not change between frames
+bool deferredRenderer::outputTakesDepth()
+{
+	if (checkedOutput == (GLint)outputFramebuffer)
+		return outputDepthMatches;
+
+	checkedOutput = (GLint)outputFramebuffer;
+	outputDepthMatches = false;
+
+	// The default framebuffer names its buffers GL_DEPTH and GL_STENCIL, objects their attachments
+	GLenum depth = outputFramebuffer == 0 ? GL_DEPTH : GL_DEPTH_ATTACHMENT;
+	GLenum stencil = outputFramebuffer == 0 ? GL_STENCIL : GL_STENCIL_ATTACHMENT;
+
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFramebuffer);
+	GLint depthType = GL_NONE, stencilType = GL_NONE;
+	glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, depth, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+	glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, stencil, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &stencilType);
+	if (depthType != GL_NONE && stencilType != GL_NONE)
+	{
+		GLint depthBits = 0, stencilBits = 0, componentType = GL_NONE;
+		glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, depth, GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE, &depthBits);
+		glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, depth, GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE, &componentType);
+		glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, stencil, GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE, &stencilBits);
+		outputDepthMatches = depthBits == 24 && stencilBits == 8 && componentType == GL_UNSIGNED_NORMALIZED;
+	}
+
+	if (!outputDepthMatches)
+		std::cout << "ERROR::DEFERRED_RENDERER::OUTPUT_DEPTH_FORMAT_DIFFERS only colour is copied" << std::endl;
+	return outputDepthMatches;
+}
+
+size_t deferredRenderer::targetBytes() const
+{
+	// albedo RGBA8, normal RG16, depth stencil 24 + 8 and its copy, light RGBA16F
+	return (size_t)width * height * (4 + 4 + 4 + 4 + 8);
+}
+
+size_t deferredRenderer::droppedLights() const
+{
+	return dropped;
+}
+
+void deferredRenderer::del()
+{
+	deleteTargets();
+
+	GLuint buffers[3] = { volumeVertices, volumeIndices, instanceBuffer };
+	for (GLuint buffer : buffers)
+		gpuMemoryRelease(GL_BUFFER, buffer);
+	glDeleteBuffers(3, buffers);
+	GLuint vaos[2] = { emptyVao, volumeVao };
+	glDeleteVertexArrays(2, vaos);
+
+	gbufferProgram.del();
+	forwardProgram.del();
+	ambientProgram.del();
+	lightProgram.del();
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#ifndef DEFERRED_RENDERER_CLASS
+#define DEFERRED_RENDERER_CLASS
+
+#include <glad/glad.h>
+
+#include <string>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "shader.h"
+
+/*
+	Many light shading, forward or deferred, switchable at run time on the same scene.
+
+		renderer.mode = deferredShading;          // or forwardShading
+		renderer.setLights(lights);
+		renderer.begin(view, projection);
+		... set "model" on renderer.geometryShader(), draw the scene ...
+		renderer.end();                            // lights the frame into outputFramebuffer
+
+	Geometry uses position (location 0), colour (1) and normal (2).
+
+	Deferred: the G-buffer is an RGBA8 albedo, an RG16 octahedral normal and the depth
+	buffer, 8 bytes per pixel next to depth. Positions are rebuilt from depth with the
+	inverse view projection. Ambient and sun are one full screen pass, point lights are an
+	instanced icosahedron each, back faces only with an inverted depth test, so pixels
+	outside a light's volume are never shaded and the camera may be inside one. (A stencil
+	pass would be tighter but needs one pass per light.)
+
+	Forward: one pass, every fragment loops over up to maxForwardLights lights. The rest are
+	left out, droppedLights() says how many, and the error is printed when that count changes.
+*/
+
+enum shadingMode
+{
+	forwardShading,
+	deferredShading
+};
+
+struct pointLight
+{
+	glm::vec3 position;
+	float radius;
+	glm::vec3 colour;
+	float intensity;
+};
+
+class deferredRenderer
+{
+	public:
+		static const int maxForwardLights = 64;
+
+		shadingMode mode = deferredShading;
+
+		glm::vec3 ambient = glm::vec3(0.1f);
+		glm::vec3 sunDirection = glm::vec3(-0.3f, -1.0f, -0.2f);
+		glm::vec3 sunColour = glm::vec3(0.3f);
+
+		// Where end() puts the lit frame, with the scene depth when its depth stencil is
+		// 24 + 8 bits like the G-buffer's, colour alone otherwise
+		GLuint outputFramebuffer = 0;
+
+		// shaderDirectory ends with a path separator
+		deferredRenderer(const std::string& shaderDirectory, int width, int height);
+
+		// Targets are only recreated when the size actually changes
+		void resize(int width, int height);
+
+		void setLights(const std::vector<pointLight>& lights);
+
+		void begin(const glm::mat4& view, const glm::mat4& projection);
+		shader& geometryShader();
+		void end();
+
+		// G-buffer and light accumulation target
+		size_t targetBytes() const;
+		// Lights the last forward begin() left out, 0 in deferred mode
+		size_t droppedLights() const;
+
+		void del();
+
+	private:
+		shader gbufferProgram;
+		shader forwardProgram;
+		shader ambientProgram;
+		shader lightProgram;
+
+		int width = 0;
+		int height = 0;
+
+		GLuint gbuffer = 0;
+		GLuint albedoTexture = 0;
+		GLuint normalTexture = 0;
+		GLuint depthTexture = 0;
+		GLuint lightFramebuffer = 0;
+		GLuint lightTexture = 0;
+		GLuint lightDepthTexture = 0;
+
+		// outputFramebuffer last checked for a depth format the G-buffer's blits to, -1 for none
+		GLint checkedOutput = -1;
+		bool outputDepthMatches = false;
+
+		GLuint emptyVao = 0;
+		GLuint volumeVao = 0;
+		GLuint volumeVertices = 0;
+		GLuint volumeIndices = 0;
+		GLuint instanceBuffer = 0;
+		size_t instanceCapacity = 0;
+
+		std::vector<pointLight> lights;
+		size_t dropped = 0;
+		glm::mat4 viewProjection = glm::mat4(1.0f);
+
+		void createTargets();
+		void deleteTargets();
+		void createVolume();
+		bool outputTakesDepth();
+};
+
+#endif
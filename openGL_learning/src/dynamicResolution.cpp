@@ -0,0 +1,209 @@
+#include "dynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "gpuMemory.h"
+
+float resolutionController::update(float gpuMs, float renderScale)
+{
+	float cost = gpuMs / (renderScale * renderScale);
+	fullCost.push_back(cost);
+	while (fullCost.size() > std::max(historySize, (size_t)1))
+		fullCost.pop_front();
+
+	// Over budget: straight down to a scale that leaves half the margin for noise
+	if (cost * current * current > budgetMs)
+	{
+		current = std::sqrt(budgetMs * (1.0f - 0.5f * hysteresis) / cost);
+	}
+	else
+	{
+		float worst = *std::max_element(fullCost.begin(), fullCost.end());
+		float roomy = std::sqrt(budgetMs * (1.0f - hysteresis) / std::max(worst, 1e-6f));
+		if (roomy > current)
+			current = std::min(current + maxStep, roomy);
+	}
+
+	current = std::min(std::max(current, minScale), maxScale);
+	return current;
+}
+
+float resolutionController::scale() const
+{
+	return current;
+}
+
+void resolutionController::reset()
+{
+	current = maxScale;
+	fullCost.clear();
+}
+
+dynamicResolution::dynamicResolution(int width, int height)
+{
+	for (timerQuery& query : queries)
+		glGenQueries(1, &query.id);
+	resize(width, height);
+}
+
+void dynamicResolution::createTarget()
+{
+	glGenTextures(1, &colourTexture);
+	glBindTexture(GL_TEXTURE_2D, colourTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	gpuMemoryAllocate(gpuMemoryRenderTarget, GL_TEXTURE, colourTexture, (size_t)width * height * 4, "dynamicResolution colour");
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenRenderbuffers(1, &depthBuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+	gpuMemoryAllocate(gpuMemoryRenderTarget, GL_RENDERBUFFER, depthBuffer, (size_t)width * height * 4, "dynamicResolution depth");
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colourTexture, 0);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		std::cout << "ERROR::DYNAMIC_RESOLUTION::FRAMEBUFFER_INCOMPLETE" << std::endl;
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void dynamicResolution::deleteTarget()
+{
+	if (framebuffer == 0)
+		return;
+
+	glDeleteFramebuffers(1, &framebuffer);
+	gpuMemoryRelease(GL_RENDERBUFFER, depthBuffer);
+	glDeleteRenderbuffers(1, &depthBuffer);
+	gpuMemoryRelease(GL_TEXTURE, colourTexture);
+	glDeleteTextures(1, &colourTexture);
+	framebuffer = 0;
+}
+
+void dynamicResolution::resize(int newWidth, int newHeight)
+{
+	// A minimized window reports 0 x 0
+	newWidth = std::max(newWidth, 1);
+	newHeight = std::max(newHeight, 1);
+	if (newWidth == width && newHeight == height)
+		return;
+
+	width = newWidth;
+	height = newHeight;
+	deleteTarget();
+	createTarget();
+}
+
+// Reads every finished query without waiting on the ones still in flight
+void dynamicResolution::collectQueries()
+{
+	arrived.clear();
+	for (int i = 0; i < queryCount; i++)
+	{
+		// Oldest first, so the controller sees the frames in order
+		timerQuery& query = queries[(nextQuery + i) % queryCount];
+		if (!query.pending)
+			continue;
+
+		GLint available = 0;
+		glGetQueryObjectiv(query.id, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break;
+
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(query.id, GL_QUERY_RESULT, &nanoseconds);
+		query.pending = false;
+
+		float gpuMs = (float)((double)nanoseconds / 1e6);
+		controller.update(gpuMs, query.scale);
+		arrived.push_back(gpuMs);
+
+		size_t first = frameCount - frames.size();
+		if (query.frame >= first)
+			frames[query.frame - first].gpuMs = gpuMs;
+	}
+}
+
+void dynamicResolution::begin()
+{
+	collectQueries();
+
+	frames.push_back({ scale(), renderWidth(), renderHeight(), -1.0f });
+	while (frames.size() > std::max(statsSize, (size_t)1))
+		frames.pop_front();
+
+	// All queries still in flight: the GPU is far behind, this frame goes untimed
+	timerQuery& query = queries[nextQuery];
+	timing = !query.pending;
+	if (timing)
+	{
+		query.pending = true;
+		query.scale = scale();
+		query.frame = frameCount;
+		nextQuery = (nextQuery + 1) % queryCount;
+		glBeginQuery(GL_TIME_ELAPSED, query.id);
+	}
+	frameCount++;
+
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glViewport(0, 0, renderWidth(), renderHeight());
+}
+
+void dynamicResolution::end()
+{
+	if (timing)
+		glEndQuery(GL_TIME_ELAPSED);
+	timing = false;
+
+	// Bilinear stretch of the used corner, no extra pass or shader needed
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFramebuffer);
+	glBlitFramebuffer(0, 0, renderWidth(), renderHeight(), 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+	glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+	glViewport(0, 0, width, height);
+}
+
+float dynamicResolution::scale() const
+{
+	return controller.scale();
+}
+
+int dynamicResolution::renderWidth() const
+{
+	return std::max((int)(width * scale() + 0.5f), 1);
+}
+
+int dynamicResolution::renderHeight() const
+{
+	return std::max((int)(height * scale() + 0.5f), 1);
+}
+
+GLuint dynamicResolution::targetFramebuffer() const
+{
+	return framebuffer;
+}
+
+const std::deque<resolutionFrame>& dynamicResolution::history() const
+{
+	return frames;
+}
+
+const std::vector<float>& dynamicResolution::arrivedGpuTimes() const
+{
+	return arrived;
+}
+
+void dynamicResolution::del()
+{
+	deleteTarget();
+	for (timerQuery& query : queries)
+		glDeleteQueries(1, &query.id);
+}
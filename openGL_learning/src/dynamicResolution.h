@@ -0,0 +1,134 @@
+#pragma once
+
+#ifndef DYNAMIC_RESOLUTION_CLASS
+#define DYNAMIC_RESOLUTION_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+/*
+	Dynamic resolution: the scene is drawn into an off screen target at scale x the window
+	size, and stretched to the window at the end of the frame.
+
+		resolution.resize(windowWidth, windowHeight);   // cheap when nothing changed
+		resolution.begin();                             // binds the target, sets the viewport
+		... draw the scene ...
+		resolution.end();                               // upscales into outputFramebuffer
+
+	The GPU time of every frame is measured with a GL_TIME_ELAPSED query. Results are read a
+	few frames later, never waited for, and fed to the controller, which picks the scale of
+	the next frame.
+*/
+
+/*
+	Picks a render scale that keeps the GPU time under budgetMs.
+
+	GPU time is taken to grow with the pixel count, so every sample is turned into the cost
+	of a full resolution frame (ms / scale^2). Going down uses the newest sample so a spike
+	is answered on the next frame (to half the hysteresis margin under the budget), going up uses the worst sample of the history and only
+	happens when it would still leave a hysteresis margin under the budget, by at most
+	maxStep per frame. That keeps the scale from flickering around the budget.
+*/
+
+class resolutionController
+{
+	public:
+		float budgetMs = 14.0f;
+		float minScale = 0.5f;
+		float maxScale = 1.0f;
+		// Fraction of the budget kept free before the scale goes up again
+		float hysteresis = 0.1f;
+		float maxStep = 0.05f;
+		// Samples looked at when going up
+		size_t historySize = 16;
+
+		// gpuMs was measured on a frame drawn at renderScale, returns the scale to use next
+		float update(float gpuMs, float renderScale);
+
+		float scale() const;
+		void reset();
+
+	private:
+		float current = 1.0f;
+		std::deque<float> fullCost;
+};
+
+// One frame as drawn, gpuMs is -1 until its query result arrived
+struct resolutionFrame
+{
+	float scale;
+	int width;
+	int height;
+	float gpuMs;
+};
+
+class dynamicResolution
+{
+	public:
+		resolutionController controller;
+
+		// Where end() puts the upscaled frame
+		GLuint outputFramebuffer = 0;
+
+		// Frames kept in history()
+		size_t statsSize = 240;
+
+		dynamicResolution(int width, int height);
+
+		// The target always has the full window size, scaled frames use its lower left corner
+		void resize(int width, int height);
+
+		void begin();
+		void end();
+
+		float scale() const;
+		int renderWidth() const;
+		int renderHeight() const;
+
+		// The framebuffer begin() binds, for passes that draw into it through their own targets
+		GLuint targetFramebuffer() const;
+
+		// Oldest first, the newest frames may still wait for their GPU time
+		const std::deque<resolutionFrame>& history() const;
+
+		// GPU times whose queries came back in the last begin(), oldest first
+		const std::vector<float>& arrivedGpuTimes() const;
+
+		void del();
+
+	private:
+		static const int queryCount = 4;
+
+		struct timerQuery
+		{
+			GLuint id = 0;
+			bool pending = false;
+			float scale = 1.0f;
+			// Frame number, to find its entry in the history
+			size_t frame = 0;
+		};
+
+		int width = 0;
+		int height = 0;
+
+		GLuint framebuffer = 0;
+		GLuint colourTexture = 0;
+		GLuint depthBuffer = 0;
+
+		timerQuery queries[queryCount];
+		int nextQuery = 0;
+		bool timing = false;
+		size_t frameCount = 0;
+
+		std::deque<resolutionFrame> frames;
+		std::vector<float> arrived;
+
+		void createTarget();
+		void deleteTarget();
+		void collectQueries();
+};
+
+#endif
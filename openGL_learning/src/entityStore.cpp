@@ -0,0 +1,303 @@
+#include "entityStore.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "profiler.h"
+
+// Items per job of the parallel systems, enough to hide the cost of handing out a range
+static const size_t systemGrain = 4096;
+
+bool componentPool::has(entity e) const
+{
+	return slot(e) != npos;
+}
+
+uint32_t componentPool::slot(entity e) const
+{
+	if (e.index >= sparse.size())
+		return npos;
+
+	uint32_t s = sparse[e.index];
+	return s != npos && dense[s].generation == e.generation ? s : npos;
+}
+
+size_t componentPool::size() const
+{
+	return dense.size();
+}
+
+const std::vector<entity>& componentPool::owners() const
+{
+	return dense;
+}
+
+uint32_t componentPool::insert(entity e)
+{
+	uint32_t existing = slot(e);
+	if (existing != npos)
+		return existing;
+
+	if (e.index >= sparse.size())
+		sparse.resize(std::max((size_t)e.index + 1, sparse.size() * 2), npos);
+
+	uint32_t s = (uint32_t)dense.size();
+	sparse[e.index] = s;
+	dense.push_back(e);
+	return s;
+}
+
+uint32_t componentPool::erase(entity e)
+{
+	uint32_t s = slot(e);
+	if (s == npos)
+		return npos;
+
+	entity last = dense.back();
+	dense[s] = last;
+	dense.pop_back();
+	sparse[last.index] = s;
+	sparse[e.index] = npos;
+	return s;
+}
+
+void componentPool::reserveSlots(size_t count)
+{
+	dense.reserve(count);
+}
+
+uint32_t transformPool::add(entity e, const glm::vec3& p, const glm::vec3& r, const glm::vec3& s)
+{
+	uint32_t slot = insert(e);
+	store(slot, position, p);
+	store(slot, rotation, r);
+	store(slot, scale, s);
+	store(slot, world, glm::mat4(1.0f));
+	return slot;
+}
+
+void transformPool::remove(entity e)
+{
+	uint32_t slot = erase(e);
+	if (slot != npos)
+		swapRemove(slot, position, rotation, scale, world);
+}
+
+void transformPool::reserve(size_t count)
+{
+	reserveSlots(count);
+	position.reserve(count);
+	rotation.reserve(count);
+	scale.reserve(count);
+	world.reserve(count);
+}
+
+uint32_t boundsPool::add(entity e, const glm::vec3& lo, const glm::vec3& hi)
+{
+	uint32_t slot = insert(e);
+	store(slot, localMin, lo);
+	store(slot, localMax, hi);
+	store(slot, worldMin, lo);
+	store(slot, worldMax, hi);
+	return slot;
+}
+
+void boundsPool::remove(entity e)
+{
+	uint32_t slot = erase(e);
+	if (slot != npos)
+		swapRemove(slot, localMin, localMax, worldMin, worldMax);
+}
+
+void boundsPool::reserve(size_t count)
+{
+	reserveSlots(count);
+	localMin.reserve(count);
+	localMax.reserve(count);
+	worldMin.reserve(count);
+	worldMax.reserve(count);
+}
+
+uint32_t meshPool::add(entity e, GLuint v, GLsizei count, GLenum type, GLintptr offset)
+{
+	uint32_t slot = insert(e);
+	store(slot, vao, v);
+	store(slot, indexCount, count);
+	store(slot, indexType, type);
+	store(slot, indexOffset, offset);
+	return slot;
+}
+
+void meshPool::remove(entity e)
+{
+	uint32_t slot = erase(e);
+	if (slot != npos)
+		swapRemove(slot, vao, indexCount, indexType, indexOffset);
+}
+
+void meshPool::reserve(size_t count)
+{
+	reserveSlots(count);
+	vao.reserve(count);
+	indexCount.reserve(count);
+	indexType.reserve(count);
+	indexOffset.reserve(count);
+}
+
+uint32_t materialPool::add(entity e, GLuint p, bool shadows)
+{
+	uint32_t slot = insert(e);
+	store(slot, program, p);
+	store(slot, castsShadows, (uint8_t)(shadows ? 1 : 0));
+	return slot;
+}
+
+void materialPool::remove(entity e)
+{
+	uint32_t slot = erase(e);
+	if (slot != npos)
+		swapRemove(slot, program, castsShadows);
+}
+
+void materialPool::reserve(size_t count)
+{
+	reserveSlots(count);
+	program.reserve(count);
+	castsShadows.reserve(count);
+}
+
+uint32_t lightPool::add(entity e, const glm::vec3& c, float i, float r)
+{
+	uint32_t slot = insert(e);
+	store(slot, colour, c);
+	store(slot, intensity, i);
+	store(slot, radius, r);
+	return slot;
+}
+
+void lightPool::remove(entity e)
+{
+	uint32_t slot = erase(e);
+	if (slot != npos)
+		swapRemove(slot, colour, intensity, radius);
+}
+
+void lightPool::reserve(size_t count)
+{
+	reserveSlots(count);
+	colour.reserve(count);
+	intensity.reserve(count);
+	radius.reserve(count);
+}
+
+entity entityStore::create()
+{
+	entity e;
+	if (!freeIndices.empty())
+	{
+		e.index = freeIndices.back();
+		freeIndices.pop_back();
+	}
+	else
+	{
+		e.index = (uint32_t)generations.size();
+		generations.push_back(0);
+	}
+	e.generation = generations[e.index];
+	return e;
+}
+
+void entityStore::destroy(entity e)
+{
+	if (!alive(e))
+		return;
+
+	transforms.remove(e);
+	bounds.remove(e);
+	meshes.remove(e);
+	materials.remove(e);
+	lights.remove(e);
+
+	generations[e.index]++;
+	freeIndices.push_back(e.index);
+}
+
+bool entityStore::alive(entity e) const
+{
+	return e.index < generations.size() && generations[e.index] == e.generation;
+}
+
+size_t entityStore::size() const
+{
+	return generations.size() - freeIndices.size();
+}
+
+void entityStore::reserve(size_t count)
+{
+	generations.reserve(count);
+	transforms.reserve(count);
+	bounds.reserve(count);
+	meshes.reserve(count);
+	materials.reserve(count);
+	lights.reserve(count);
+}
+
+// translate * rotateY * rotateX * rotateZ * scale, written out instead of three glm::rotate
+glm::mat4 transformMatrix(const glm::vec3& p, const glm::vec3& r, const glm::vec3& s)
+{
+	float cy = std::cos(r.y), sy = std::sin(r.y);
+	float cx = std::cos(r.x), sx = std::sin(r.x);
+	float cz = std::cos(r.z), sz = std::sin(r.z);
+
+	glm::mat4 m(1.0f);
+	m[0] = glm::vec4((cy * cz + sy * sx * sz) * s.x, (cx * sz) * s.x, (-sy * cz + cy * sx * sz) * s.x, 0.0f);
+	m[1] = glm::vec4((-cy * sz + sy * sx * cz) * s.y, (cx * cz) * s.y, (sy * sz + cy * sx * cz) * s.y, 0.0f);
+	m[2] = glm::vec4((sy * cx) * s.z, (-sx) * s.z, (cy * cx) * s.z, 0.0f);
+	m[3] = glm::vec4(p, 1.0f);
+	return m;
+}
+
+void entityUpdateWorld(entityStore& store, jobSystem& jobs)
+{
+	PROFILE_SCOPE("entityUpdateWorld");
+
+	transformPool& t = store.transforms;
+	jobs.parallelFor(t.size(), [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+			t.world[i] = transformMatrix(t.position[i], t.rotation[i], t.scale[i]);
+	}, systemGrain);
+}
+
+void entityUpdateBounds(entityStore& store, jobSystem& jobs)
+{
+	PROFILE_SCOPE("entityUpdateBounds");
+
+	boundsPool& b = store.bounds;
+	const transformPool& t = store.transforms;
+	jobs.parallelFor(b.size(), [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			uint32_t slot = t.slot(b.owners()[i]);
+			if (slot == componentPool::npos)
+			{
+				b.worldMin[i] = b.localMin[i];
+				b.worldMax[i] = b.localMax[i];
+				continue;
+			}
+
+			// Centre and extent through the matrix, the extent by the absolute of its 3x3
+			const glm::mat4& m = t.world[slot];
+			glm::vec3 centre = (b.localMin[i] + b.localMax[i]) * 0.5f;
+			glm::vec3 extent = (b.localMax[i] - b.localMin[i]) * 0.5f;
+			glm::vec3 worldCentre = glm::vec3(m * glm::vec4(centre, 1.0f));
+			glm::vec3 worldExtent(
+				std::fabs(m[0].x) * extent.x + std::fabs(m[1].x) * extent.y + std::fabs(m[2].x) * extent.z,
+				std::fabs(m[0].y) * extent.x + std::fabs(m[1].y) * extent.y + std::fabs(m[2].y) * extent.z,
+				std::fabs(m[0].z) * extent.x + std::fabs(m[1].z) * extent.y + std::fabs(m[2].z) * extent.z);
+			b.worldMin[i] = worldCentre - worldExtent;
+			b.worldMax[i] = worldCentre + worldExtent;
+		}
+	}, systemGrain);
+}
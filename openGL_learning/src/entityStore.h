@@ -0,0 +1,188 @@
+#pragma once
+
+#ifndef ENTITY_STORE_CLASS
+#define ENTITY_STORE_CLASS
+
+#include <glad/glad.h>
+#include <glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "jobSystem.h"
+
+/*
+	Scene objects as entities with components, every component type in its own pool.
+
+		entityStore scene;
+		entity box = scene.create();
+		scene.transforms.add(box, glm::vec3(0.25f));
+		scene.meshes.add(box, vao.ID, ebo.indexCount(), ebo.indexType());
+
+		entityUpdateWorld(scene, jobs);            // world matrices of every transform
+		for (size_t i = 0; i < scene.meshes.size(); i++)
+			... draw scene.meshes.vao[i] ...
+
+	An entity is an index and a generation. Destroying one bumps the generation of its index
+	before the index is handed out again, so an old handle never reaches a new entity.
+
+	A pool is dense: every field of the component is a vector of its own (structure of
+	arrays), slot i of each belongs to owners()[i], and a sparse table maps an entity index to
+	its slot. A system walks the fields it needs front to back and nothing else. Adding
+	appends; removing moves the last slot into the hole (so slots are not stable, handles
+	are). Both are O(1).
+*/
+
+struct entity
+{
+	uint32_t index = 0xffffffff;
+	uint32_t generation = 0;
+
+	bool operator==(const entity& other) const { return index == other.index && generation == other.generation; }
+	bool operator!=(const entity& other) const { return !(*this == other); }
+};
+
+// Slot bookkeeping every pool shares
+class componentPool
+{
+	public:
+		static constexpr uint32_t npos = 0xffffffff;
+
+		bool has(entity e) const;
+		// Dense slot of e, npos when it has no such component
+		uint32_t slot(entity e) const;
+		size_t size() const;
+		// Entity owning every slot
+		const std::vector<entity>& owners() const;
+
+	protected:
+		// Slot for e at the end, or the one e already has, so adding a component twice
+		// updates it instead of giving e two slots
+		uint32_t insert(entity e);
+		// Frees the slot of e by moving the last slot into it, returns that slot or npos. The
+		// fields must do the same move (swapRemove)
+		uint32_t erase(entity e);
+		void reserveSlots(size_t count);
+
+		// A field of the slot insert() gave: appended for a new slot, overwritten for an old one
+		template <typename Field, typename Value>
+		static void store(uint32_t slot, Field& field, const Value& value)
+		{
+			if (slot < field.size())
+				field[slot] = value;
+			else
+				field.push_back(value);
+		}
+
+		template <typename... Fields>
+		static void swapRemove(uint32_t slot, Fields&... fields)
+		{
+			((fields[slot] = fields.back(), fields.pop_back()), ...);
+		}
+
+	private:
+		std::vector<uint32_t> sparse;
+		std::vector<entity> dense;
+};
+
+// Euler angles in radians, applied as yaw (y), pitch (x), roll (z)
+class transformPool : public componentPool
+{
+	public:
+		std::vector<glm::vec3> position;
+		std::vector<glm::vec3> rotation;
+		std::vector<glm::vec3> scale;
+		// Written by entityUpdateWorld
+		std::vector<glm::mat4> world;
+
+		uint32_t add(entity e, const glm::vec3& position, const glm::vec3& rotation = glm::vec3(0.0f), const glm::vec3& scale = glm::vec3(1.0f));
+		void remove(entity e);
+		void reserve(size_t count);
+};
+
+// Box in the mesh's own space, and around it in the world once entityUpdateBounds ran
+class boundsPool : public componentPool
+{
+	public:
+		std::vector<glm::vec3> localMin;
+		std::vector<glm::vec3> localMax;
+		std::vector<glm::vec3> worldMin;
+		std::vector<glm::vec3> worldMax;
+
+		uint32_t add(entity e, const glm::vec3& localMin, const glm::vec3& localMax);
+		void remove(entity e);
+		void reserve(size_t count);
+};
+
+// What to draw: a VAO with its element buffer bound
+class meshPool : public componentPool
+{
+	public:
+		std::vector<GLuint> vao;
+		std::vector<GLsizei> indexCount;
+		std::vector<GLenum> indexType;
+		// Bytes into the element buffer, for meshes sharing one (geometryRegistry.h)
+		std::vector<GLintptr> indexOffset;
+
+		uint32_t add(entity e, GLuint vao, GLsizei indexCount, GLenum indexType, GLintptr indexOffset = 0);
+		void remove(entity e);
+		void reserve(size_t count);
+};
+
+class materialPool : public componentPool
+{
+	public:
+		std::vector<GLuint> program;
+		std::vector<unsigned char> castsShadows;
+
+		uint32_t add(entity e, GLuint program, bool castsShadows = true);
+		void remove(entity e);
+		void reserve(size_t count);
+};
+
+// Point light at the entity's transform position
+class lightPool : public componentPool
+{
+	public:
+		std::vector<glm::vec3> colour;
+		std::vector<float> intensity;
+		std::vector<float> radius;
+
+		uint32_t add(entity e, const glm::vec3& colour, float intensity, float radius);
+		void remove(entity e);
+		void reserve(size_t count);
+};
+
+class entityStore
+{
+	public:
+		transformPool transforms;
+		boundsPool bounds;
+		meshPool meshes;
+		materialPool materials;
+		lightPool lights;
+
+		entity create();
+		// Removes every component of e too, stale handles are ignored
+		void destroy(entity e);
+		bool alive(entity e) const;
+
+		// Entities alive
+		size_t size() const;
+		void reserve(size_t count);
+
+	private:
+		std::vector<uint32_t> generations;
+		std::vector<uint32_t> freeIndices;
+};
+
+// Matrix of one transform, as entityUpdateWorld builds it
+glm::mat4 transformMatrix(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
+
+// World matrix of every transform, in parallel over the pool
+void entityUpdateWorld(entityStore& store, jobSystem& jobs = jobSystem::shared());
+// World box of every bounds component whose entity has a transform, after entityUpdateWorld
+void entityUpdateBounds(entityStore& store, jobSystem& jobs = jobSystem::shared());
+
+#endif
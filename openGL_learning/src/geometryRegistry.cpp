@@ -0,0 +1,201 @@
+#include "geometryRegistry.h"
+
+#include <cstring>
+#include <iostream>
+
+#include "profiler.h"
+
+geometryRegistry::geometryRegistry(GLsizeiptr vertexBytes, GLsizeiptr indexBytes)
+	: vertices(GL_ARRAY_BUFFER, vertexBytes, GL_STATIC_DRAW), indices(GL_ELEMENT_ARRAY_BUFFER, indexBytes, GL_STATIC_DRAW)
+{
+}
+
+geometryRange geometryRegistry::addVertices(const void* data, GLsizeiptr size, GLsizeiptr alignment)
+{
+	return add(vertices, data, size, alignment);
+}
+
+geometryRange geometryRegistry::addIndices(const void* data, GLsizeiptr size, GLsizeiptr alignment)
+{
+	return add(indices, data, size, alignment);
+}
+
+geometryRange geometryRegistry::add(bufferArena& arena, const void* data, GLsizeiptr size, GLsizeiptr alignment)
+{
+	PROFILE_SCOPE("geometryRegistry::add");
+
+	geometryRange range;
+	range.target = arena.target();
+	alignment = alignment > 0 ? alignment : 1;
+	if (data == nullptr || size <= 0)
+	{
+		std::cout << "ERROR::GEOMETRY_REGISTRY::EMPTY_BLOB" << std::endl;
+		return range;
+	}
+
+	uint64_t key = hash(data, (size_t)size);
+	auto matches = blobs.equal_range(key);
+	for (auto it = matches.first; it != matches.second; ++it)
+	{
+		blob& existing = it->second;
+		if (existing.target != range.target || existing.size != size || existing.offset % alignment != 0)
+			continue;
+		if (std::memcmp(existing.bytes.data(), data, (size_t)size) != 0)
+			continue;
+
+		existing.references++;
+		referenceCount++;
+		referencedBytes += (size_t)size;
+		uploadsSkipped++;
+		uploadBytesSkipped += (size_t)size;
+
+		range.offset = existing.offset;
+		range.size = size;
+		return range;
+	}
+
+	GLintptr offset = arena.allocate(size, alignment);
+	if (offset < 0)
+		return range;
+	arena.upload(offset, data, size);
+
+	blob added;
+	added.target = range.target;
+	added.offset = offset;
+	added.size = size;
+	added.references = 1;
+	added.bytes.assign((const unsigned char*)data, (const unsigned char*)data + size);
+	blobs.emplace(key, std::move(added));
+	rangeHashes[std::make_pair(range.target, offset)] = key;
+
+	referenceCount++;
+	residentBytes += (size_t)size;
+	referencedBytes += (size_t)size;
+
+	range.offset = offset;
+	range.size = size;
+	return range;
+}
+
+void geometryRegistry::release(const geometryRange& range)
+{
+	auto found = rangeHashes.find(std::make_pair(range.target, range.offset));
+	if (found == rangeHashes.end())
+	{
+		std::cout << "ERROR::GEOMETRY_REGISTRY::UNKNOWN_RANGE" << std::endl;
+		return;
+	}
+
+	auto matches = blobs.equal_range(found->second);
+	for (auto it = matches.first; it != matches.second; ++it)
+	{
+		blob& existing = it->second;
+		if (existing.target != range.target || existing.offset != range.offset)
+			continue;
+
+		referenceCount--;
+		referencedBytes -= (size_t)existing.size;
+		if (--existing.references > 0)
+			return;
+
+		(existing.target == GL_ARRAY_BUFFER ? vertices : indices).release(existing.offset);
+		residentBytes -= (size_t)existing.size;
+		blobs.erase(it);
+		rangeHashes.erase(found);
+		return;
+	}
+}
+
+int geometryRegistry::references(const geometryRange& range) const
+{
+	const blob* existing = find(range.target, range.offset);
+	return existing ? existing->references : 0;
+}
+
+const geometryRegistry::blob* geometryRegistry::find(GLenum target, GLintptr offset) const
+{
+	auto found = rangeHashes.find(std::make_pair(target, offset));
+	if (found == rangeHashes.end())
+		return nullptr;
+
+	auto matches = blobs.equal_range(found->second);
+	for (auto it = matches.first; it != matches.second; ++it)
+	{
+		if (it->second.target == target && it->second.offset == offset)
+			return &it->second;
+	}
+	return nullptr;
+}
+
+GLuint geometryRegistry::vertexBuffer() const
+{
+	return vertices.buffer();
+}
+
+GLuint geometryRegistry::indexBuffer() const
+{
+	return indices.buffer();
+}
+
+const bufferArena& geometryRegistry::vertexArena() const
+{
+	return vertices;
+}
+
+const bufferArena& geometryRegistry::indexArena() const
+{
+	return indices;
+}
+
+geometryRegistryStats geometryRegistry::stats() const
+{
+	geometryRegistryStats result;
+	result.blobs = blobs.size();
+	result.references = referenceCount;
+	result.residentBytes = residentBytes;
+	result.referencedBytes = referencedBytes;
+	result.uploadsSkipped = uploadsSkipped;
+	result.uploadBytesSkipped = uploadBytesSkipped;
+	return result;
+}
+
+// Eight bytes at a time, each word mixed in with a multiply and a rotate, the tail a byte at
+// a time, and the length last so blobs of zeros of different sizes differ
+uint64_t geometryRegistry::hash(const void* data, size_t size)
+{
+	const uint64_t prime1 = 0x9E3779B185EBCA87ull;
+	const uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+
+	const unsigned char* bytes = (const unsigned char*)data;
+	uint64_t h = 0x27D4EB2F165667C5ull;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		uint64_t word;
+		std::memcpy(&word, bytes + i, 8);
+		h ^= word * prime2;
+		h = ((h << 31) | (h >> 33)) * prime1;
+	}
+	for (; i < size; i++)
+	{
+		h ^= bytes[i] * prime1;
+		h = ((h << 11) | (h >> 53)) * prime2;
+	}
+
+	h ^= (uint64_t)size;
+	h ^= h >> 33;
+	h *= prime2;
+	h ^= h >> 29;
+	return h;
+}
+
+void geometryRegistry::del()
+{
+	blobs.clear();
+	rangeHashes.clear();
+	referenceCount = 0;
+	residentBytes = 0;
+	referencedBytes = 0;
+	vertices.del();
+	indices.del();
+}
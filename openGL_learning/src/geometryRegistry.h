@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef GEOMETRY_REGISTRY_CLASS
+#define GEOMETRY_REGISTRY_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bufferArena.h"
+
+/*
+	Vertex and index data uploaded once per distinct content. Every blob added is hashed, and
+	if the same bytes are already on the GPU their range is handed out again with one more
+	reference instead of a second upload:
+
+		geometryRegistry geometry;
+		geometryRange vertices = geometry.addVertices(box.vertices.data(), sizeof(box.vertices), box.stride);
+		geometryRange indices = geometry.addIndices(box.indices.data(), sizeof(box.indices));
+		... VAO on geometry.vertexBuffer() at vertices.offset, draw at indices.offset ...
+		geometry.release(indices);          // the range goes with the last reference
+
+	Vertices and indices live in two bufferArenas. When an arena grows its buffer name
+	changes, so register everything before making VAOs or check generation() like any other
+	arena user. A hash match is confirmed against a CPU copy of the bytes, so a collision
+	costs a compare and never shares the wrong data.
+
+	Blobs only match with the same size, byte for byte. Two meshes sharing indices but not
+	vertices share the index range alone.
+*/
+
+struct geometryRange
+{
+	GLintptr offset = -1;
+	GLsizeiptr size = 0;
+	// GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER, which arena the range is in
+	GLenum target = GL_NONE;
+
+	bool valid() const { return offset >= 0; }
+};
+
+struct geometryRegistryStats
+{
+	// Distinct blobs on the GPU and the references to them
+	size_t blobs = 0;
+	size_t references = 0;
+	// Bytes in the arenas, and what the references would take with a copy each
+	size_t residentBytes = 0;
+	size_t referencedBytes = 0;
+	// Upload bandwidth saved since the start, released blobs included
+	size_t uploadsSkipped = 0;
+	size_t uploadBytesSkipped = 0;
+
+	size_t savedBytes() const { return referencedBytes - residentBytes; }
+};
+
+class geometryRegistry
+{
+	public:
+		geometryRegistry(GLsizeiptr vertexBytes = 1 << 20, GLsizeiptr indexBytes = 256 << 10);
+
+		geometryRegistry(const geometryRegistry&) = delete;
+		geometryRegistry& operator=(const geometryRegistry&) = delete;
+
+		// alignment for vertices is best the stride, offset / stride is then a base vertex. A
+		// blob already resident at an offset not of that alignment is uploaded again
+		geometryRange addVertices(const void* data, GLsizeiptr size, GLsizeiptr alignment = 4);
+		geometryRange addIndices(const void* data, GLsizeiptr size, GLsizeiptr alignment = 4);
+		// Drops one reference
+		void release(const geometryRange& range);
+		// References to the blob at range, 0 when there is none
+		int references(const geometryRange& range) const;
+
+		GLuint vertexBuffer() const;
+		GLuint indexBuffer() const;
+		const bufferArena& vertexArena() const;
+		const bufferArena& indexArena() const;
+
+		geometryRegistryStats stats() const;
+
+		// 64 bit hash of the bytes, what blobs are looked up by
+		static uint64_t hash(const void* data, size_t size);
+
+		void del();
+
+	private:
+		struct blob
+		{
+			GLenum target;
+			GLintptr offset;
+			GLsizeiptr size;
+			int references;
+			std::vector<unsigned char> bytes;
+		};
+
+		bufferArena vertices;
+		bufferArena indices;
+
+		// hash -> blobs with that hash, collisions are told apart by the bytes
+		std::unordered_multimap<uint64_t, blob> blobs;
+		// (target, offset) -> hash, to find a blob again on release
+		std::map<std::pair<GLenum, GLintptr>, uint64_t> rangeHashes;
+
+		size_t referenceCount = 0;
+		size_t residentBytes = 0;
+		size_t referencedBytes = 0;
+		size_t uploadsSkipped = 0;
+		size_t uploadBytesSkipped = 0;
+
+		geometryRange add(bufferArena& arena, const void* data, GLsizeiptr size, GLsizeiptr alignment);
+		const blob* find(GLenum target, GLintptr offset) const;
+};
+
+#endif
@@ -0,0 +1,376 @@
+#include "glInstrument.h"
+
+size_t glTexelBytes(GLenum format, GLenum type)
+{
+	switch (type)
+	{
+	case GL_UNSIGNED_BYTE_3_3_2:
+	case GL_UNSIGNED_BYTE_2_3_3_REV:
+		return 1;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_5_6_5_REV:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+	case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+	case GL_UNSIGNED_INT_24_8:
+		return 4;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		return 8;
+	}
+
+	size_t components = 4;
+	switch (format)
+	{
+	case GL_RED:
+	case GL_GREEN:
+	case GL_BLUE:
+	case GL_RED_INTEGER:
+	case GL_DEPTH_COMPONENT:
+	case GL_STENCIL_INDEX:
+		components = 1;
+		break;
+	case GL_RG:
+	case GL_RG_INTEGER:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+	case GL_BGR_INTEGER:
+		components = 3;
+		break;
+	}
+
+	switch (type)
+	{
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		return components * 2;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		return components * 4;
+	default:
+		return components;
+	}
+}
+
+#ifdef OGL_GL_INSTRUMENT
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "glModern.h"
+
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT 0x92E0
+#endif
+#ifndef GL_DEBUG_OUTPUT_SYNCHRONOUS
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
+#endif
+#ifndef GL_DEBUG_SEVERITY_HIGH
+#define GL_DEBUG_SEVERITY_HIGH 0x9146
+#endif
+#ifndef GL_DEBUG_SEVERITY_MEDIUM
+#define GL_DEBUG_SEVERITY_MEDIUM 0x9147
+#endif
+
+typedef void (APIENTRYP glInstrumentDebugCallback)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam);
+typedef void (APIENTRYP glInstrumentDebugMessageCallbackProc)(glInstrumentDebugCallback callback, const void* userParam);
+
+enum glEntryIndex
+{
+#define GL_INSTRUMENT_ENTRY(ret, name, pointer, params, args, kind, bytes) entry_##name,
+#include "glInstrumentTable.inl"
+#undef GL_INSTRUMENT_ENTRY
+	entry_DispatchCompute,
+	entry_MemoryBarrier,
+	entry_BindImageTexture,
+	entry_MultiDrawElementsIndirect,
+	entry_MultiDrawElementsIndirectCount,
+	entryCount
+};
+
+static const char* entryNames[entryCount] = {
+#define GL_INSTRUMENT_ENTRY(ret, name, pointer, params, args, kind, bytes) "gl" #name,
+#include "glInstrumentTable.inl"
+#undef GL_INSTRUMENT_ENTRY
+	"glDispatchCompute",
+	"glMemoryBarrier",
+	"glBindImageTexture",
+	"glMultiDrawElementsIndirect",
+	"glMultiDrawElementsIndirectCount",
+};
+
+static uint64_t entryCalls[entryCount];
+static uint64_t lastEntryCalls[entryCount];
+static bool entryFailed[entryCount];
+
+static glFrameCounters currentFrame;
+static glFrameCounters lastFrame;
+
+static bool installed = false;
+static bool checking = false;
+static PFNGLGETERRORPROC driverGetError = nullptr;
+
+// Triangles drawn from count vertices, lines and points make none
+static inline size_t glDrawTriangles(GLenum mode, GLsizei count)
+{
+	switch (mode)
+	{
+	case GL_TRIANGLES:
+		return (size_t)std::max(count, 0) / 3;
+	case GL_TRIANGLE_STRIP:
+	case GL_TRIANGLE_FAN:
+		return (size_t)std::max(count - 2, 0);
+	case GL_TRIANGLES_ADJACENCY:
+		return (size_t)std::max(count, 0) / 6;
+	case GL_TRIANGLE_STRIP_ADJACENCY:
+		return (size_t)std::max(count - 4, 0) / 2;
+	default:
+		return 0;
+	}
+}
+
+static inline size_t glMultiDrawTriangles(GLenum mode, const GLsizei* count, GLsizei drawCount)
+{
+	size_t triangles = 0;
+	for (GLsizei i = 0; count && i < drawCount; i++)
+		triangles += glDrawTriangles(mode, count[i]);
+	return triangles;
+}
+
+// amount is the bytes of an upload or the triangles of a draw
+static inline void countCall(int entry, glCallKind kind, size_t amount)
+{
+	entryCalls[entry]++;
+	currentFrame.calls++;
+	switch (kind)
+	{
+	case glCallDraw:
+		currentFrame.draws++;
+		currentFrame.triangles += amount;
+		break;
+	case glCallBind:
+		currentFrame.binds++;
+		break;
+	case glCallUniform:
+		currentFrame.uniforms++;
+		break;
+	case glCallUpload:
+		currentFrame.uploads++;
+		currentFrame.uploadBytes += amount;
+		break;
+	default:
+		break;
+	}
+}
+
+// Runs once the forwarded call has returned
+struct errorCheck
+{
+	int entry;
+
+	~errorCheck()
+	{
+		if (!checking || entry == entry_GetError)
+			return;
+
+		for (GLenum error = driverGetError(); error != GL_NO_ERROR; error = driverGetError())
+		{
+			currentFrame.errors++;
+			if (!entryFailed[entry])
+			{
+				entryFailed[entry] = true;
+				std::cout << "ERROR::GL::" << entryNames[entry] << " 0x" << std::hex << error << std::dec << std::endl;
+			}
+		}
+	}
+};
+
+#define GL_INSTRUMENT_ENTRY(ret, name, pointer, params, args, kind, bytes) \
+	static pointer driver_##name = nullptr; \
+	static ret APIENTRY counted_##name params \
+	{ \
+		countCall(entry_##name, kind, bytes); \
+		errorCheck check = { entry_##name }; \
+		return driver_##name args; \
+	}
+#include "glInstrumentTable.inl"
+#undef GL_INSTRUMENT_ENTRY
+
+// Triangles of the DrawElementsIndirectCommands at indirect when they are in client memory,
+// 0 when a buffer holds them. stride 0 means tightly packed
+static size_t glIndirectTriangles(GLenum mode, const void* indirect, GLsizei drawCount, GLsizei stride)
+{
+	GLint buffer = 0;
+	driver_GetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &buffer);
+	if (buffer != 0 || !indirect)
+		return 0;
+
+	size_t step = stride != 0 ? (size_t)stride : 5 * sizeof(GLuint);
+	size_t triangles = 0;
+	for (GLsizei i = 0; i < drawCount; i++)
+	{
+		// count, instanceCount, firstIndex, baseVertex, baseInstance
+		const GLuint* command = (const GLuint*)((const char*)indirect + (size_t)i * step);
+		triangles += glDrawTriangles(mode, (GLsizei)command[0]) * command[1];
+	}
+	return triangles;
+}
+
+#define GL_MODERN_ENTRY(name, member, pointer, params, args, kind, triangles) \
+	static pointer driver_##name = nullptr; \
+	static void APIENTRY counted_##name params \
+	{ \
+		countCall(entry_##name, kind, triangles); \
+		errorCheck check = { entry_##name }; \
+		driver_##name args; \
+	}
+#define GL_MODERN_ENTRIES \
+	GL_MODERN_ENTRY(DispatchCompute, dispatchCompute, glModernDispatchComputeProc, (GLuint groupsX, GLuint groupsY, GLuint groupsZ), (groupsX, groupsY, groupsZ), glCallOther, 0) \
+	GL_MODERN_ENTRY(MemoryBarrier, memoryBarrier, glModernMemoryBarrierProc, (GLbitfield barriers), (barriers), glCallOther, 0) \
+	GL_MODERN_ENTRY(BindImageTexture, bindImageTexture, glModernBindImageTextureProc, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format), glCallBind, 0) \
+	GL_MODERN_ENTRY(MultiDrawElementsIndirect, multiDrawElementsIndirect, glModernMultiDrawElementsIndirectProc, (GLenum mode, GLenum type, const void* indirect, GLsizei drawCount, GLsizei stride), (mode, type, indirect, drawCount, stride), glCallDraw, glIndirectTriangles(mode, indirect, drawCount, stride)) \
+	GL_MODERN_ENTRY(MultiDrawElementsIndirectCount, multiDrawElementsIndirectCount, glModernMultiDrawElementsIndirectCountProc, (GLenum mode, GLenum type, const void* indirect, GLintptr drawCount, GLsizei maxDrawCount, GLsizei stride), (mode, type, indirect, drawCount, maxDrawCount, stride), glCallDraw, 0)
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+
+bool glInstrumentInstall(bool checkErrors)
+{
+	if (!glad_glGetError)
+		return false;
+
+	checking = checkErrors;
+	if (installed)
+		return true;
+
+	driverGetError = glad_glGetError;
+
+	// Entry points the context did not give are left null
+#define GL_INSTRUMENT_ENTRY(ret, name, pointer, params, args, kind, bytes) \
+	driver_##name = glad_gl##name; \
+	if (driver_##name) \
+		glad_gl##name = counted_##name;
+#include "glInstrumentTable.inl"
+#undef GL_INSTRUMENT_ENTRY
+
+#define GL_MODERN_ENTRY(name, member, pointer, params, args, kind, triangles) \
+	driver_##name = glModern.member; \
+	if (driver_##name) \
+		glModern.member = counted_##name;
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+
+	installed = true;
+	return true;
+}
+
+void glInstrumentRemove()
+{
+	if (!installed)
+		return;
+
+#define GL_INSTRUMENT_ENTRY(ret, name, pointer, params, args, kind, bytes) \
+	if (driver_##name) \
+		glad_gl##name = driver_##name;
+#include "glInstrumentTable.inl"
+#undef GL_INSTRUMENT_ENTRY
+
+#define GL_MODERN_ENTRY(name, member, pointer, params, args, kind, triangles) \
+	if (driver_##name) \
+		glModern.member = driver_##name;
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+
+	installed = false;
+}
+
+void glInstrumentCheckErrors(bool checkErrors)
+{
+	checking = checkErrors;
+}
+
+static void APIENTRY debugMessage(GLenum, GLenum, GLuint, GLenum severity, GLsizei, const GLchar* message, const void*)
+{
+	currentFrame.debugMessages++;
+	if (severity == GL_DEBUG_SEVERITY_HIGH || severity == GL_DEBUG_SEVERITY_MEDIUM)
+		std::cout << "ERROR::GL::DEBUG " << message << std::endl;
+}
+
+static bool hasExtension(const char* name)
+{
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; i++)
+	{
+		const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+		if (extension && std::strcmp(extension, name) == 0)
+			return true;
+	}
+	return false;
+}
+
+bool glInstrumentDebugOutput(GLADloadproc load)
+{
+	bool core = GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3);
+	if (!core && !hasExtension("GL_KHR_debug"))
+		return false;
+
+	glInstrumentDebugMessageCallbackProc messageCallback = (glInstrumentDebugMessageCallbackProc)load("glDebugMessageCallback");
+	if (!messageCallback)
+		return false;
+
+	// Synchronous, so a message arrives inside the call that caused it
+	glEnable(GL_DEBUG_OUTPUT);
+	glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	messageCallback(&debugMessage, nullptr);
+	return true;
+}
+
+void glInstrumentEndFrame()
+{
+	lastFrame = currentFrame;
+	currentFrame = glFrameCounters();
+
+	std::memcpy(lastEntryCalls, entryCalls, sizeof(entryCalls));
+	std::memset(entryCalls, 0, sizeof(entryCalls));
+}
+
+const glFrameCounters& glInstrumentLastFrame()
+{
+	return lastFrame;
+}
+
+const glFrameCounters& glInstrumentCurrentFrame()
+{
+	return currentFrame;
+}
+
+std::vector<glEntryCount> glInstrumentLastFrameCalls()
+{
+	std::vector<glEntryCount> calls;
+	for (int i = 0; i < entryCount; i++)
+	{
+		if (lastEntryCalls[i] > 0)
+			calls.push_back({ entryNames[i], lastEntryCalls[i] });
+	}
+
+	std::sort(calls.begin(), calls.end(), [](const glEntryCount& a, const glEntryCount& b)
+	{
+		return a.calls > b.calls;
+	});
+	return calls;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef GL_INSTRUMENT_CLASS
+#define GL_INSTRUMENT_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+	Per frame counters for every GL call, built in only with OGL_GL_INSTRUMENT defined
+	(cmake -DOGL_GL_INSTRUMENT=ON, or the Debug configurations of the Visual Studio project).
+	Without it every function below is an empty inline and glad's pointers are never touched,
+	so a release build pays nothing.
+
+		gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+		loadGLModern((GLADloadproc)glfwGetProcAddress);
+		glInstrumentInstall();              // after the loaders, it wraps what they loaded
+
+		... frame ...
+		glInstrumentEndFrame();
+		const glFrameCounters& frame = glInstrumentLastFrame();
+
+	Install swaps every glad function pointer, and the glModern ones, for a wrapper that
+	counts the call by entry point and kind, adds up the bytes handed to buffer and texture
+	uploads and the triangles of every draw, and forwards to the driver. A multi draw indirect
+	only adds triangles when its commands are in client memory (no GL_DRAW_INDIRECT_BUFFER
+	bound, compatibility contexts). Out of a buffer, and for the Count variant whose draw count
+	is in one, they stay on the GPU and add none: reading them back would stall every call. With error checking on, every call is followed by
+	glGetError and the first error of each entry point is printed with its name.
+
+	The null backend (nullGL.h) is the driverless mock underneath: the benchmarks run on it,
+	and with OGL_GL_INSTRUMENT they report GL calls per op as well.
+*/
+
+enum glCallKind
+{
+	glCallOther,
+	glCallDraw,
+	glCallBind,
+	glCallUniform,
+	glCallUpload
+};
+
+struct glFrameCounters
+{
+	uint64_t calls = 0;
+	uint64_t draws = 0;
+	uint64_t triangles = 0;
+	uint64_t binds = 0;
+	uint64_t uniforms = 0;
+	uint64_t uploads = 0;
+	uint64_t uploadBytes = 0;
+	uint64_t errors = 0;
+	uint64_t debugMessages = 0;
+};
+
+struct glEntryCount
+{
+	const char* name;
+	uint64_t calls;
+};
+
+// Bytes per texel of glTexImage / glReadPixels data, packed types hold the whole texel
+size_t glTexelBytes(GLenum format, GLenum type);
+
+#ifdef OGL_GL_INSTRUMENT
+
+// False when there is nothing loaded yet
+bool glInstrumentInstall(bool checkErrors = false);
+void glInstrumentRemove();
+void glInstrumentCheckErrors(bool checkErrors);
+
+// GL 4.3 / KHR_debug messages are counted, high and medium severity ones printed
+bool glInstrumentDebugOutput(GLADloadproc load);
+
+void glInstrumentEndFrame();
+const glFrameCounters& glInstrumentLastFrame();
+const glFrameCounters& glInstrumentCurrentFrame();
+
+// Entry points called in the last frame, most called first
+std::vector<glEntryCount> glInstrumentLastFrameCalls();
+
+#else
+
+inline bool glInstrumentInstall(bool = false) { return false; }
+inline void glInstrumentRemove() {}
+inline void glInstrumentCheckErrors(bool) {}
+inline bool glInstrumentDebugOutput(GLADloadproc) { return false; }
+inline void glInstrumentEndFrame() {}
+inline const glFrameCounters& glInstrumentLastFrame() { static const glFrameCounters none; return none; }
+inline const glFrameCounters& glInstrumentCurrentFrame() { return glInstrumentLastFrame(); }
+inline std::vector<glEntryCount> glInstrumentLastFrameCalls() { return {}; }
+
+#endif
+
+#endif
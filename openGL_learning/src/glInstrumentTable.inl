@@ -0,0 +1,348 @@
+// Every entry point glad loads for GL 3.3 core, one per line. The fixed function packed
+// attribute calls (glColorP3ui, glVertexP2ui, ...) are left out, a core context has none.
+// GL_INSTRUMENT_ENTRY(return type, name, pointer type, parameters, arguments, kind, bytes uploaded or triangles drawn)
+
+GL_INSTRUMENT_ENTRY(void, ActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, AttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar* name), (program, index, name), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar* name), (program, color, name), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar* name), (program, colorNumber, index, name), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, BlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, BufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), (target, size, data, usage), glCallUpload, data ? (size_t)size : 0)
+GL_INSTRUMENT_ENTRY(void, BufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), (target, offset, size, data), glCallUpload, (size_t)size)
+GL_INSTRUMENT_ENTRY(GLenum, CheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Clear, PFNGLCLEARPROC, (GLbitfield mask), (mask), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat* value), (buffer, drawbuffer, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint* value), (buffer, drawbuffer, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint* value), (buffer, drawbuffer, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLenum, ClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, border, imageSize, data), glCallUpload, (size_t)imageSize)
+GL_INSTRUMENT_ENTRY(void, CompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, border, imageSize, data), glCallUpload, (size_t)imageSize)
+GL_INSTRUMENT_ENTRY(void, CompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, depth, border, imageSize, data), glCallUpload, (size_t)imageSize)
+GL_INSTRUMENT_ENTRY(void, CompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, width, format, imageSize, data), glCallUpload, (size_t)imageSize)
+GL_INSTRUMENT_ENTRY(void, CompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), glCallUpload, (size_t)imageSize)
+GL_INSTRUMENT_ENTRY(void, CompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), glCallUpload, (size_t)imageSize)
+GL_INSTRUMENT_ENTRY(void, CopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLuint, CreateProgram, PFNGLCREATEPROGRAMPROC, (), (), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLuint, CreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, CullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint* buffers), (n, buffers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint* framebuffers), (n, framebuffers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint* ids), (n, ids), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint* renderbuffers), (n, renderbuffers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint* samplers), (count, samplers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint* textures), (n, textures), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint* arrays), (n, arrays), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Disable, PFNGLDISABLEPROC, (GLenum cap), (cap), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Disablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count), glCallDraw, glDrawTriangles(mode, count))
+GL_INSTRUMENT_ENTRY(void, DrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount), glCallDraw, glDrawTriangles(mode, count) * (size_t)instancecount)
+GL_INSTRUMENT_ENTRY(void, DrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum* bufs), (n, bufs), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, DrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices), glCallDraw, glDrawTriangles(mode, count))
+GL_INSTRUMENT_ENTRY(void, DrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, count, type, indices, basevertex), glCallDraw, glDrawTriangles(mode, count))
+GL_INSTRUMENT_ENTRY(void, DrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount), (mode, count, type, indices, instancecount), glCallDraw, glDrawTriangles(mode, count) * (size_t)instancecount)
+GL_INSTRUMENT_ENTRY(void, DrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex), glCallDraw, glDrawTriangles(mode, count) * (size_t)instancecount)
+GL_INSTRUMENT_ENTRY(void, DrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices), (mode, start, end, count, type, indices), glCallDraw, glDrawTriangles(mode, count))
+GL_INSTRUMENT_ENTRY(void, DrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex), glCallDraw, glDrawTriangles(mode, count))
+GL_INSTRUMENT_ENTRY(void, Enable, PFNGLENABLEPROC, (GLenum cap), (cap), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, EnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Enablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, EndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (), (), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, EndQuery, PFNGLENDQUERYPROC, (GLenum target), (target), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, EndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (), (), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLsync, FenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Finish, PFNGLFINISHPROC, (), (), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Flush, PFNGLFLUSHPROC, (), (), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, FrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint* buffers), (n, buffers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint* framebuffers), (n, framebuffers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint* ids), (n, ids), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint* renderbuffers), (n, renderbuffers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint* samplers), (count, samplers), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint* textures), (n, textures), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint* arrays), (n, arrays), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params), (program, uniformBlockIndex, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName), (program, uniformIndex, bufSize, length, uniformName), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params), (program, uniformCount, uniformIndices, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders), (program, maxCount, count, shaders), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLint, GetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar* name), (program, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean* data), (target, index, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean* data), (pname, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void** params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void* data), (target, offset, size, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void* img), (target, level, img), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble* data), (pname, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLenum, GetError, PFNGLGETERRORPROC, (), (), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat* data), (pname, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLint, GetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar* name), (program, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLint, GetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar* name), (program, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint* params), (target, attachment, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64* data), (target, index, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64* data), (pname, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint* data), (target, index, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint* data), (pname, data), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat* val), (pname, index, val), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (program, bufSize, length, infoLog), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint* params), (program, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64* params), (id, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint* params), (id, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64* params), (id, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint* params), (id, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint* params), (sampler, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint* params), (sampler, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat* params), (sampler, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint* params), (sampler, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (shader, bufSize, length, infoLog), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source), (shader, bufSize, length, source), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint* params), (shader, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(const GLubyte*, GetString, PFNGLGETSTRINGPROC, (GLenum name), (name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(const GLubyte*, GetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei* length, GLint* values), (sync, pname, count, length, values), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void* pixels), (target, level, format, type, pixels), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat* params), (target, level, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint* params), (target, level, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLuint, GetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar* uniformBlockName), (program, uniformBlockName), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar* const* uniformNames, GLuint* uniformIndices), (program, uniformCount, uniformNames, uniformIndices), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLint, GetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar* name), (program, name), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat* params), (program, location, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint* params), (program, location, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint* params), (program, location, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint* params), (index, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint* params), (index, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void** pointer), (index, pname, pointer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble* params), (index, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat* params), (index, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, GetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint* params), (index, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Hint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsQuery, PFNGLISQUERYPROC, (GLuint id), (id), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsShader, PFNGLISSHADERPROC, (GLuint shader), (shader), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsSync, PFNGLISSYNCPROC, (GLsync sync), (sync), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, IsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, LineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, LinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, LogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void*, MapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void*, MapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, MultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount), (mode, first, count, drawcount), glCallDraw, glMultiDrawTriangles(mode, count, drawcount))
+GL_INSTRUMENT_ENTRY(void, MultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount), (mode, count, type, indices, drawcount), glCallDraw, glMultiDrawTriangles(mode, count, drawcount))
+GL_INSTRUMENT_ENTRY(void, MultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex), (mode, count, type, indices, drawcount, basevertex), glCallDraw, glMultiDrawTriangles(mode, count, drawcount))
+GL_INSTRUMENT_ENTRY(void, PixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat* params), (pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint* params), (pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, PrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, QueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels), (x, y, width, height, format, type, pixels), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, RenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, RenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint* param), (sampler, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint* param), (sampler, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat* param), (sampler, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, SamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint* param), (sampler, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Scissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, ShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length), (shader, count, string, length), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, StencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, StencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, StencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, StencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, StencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, StencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, border, format, type, pixels), glCallUpload, pixels ? glTexelBytes(format, type) * (size_t)width : 0)
+GL_INSTRUMENT_ENTRY(void, TexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, border, format, type, pixels), glCallUpload, pixels ? glTexelBytes(format, type) * (size_t)width * (size_t)height : 0)
+GL_INSTRUMENT_ENTRY(void, TexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels), glCallUpload, pixels ? glTexelBytes(format, type) * (size_t)width * (size_t)height * (size_t)depth : 0)
+GL_INSTRUMENT_ENTRY(void, TexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint* params), (target, pname, params), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, TexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, width, format, type, pixels), glCallUpload, pixels ? glTexelBytes(format, type) * (size_t)width : 0)
+GL_INSTRUMENT_ENTRY(void, TexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), glCallUpload, pixels ? glTexelBytes(format, type) * (size_t)width * (size_t)height : 0)
+GL_INSTRUMENT_ENTRY(void, TexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), glCallUpload, pixels ? glTexelBytes(format, type) * (size_t)width * (size_t)height * (size_t)depth : 0)
+GL_INSTRUMENT_ENTRY(void, TransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode), (program, count, varyings, bufferMode), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, Uniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(void, UniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), glCallUniform, 0)
+GL_INSTRUMENT_ENTRY(GLboolean, UnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, UseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program), glCallBind, 0)
+GL_INSTRUMENT_ENTRY(void, ValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort* v), (index, v), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer), (index, size, type, stride, pointer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, VertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer), (index, size, type, normalized, stride, pointer), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, Viewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), glCallOther, 0)
+GL_INSTRUMENT_ENTRY(void, WaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), glCallOther, 0)
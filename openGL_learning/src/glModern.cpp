@@ -0,0 +1,48 @@
+#include "glModern.h"
+
+#include <cstring>
+
+glModernProcs glModern;
+
+static bool hasExtension(const char* name)
+{
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; i++)
+	{
+		const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+		if (extension && std::strcmp(extension, name) == 0)
+			return true;
+	}
+	return false;
+}
+
+bool loadGLModern(GLADloadproc load)
+{
+	glModern = glModernProcs();
+
+	// Some platforms hand out addresses for functions the context does not support, so the
+	// version is checked before anything is loaded
+	if (GLVersion.major < 4 || (GLVersion.major == 4 && GLVersion.minor < 3))
+		return false;
+
+	glModern.dispatchCompute = (glModernDispatchComputeProc)load("glDispatchCompute");
+	glModern.memoryBarrier = (glModernMemoryBarrierProc)load("glMemoryBarrier");
+	glModern.bindImageTexture = (glModernBindImageTextureProc)load("glBindImageTexture");
+	glModern.multiDrawElementsIndirect = (glModernMultiDrawElementsIndirectProc)load("glMultiDrawElementsIndirect");
+
+	glModern.compute = glModern.dispatchCompute && glModern.memoryBarrier && glModern.bindImageTexture && glModern.multiDrawElementsIndirect;
+	if (!glModern.compute)
+	{
+		glModern = glModernProcs();
+		return false;
+	}
+
+	if (GLVersion.major > 4 || GLVersion.minor >= 6)
+		glModern.multiDrawElementsIndirectCount = (glModernMultiDrawElementsIndirectCountProc)load("glMultiDrawElementsIndirectCount");
+	else if (hasExtension("GL_ARB_indirect_parameters"))
+		glModern.multiDrawElementsIndirectCount = (glModernMultiDrawElementsIndirectCountProc)load("glMultiDrawElementsIndirectCountARB");
+	glModern.indirectCount = glModern.multiDrawElementsIndirectCount != nullptr;
+
+	return true;
+}
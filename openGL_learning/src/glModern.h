@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef GL_MODERN_CLASS
+#define GL_MODERN_CLASS
+
+#include <glad/glad.h>
+
+/*
+	GL 4.x entry points the glad loader of this project does not know about, it stops at
+	3.3 core. Call loadGLModern() right after gladLoadGLLoader with the same loader:
+
+		gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+		loadGLModern((GLADloadproc)glfwGetProcAddress);
+
+		if (glModern.compute) ... GPU driven path ...
+		else                  ... plain VAO / EBO draws ...
+
+	Nothing here is loaded on a context older than 4.3, so every pointer is either usable
+	or null.
+*/
+
+#ifndef GL_SHADER_STORAGE_BUFFER
+#define GL_SHADER_STORAGE_BUFFER 0x90D2
+#endif
+#ifndef GL_COMPUTE_SHADER
+#define GL_COMPUTE_SHADER 0x91B9
+#endif
+#ifndef GL_DRAW_INDIRECT_BUFFER
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+#ifndef GL_DRAW_INDIRECT_BUFFER_BINDING
+#define GL_DRAW_INDIRECT_BUFFER_BINDING 0x8F43
+#endif
+#ifndef GL_PARAMETER_BUFFER
+#define GL_PARAMETER_BUFFER 0x80EE
+#endif
+#ifndef GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
+#define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x00000001
+#endif
+#ifndef GL_TEXTURE_FETCH_BARRIER_BIT
+#define GL_TEXTURE_FETCH_BARRIER_BIT 0x00000008
+#endif
+#ifndef GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+#define GL_SHADER_IMAGE_ACCESS_BARRIER_BIT 0x00000020
+#endif
+#ifndef GL_COMMAND_BARRIER_BIT
+#define GL_COMMAND_BARRIER_BIT 0x00000040
+#endif
+#ifndef GL_SHADER_STORAGE_BARRIER_BIT
+#define GL_SHADER_STORAGE_BARRIER_BIT 0x00002000
+#endif
+
+typedef void (APIENTRYP glModernDispatchComputeProc)(GLuint groupsX, GLuint groupsY, GLuint groupsZ);
+typedef void (APIENTRYP glModernMemoryBarrierProc)(GLbitfield barriers);
+typedef void (APIENTRYP glModernBindImageTextureProc)(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);
+typedef void (APIENTRYP glModernMultiDrawElementsIndirectProc)(GLenum mode, GLenum type, const void* indirect, GLsizei drawCount, GLsizei stride);
+typedef void (APIENTRYP glModernMultiDrawElementsIndirectCountProc)(GLenum mode, GLenum type, const void* indirect, GLintptr drawCount, GLsizei maxDrawCount, GLsizei stride);
+
+struct glModernProcs
+{
+	// 4.3: compute shaders, shader storage buffers, image load / store and multi draw indirect
+	bool compute = false;
+	// 4.6 or GL_ARB_indirect_parameters: the draw count itself comes from a buffer
+	bool indirectCount = false;
+
+	glModernDispatchComputeProc dispatchCompute = nullptr;
+	glModernMemoryBarrierProc memoryBarrier = nullptr;
+	glModernBindImageTextureProc bindImageTexture = nullptr;
+	glModernMultiDrawElementsIndirectProc multiDrawElementsIndirect = nullptr;
+	glModernMultiDrawElementsIndirectCountProc multiDrawElementsIndirectCount = nullptr;
+};
+
+extern glModernProcs glModern;
+
+// Returns glModern.compute
+bool loadGLModern(GLADloadproc load);
+
+#endif
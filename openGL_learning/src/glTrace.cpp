@@ -0,0 +1,930 @@
+#include "glTrace.h"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "glInstrument.h"
+#include "glModern.h"
+
+static const char traceMagic[8] = { 'O', 'G', 'L', 'T', 'R', 'A', 'C', 'E' };
+static const uint32_t traceVersion = 1;
+
+// Record ids past the entry points
+static const uint16_t frameMarker = 0xFFFF;
+static const uint16_t bufferWriteMarker = 0xFFFE;
+
+// Data lengths that are not lengths
+static const uint32_t nullData = 0xFFFFFFFF;
+static const uint32_t offsetData = 0xFFFFFFFE;
+
+enum traceEntryIndex
+{
+#define GL_TRACE_ENTRY(ret, name, pointer, params, args, codes, returnCode, dropEarly, sizes) trace_##name,
+#include "glTraceTable.inl"
+#undef GL_TRACE_ENTRY
+	trace_DispatchCompute,
+	trace_MemoryBarrier,
+	trace_BindImageTexture,
+	trace_MultiDrawElementsIndirect,
+	trace_MultiDrawElementsIndirectCount,
+	traceEntryCount
+};
+
+struct traceEntryInfo
+{
+	const char* name;
+	const char* codes;
+	char returnCode;
+	bool dropEarly;
+};
+
+static const traceEntryInfo traceEntries[traceEntryCount] = {
+#define GL_TRACE_ENTRY(ret, name, pointer, params, args, codes, returnCode, dropEarly, sizes) { "gl" #name, codes, returnCode, dropEarly != 0 },
+#include "glTraceTable.inl"
+#undef GL_TRACE_ENTRY
+	{ "glDispatchCompute", "v.v.v.", '-', true },
+	{ "glMemoryBarrier", "v.", '-', false },
+	{ "glBindImageTexture", "v.ntv.v.v.v.v.", '-', false },
+	{ "glMultiDrawElementsIndirect", "v.v.o.v.v.", '-', true },
+	{ "glMultiDrawElementsIndirectCount", "v.v.o.v.v.v.", '-', true },
+};
+
+static int nameKind(char kind)
+{
+	static const char kinds[] = "btpafrqsy";
+	const char* found = kind ? std::strchr(kinds, kind) : nullptr;
+	return found ? (int)(found - kinds) : 0;
+}
+
+// Recording
+
+static std::ofstream traceFile;
+static std::vector<unsigned char> traceBuffer;
+static uint64_t traceWritten = 0;
+static uint64_t traceFramesOffset = 0;
+
+static bool recording = false;
+static int traceFrame = 0;
+static int traceFirstFrame = 0;
+static int traceFrameCount = 0;
+
+// Entry points reading pixels from / writing pixels to a bound pixel buffer
+static bool traceUnpacks[traceEntryCount];
+static bool tracePacks[traceEntryCount];
+static bool traceUnsupported[traceEntryCount];
+
+static GLint unpackAlignment = 4;
+static GLint packAlignment = 4;
+static GLuint unpackBuffer = 0;
+static GLuint packBuffer = 0;
+
+struct mappedRange
+{
+	unsigned char* pointer;
+	GLsizeiptr length;
+	bool explicitFlush;
+};
+
+static std::unordered_map<GLenum, mappedRange> mappedBuffers;
+
+static const GLchar* const* pendingStrings = nullptr;
+static size_t pendingCount = 0;
+
+// Bytes glTexImage reads, UNPACK_ROW_LENGTH and the skips are not followed, the renderer never sets them
+static size_t imageBytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth, GLint alignment)
+{
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+
+	size_t row = glTexelBytes(format, type) * (size_t)width;
+	size_t stride = (row + alignment - 1) / alignment * alignment;
+	return stride * ((size_t)height * depth - 1) + row;
+}
+
+static size_t glTraceImageBytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth)
+{
+	return imageBytes(format, type, width, height, depth, unpackAlignment);
+}
+
+static size_t glTraceReadBytes(GLenum format, GLenum type, GLsizei width, GLsizei height)
+{
+	return imageBytes(format, type, width, height, 1, packAlignment);
+}
+
+template <typename... S>
+static std::array<size_t, sizeof...(S)> traceSizeList(S... sizes)
+{
+	return { { (size_t)sizes... } };
+}
+
+static void traceWrite(const void* data, size_t count)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	traceBuffer.insert(traceBuffer.end(), bytes, bytes + count);
+}
+
+template <typename T>
+static void traceWriteValue(T value)
+{
+	traceWrite(&value, sizeof(T));
+}
+
+// Data starts 8 byte aligned in the file, so a mapped trace hands it to GL where it is
+static void traceWriteLength(uint32_t count)
+{
+	traceWriteValue<uint32_t>(count);
+	while ((traceWritten + traceBuffer.size()) % 8 != 0)
+		traceBuffer.push_back(0);
+}
+
+static void traceWriteData(const void* data, size_t count)
+{
+	if (!data)
+	{
+		traceWriteValue<uint32_t>(nullData);
+		return;
+	}
+
+	traceWriteLength((uint32_t)count);
+	traceWrite(data, count);
+}
+
+static void traceWriteString(const GLchar* string, size_t length)
+{
+	if (!string)
+	{
+		traceWriteValue<uint32_t>(nullData);
+		return;
+	}
+
+	traceWriteLength((uint32_t)length + 1);
+	traceWrite(string, length);
+	traceBuffer.push_back(0);
+}
+
+static void traceWriteStrings(const GLint* lengths)
+{
+	traceWriteValue<uint32_t>((uint32_t)pendingCount);
+	for (size_t i = 0; i < pendingCount; i++)
+	{
+		const GLchar* string = pendingStrings[i];
+		size_t length = lengths && lengths[i] >= 0 ? (size_t)lengths[i] : std::strlen(string);
+		traceWriteString(string, length);
+	}
+}
+
+static void traceFlush()
+{
+	traceFile.write((const char*)traceBuffer.data(), traceBuffer.size());
+	traceWritten += traceBuffer.size();
+	traceBuffer.clear();
+}
+
+// Whether the call goes into the trace
+static bool traceBegin(int entry)
+{
+	if (!recording || traceUnsupported[entry])
+		return false;
+	if (traceEntries[entry].dropEarly && traceFrame < traceFirstFrame)
+		return false;
+
+	traceWriteValue<uint16_t>((uint16_t)entry);
+	return true;
+}
+
+template <typename T>
+static void traceArgument(int entry, const char* code, size_t size, T value)
+{
+	if constexpr (std::is_pointer<T>::value)
+	{
+		switch (code[0])
+		{
+		case 'd':
+		case 'w':
+			// With a pixel buffer bound the pointer is an offset into it
+			if ((traceUnpacks[entry] && unpackBuffer) || (tracePacks[entry] && packBuffer))
+			{
+				traceWriteValue<uint32_t>(offsetData);
+				traceWriteValue<uint64_t>((uint64_t)(uintptr_t)value);
+			}
+			else if (code[0] == 'd')
+				traceWriteData(value, size);
+			else
+				traceWriteValue<uint32_t>(value ? (uint32_t)size : nullData);
+			break;
+		case 'c':
+			traceWriteString((const GLchar*)value, value ? std::strlen((const char*)value) : 0);
+			break;
+		case 'S':
+			pendingStrings = (const GLchar* const*)value;
+			pendingCount = size;
+			if (code[2] != 'L')
+				traceWriteStrings(nullptr);
+			break;
+		case 'L':
+			traceWriteStrings((const GLint*)value);
+			break;
+		case 'N':
+			traceWriteData(value, size * sizeof(GLuint));
+			break;
+		case 'G':
+			traceWriteValue<uint32_t>((uint32_t)size);
+			break;
+		default:
+			// Offsets and syncs
+			traceWriteValue<uint64_t>((uint64_t)(uintptr_t)value);
+			break;
+		}
+	}
+	else
+		traceWriteValue(value);
+}
+
+// Names the driver handed out go after the call
+template <typename T>
+static void traceOutput(const char* code, size_t size, T value)
+{
+	if constexpr (std::is_pointer<T>::value)
+	{
+		if (code[0] == 'G')
+			traceWrite(value, size * sizeof(GLuint));
+	}
+}
+
+template <typename R>
+static void traceReturn(char code, R value)
+{
+	if constexpr (std::is_pointer<R>::value)
+	{
+		if (code == 'y')
+			traceWriteValue<uint64_t>((uint64_t)(uintptr_t)value);
+	}
+	else if (code == 'p' || code == 'l')
+		traceWriteValue(value);
+}
+
+template <typename F> struct traceCall;
+
+template <typename R, typename... A>
+struct traceCall<R (APIENTRYP)(A...)>
+{
+	int entry;
+	const size_t* sizes;
+	R (APIENTRYP driver)(A...);
+
+	R operator()(A... arguments) const
+	{
+		if (!traceBegin(entry))
+			return driver(arguments...);
+
+		const char* codes = traceEntries[entry].codes;
+		size_t index = 0;
+		((traceArgument(entry, codes + 2 * index, sizes[index], arguments), index++), ...);
+
+		if constexpr (std::is_void<R>::value)
+		{
+			driver(arguments...);
+			index = 0;
+			((traceOutput(codes + 2 * index, sizes[index], arguments), index++), ...);
+		}
+		else
+		{
+			R result = driver(arguments...);
+			index = 0;
+			((traceOutput(codes + 2 * index, sizes[index], arguments), index++), ...);
+			traceReturn(traceEntries[entry].returnCode, result);
+			return result;
+		}
+	}
+};
+
+#define GL_TRACE_LIST(...) __VA_ARGS__
+#define GL_TRACE_ENTRY(ret, name, pointer, params, args, codes, returnCode, dropEarly, sizes) \
+	static pointer driver_##name = nullptr; \
+	static ret APIENTRY traced_##name params \
+	{ \
+		auto traceSizes = traceSizeList(GL_TRACE_LIST sizes); \
+		return traceCall<pointer>{ trace_##name, traceSizes.data(), driver_##name } args; \
+	}
+#include "glTraceTable.inl"
+#undef GL_TRACE_ENTRY
+
+static const size_t noSizes[8] = {};
+
+#define GL_MODERN_ENTRY(name, member, pointer, params, args) \
+	static pointer driver_##name = nullptr; \
+	static void APIENTRY traced_##name params \
+	{ \
+		traceCall<pointer>{ trace_##name, noSizes, driver_##name } args; \
+	}
+#define GL_MODERN_ENTRIES \
+	GL_MODERN_ENTRY(DispatchCompute, dispatchCompute, glModernDispatchComputeProc, (GLuint groupsX, GLuint groupsY, GLuint groupsZ), (groupsX, groupsY, groupsZ)) \
+	GL_MODERN_ENTRY(MemoryBarrier, memoryBarrier, glModernMemoryBarrierProc, (GLbitfield barriers), (barriers)) \
+	GL_MODERN_ENTRY(BindImageTexture, bindImageTexture, glModernBindImageTextureProc, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format)) \
+	GL_MODERN_ENTRY(MultiDrawElementsIndirect, multiDrawElementsIndirect, glModernMultiDrawElementsIndirectProc, (GLenum mode, GLenum type, const void* indirect, GLsizei drawCount, GLsizei stride), (mode, type, indirect, drawCount, stride)) \
+	GL_MODERN_ENTRY(MultiDrawElementsIndirectCount, multiDrawElementsIndirectCount, glModernMultiDrawElementsIndirectCountProc, (GLenum mode, GLenum type, const void* indirect, GLintptr drawCount, GLsizei maxDrawCount, GLsizei stride), (mode, type, indirect, drawCount, maxDrawCount, stride))
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+
+// Calls the recorder has to follow, on top of recording them
+
+static void traceBufferWrite(GLenum target, GLintptr offset, const unsigned char* data, GLsizeiptr length)
+{
+	if (!recording || length <= 0)
+		return;
+
+	traceWriteValue<uint16_t>(bufferWriteMarker);
+	traceWriteValue<uint32_t>(target);
+	traceWriteValue<uint64_t>((uint64_t)offset);
+	traceWriteData(data, (size_t)length);
+}
+
+static void APIENTRY watchedPixelStorei(GLenum pname, GLint param)
+{
+	if (pname == GL_UNPACK_ALIGNMENT)
+		unpackAlignment = param;
+	else if (pname == GL_PACK_ALIGNMENT)
+		packAlignment = param;
+	traced_PixelStorei(pname, param);
+}
+
+static void APIENTRY watchedBindBuffer(GLenum target, GLuint buffer)
+{
+	if (target == GL_PIXEL_UNPACK_BUFFER)
+		unpackBuffer = buffer;
+	else if (target == GL_PIXEL_PACK_BUFFER)
+		packBuffer = buffer;
+	traced_BindBuffer(target, buffer);
+}
+
+static void* APIENTRY watchedMapBuffer(GLenum target, GLenum access)
+{
+	void* pointer = traced_MapBuffer(target, access);
+	if (pointer && access != GL_READ_ONLY)
+	{
+		GLint size = 0;
+		driver_GetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+		mappedBuffers[target] = { (unsigned char*)pointer, size, false };
+	}
+	return pointer;
+}
+
+static void* APIENTRY watchedMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void* pointer = traced_MapBufferRange(target, offset, length, access);
+	if (pointer && (access & GL_MAP_WRITE_BIT))
+		mappedBuffers[target] = { (unsigned char*)pointer, length, (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0 };
+	return pointer;
+}
+
+static void APIENTRY watchedFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	auto mapping = mappedBuffers.find(target);
+	if (mapping != mappedBuffers.end())
+		traceBufferWrite(target, offset, mapping->second.pointer + offset, length);
+	traced_FlushMappedBufferRange(target, offset, length);
+}
+
+static GLboolean APIENTRY watchedUnmapBuffer(GLenum target)
+{
+	auto mapping = mappedBuffers.find(target);
+	if (mapping != mappedBuffers.end())
+	{
+		if (!mapping->second.explicitFlush)
+			traceBufferWrite(target, 0, mapping->second.pointer, mapping->second.length);
+		mappedBuffers.erase(mapping);
+	}
+	return traced_UnmapBuffer(target);
+}
+
+static void traceInstall()
+{
+#define GL_TRACE_ENTRY(ret, name, pointer, params, args, codes, returnCode, dropEarly, sizes) \
+	driver_##name = glad_gl##name; \
+	if (driver_##name) \
+		glad_gl##name = traced_##name;
+#include "glTraceTable.inl"
+#undef GL_TRACE_ENTRY
+
+#define GL_MODERN_ENTRY(name, member, pointer, params, args) \
+	driver_##name = glModern.member; \
+	if (driver_##name) \
+		glModern.member = traced_##name;
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+
+	if (driver_PixelStorei)
+		glad_glPixelStorei = watchedPixelStorei;
+	if (driver_BindBuffer)
+		glad_glBindBuffer = watchedBindBuffer;
+	if (driver_MapBuffer)
+		glad_glMapBuffer = watchedMapBuffer;
+	if (driver_MapBufferRange)
+		glad_glMapBufferRange = watchedMapBufferRange;
+	if (driver_FlushMappedBufferRange)
+		glad_glFlushMappedBufferRange = watchedFlushMappedBufferRange;
+	if (driver_UnmapBuffer)
+		glad_glUnmapBuffer = watchedUnmapBuffer;
+}
+
+static void traceRemove()
+{
+#define GL_TRACE_ENTRY(ret, name, pointer, params, args, codes, returnCode, dropEarly, sizes) \
+	if (driver_##name) \
+		glad_gl##name = driver_##name;
+#include "glTraceTable.inl"
+#undef GL_TRACE_ENTRY
+
+#define GL_MODERN_ENTRY(name, member, pointer, params, args) \
+	if (driver_##name) \
+		glModern.member = driver_##name;
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+}
+
+bool glTraceStart(const char* path, int firstFrame, int frameCount)
+{
+	if (recording || !glad_glGetError || frameCount <= 0)
+		return false;
+
+	traceFile.open(path, std::ios::binary | std::ios::trunc);
+	if (!traceFile)
+	{
+		std::cout << "ERROR::GL_TRACE::FILE_NOT_WRITABLE " << path << std::endl;
+		return false;
+	}
+
+	traceBuffer.clear();
+	traceWritten = 0;
+	traceWrite(traceMagic, sizeof(traceMagic));
+	traceWriteValue<uint32_t>(traceVersion);
+	traceWriteValue<uint32_t>((uint32_t)sizeof(void*));
+	traceWriteValue<uint32_t>(traceEntryCount);
+	for (int i = 0; i < traceEntryCount; i++)
+	{
+		const char* name = traceEntries[i].name;
+		traceWriteValue<uint16_t>((uint16_t)std::strlen(name));
+		traceWrite(name, std::strlen(name));
+
+		traceUnpacks[i] = std::strstr(name, "TexImage") || std::strstr(name, "TexSubImage");
+		tracePacks[i] = std::strcmp(name, "glReadPixels") == 0;
+		traceUnsupported[i] = std::strchr(traceEntries[i].codes, 'x') != nullptr;
+	}
+	traceWriteValue<uint32_t>((uint32_t)firstFrame);
+	traceFramesOffset = traceBuffer.size();
+	traceWriteValue<uint32_t>(0);
+
+	recording = true;
+	traceFrame = 0;
+	traceFirstFrame = firstFrame;
+	traceFrameCount = frameCount;
+	mappedBuffers.clear();
+
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+	glGetIntegerv(GL_PACK_ALIGNMENT, &packAlignment);
+	traceInstall();
+
+	// So the replay starts from the same pixel store state
+	glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
+	glPixelStorei(GL_PACK_ALIGNMENT, packAlignment);
+	return true;
+}
+
+void glTraceEndFrame()
+{
+	if (!recording)
+		return;
+
+	traceWriteValue<uint16_t>(frameMarker);
+	traceFrame++;
+
+	if (traceFrame >= traceFirstFrame + traceFrameCount)
+		glTraceStop();
+	else if (traceBuffer.size() > (1 << 20))
+		traceFlush();
+}
+
+void glTraceStop()
+{
+	if (!recording)
+		return;
+
+	traceRemove();
+	recording = false;
+	mappedBuffers.clear();
+
+	traceFlush();
+	uint32_t frames = traceFrame > traceFirstFrame ? (uint32_t)(traceFrame - traceFirstFrame) : 0;
+	traceFile.seekp((std::streamoff)traceFramesOffset);
+	traceFile.write((const char*)&frames, sizeof(frames));
+	traceFile.close();
+}
+
+bool glTraceRecording()
+{
+	return recording;
+}
+
+// A trace cut short by the application exiting is still finished
+static struct traceCloser
+{
+	~traceCloser()
+	{
+		glTraceStop();
+	}
+} closer;
+
+// Replay
+
+template <typename F> struct glTraceReplayCall;
+
+template <typename R, typename... A>
+struct glTraceReplayCall<R (APIENTRYP)(A...)>
+{
+	static void run(R (APIENTRYP driver)(A...), int entry, glTraceReplayer& replayer)
+	{
+		runWith(driver, entry, replayer, std::index_sequence_for<A...>());
+	}
+
+	template <size_t... I>
+	static void runWith(R (APIENTRYP driver)(A...), int entry, glTraceReplayer& replayer, std::index_sequence<I...>)
+	{
+		// Braced, so the arguments are read in order
+		std::tuple<A...> arguments{ replayer.template argument<A>(entry, I)... };
+		if (replayer.failed)
+			return;
+
+		// An entry point the context does not have is read past, and its names are left unmapped
+		if constexpr (std::is_void<R>::value)
+		{
+			if (driver)
+				std::apply(driver, arguments);
+			replayer.afterCall(entry);
+		}
+		else
+		{
+			R result = driver ? std::apply(driver, arguments) : R();
+			replayer.afterCall(entry);
+			replayer.returned(entry, result);
+		}
+	}
+};
+
+typedef void (*traceReplayProc)(glTraceReplayer& replayer);
+
+static const traceReplayProc replayCalls[traceEntryCount] = {
+#define GL_TRACE_ENTRY(ret, name, pointer, params, args, codes, returnCode, dropEarly, sizes) \
+	[](glTraceReplayer& replayer) { glTraceReplayCall<pointer>::run(glad_gl##name, trace_##name, replayer); },
+#include "glTraceTable.inl"
+#undef GL_TRACE_ENTRY
+#define GL_MODERN_ENTRY(name, member, pointer, params, args) \
+	[](glTraceReplayer& replayer) { glTraceReplayCall<pointer>::run(glModern.member, trace_##name, replayer); },
+GL_MODERN_ENTRIES
+#undef GL_MODERN_ENTRY
+};
+
+const unsigned char* glTraceReplayer::take(size_t count)
+{
+	if (failed || count > size - cursor)
+	{
+		if (!failed)
+			std::cout << "ERROR::GL_TRACE::TRUNCATED" << std::endl;
+		failed = true;
+		return nullptr;
+	}
+
+	const unsigned char* data = bytes + cursor;
+	cursor += count;
+	return data;
+}
+
+const unsigned char* glTraceReplayer::takeAligned(size_t count)
+{
+	size_t aligned = (cursor + 7) & ~(size_t)7;
+	cursor = aligned < size ? aligned : size;
+	return take(count);
+}
+
+template <typename T>
+T glTraceReplayer::read()
+{
+	T value = T();
+	const unsigned char* data = take(sizeof(T));
+	if (data)
+		std::memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+uint64_t glTraceReplayer::mapName(char kind, uint64_t recorded) const
+{
+	if (recorded == 0)
+		return 0;
+
+	const std::unordered_map<uint64_t, uint64_t>& kindNames = names[nameKind(kind)];
+	auto name = kindNames.find(recorded);
+	return name != kindNames.end() ? name->second : recorded;
+}
+
+// Locations belong to the program named in the call, the bound one otherwise
+GLuint glTraceReplayer::locationProgram() const
+{
+	return callProgram ? callProgram : currentProgram;
+}
+
+static uint64_t locationKey(GLuint program, GLint location)
+{
+	return ((uint64_t)program << 32) | (uint32_t)location;
+}
+
+GLint glTraceReplayer::mapLocation(GLint recorded) const
+{
+	if (recorded < 0)
+		return recorded;
+
+	auto location = locations.find(locationKey(locationProgram(), recorded));
+	return location != locations.end() ? location->second : recorded;
+}
+
+template <typename A>
+A glTraceReplayer::argument(int entry, size_t index)
+{
+	const char* code = traceEntries[entry].codes + 2 * index;
+
+	if constexpr (std::is_pointer<A>::value)
+	{
+		switch (code[0])
+		{
+		case 'd':
+		case 'w':
+		case 'c':
+		{
+			uint32_t count = read<uint32_t>();
+			if (count == nullData)
+				return nullptr;
+			if (count == offsetData)
+				return (A)(uintptr_t)read<uint64_t>();
+			if (code[0] != 'w')
+				return (A)takeAligned(count);
+
+			output.assign(count / sizeof(uint64_t) + 1, 0);
+			return (A)output.data();
+		}
+		case 'S':
+		{
+			uint32_t count = read<uint32_t>();
+			strings.clear();
+			for (uint32_t i = 0; i < count && !failed; i++)
+			{
+				uint32_t length = read<uint32_t>();
+				strings.push_back(length == nullData ? nullptr : (const GLchar*)takeAligned(length));
+			}
+			return (A)strings.data();
+		}
+		case 'L':
+			// Every string was stored with its terminator
+			return nullptr;
+		case 'N':
+		{
+			uint32_t count = read<uint32_t>();
+			if (count == nullData)
+				return nullptr;
+
+			const unsigned char* data = takeAligned(count);
+			nameList.resize(count / sizeof(GLuint));
+			for (size_t i = 0; data && i < nameList.size(); i++)
+			{
+				GLuint recorded;
+				std::memcpy(&recorded, data + i * sizeof(GLuint), sizeof(GLuint));
+				nameList[i] = (GLuint)mapName(code[1], recorded);
+			}
+			return (A)nameList.data();
+		}
+		case 'G':
+			generated.assign(read<uint32_t>(), 0);
+			generatedKind = code[1];
+			return (A)generated.data();
+		case 'x':
+			return nullptr;
+		default:
+		{
+			uint64_t value = read<uint64_t>();
+			if (code[0] == 'n')
+				value = mapName(code[1], value);
+			return (A)(uintptr_t)value;
+		}
+		}
+	}
+	else
+	{
+		A value = read<A>();
+		if (code[0] == 'n')
+		{
+			value = (A)mapName(code[1], (uint64_t)value);
+			if (code[1] == 'p')
+				callProgram = (GLuint)value;
+		}
+		else if (code[0] == 'l')
+			value = (A)mapLocation((GLint)value);
+
+		if constexpr (std::is_integral<A>::value)
+		{
+			if (index == 0)
+				firstArgument = (uint64_t)value;
+		}
+		return value;
+	}
+}
+
+void glTraceReplayer::afterCall(int entry)
+{
+	if (entry == trace_UseProgram)
+		currentProgram = callProgram;
+
+	if (generatedKind)
+	{
+		std::unordered_map<uint64_t, uint64_t>& kindNames = names[nameKind(generatedKind)];
+		for (GLuint name : generated)
+			kindNames[read<GLuint>()] = name;
+		generatedKind = 0;
+	}
+}
+
+template <typename R>
+void glTraceReplayer::returned(int entry, R value)
+{
+	char code = traceEntries[entry].returnCode;
+	if (code == '-')
+		return;
+
+	if constexpr (std::is_pointer<R>::value)
+	{
+		if (code == 'y')
+			names[nameKind('y')][read<uint64_t>()] = (uint64_t)(uintptr_t)value;
+		else if (code == 'm')
+			mapped[(GLenum)firstArgument] = (unsigned char*)value;
+	}
+	else
+	{
+		R recorded = read<R>();
+		if (code == 'p')
+			names[nameKind('p')][(uint64_t)recorded] = (uint64_t)value;
+		else if (code == 'l' && (GLint)recorded >= 0)
+			locations[locationKey(locationProgram(), (GLint)recorded)] = (GLint)value;
+	}
+}
+
+void glTraceReplayer::bufferWrite()
+{
+	GLenum target = read<uint32_t>();
+	uint64_t offset = read<uint64_t>();
+	uint32_t count = read<uint32_t>();
+	if (count == nullData)
+		return;
+
+	const unsigned char* data = takeAligned(count);
+	auto mapping = mapped.find(target);
+	if (data && mapping != mapped.end() && mapping->second)
+		std::memcpy(mapping->second + offset, data, count);
+}
+
+bool glTraceReplayer::replayRecord(uint16_t id)
+{
+	if (id >= entries.size() || entries[id] < 0)
+	{
+		std::cout << "ERROR::GL_TRACE::UNKNOWN_ENTRY " << id << std::endl;
+		failed = true;
+		return false;
+	}
+
+	callProgram = 0;
+	firstArgument = 0;
+	replayCalls[entries[id]](*this);
+	calls++;
+	return !failed;
+}
+
+bool glTraceReplayer::replayFrames(int count)
+{
+	while (count > 0 && !failed)
+	{
+		uint16_t id = read<uint16_t>();
+		if (failed)
+			break;
+
+		if (id == frameMarker)
+			count--;
+		else if (id == bufferWriteMarker)
+			bufferWrite();
+		else
+			replayRecord(id);
+	}
+	return !failed;
+}
+
+bool glTraceReplayer::open(const unsigned char* data, size_t size)
+{
+	bytes = data;
+	this->size = size;
+	cursor = 0;
+	rangeStart = 0;
+	setupDone = false;
+	failed = false;
+	nextFrame = 0;
+	calls = 0;
+	for (std::unordered_map<uint64_t, uint64_t>& kindNames : names)
+		kindNames.clear();
+	locations.clear();
+	mapped.clear();
+	currentProgram = 0;
+
+	const unsigned char* magic = take(sizeof(traceMagic));
+	if (!magic || std::memcmp(magic, traceMagic, sizeof(traceMagic)) != 0)
+	{
+		std::cout << "ERROR::GL_TRACE::NOT_A_TRACE" << std::endl;
+		return false;
+	}
+	if (read<uint32_t>() != traceVersion)
+	{
+		std::cout << "ERROR::GL_TRACE::VERSION" << std::endl;
+		return false;
+	}
+	if (read<uint32_t>() != sizeof(void*))
+	{
+		std::cout << "ERROR::GL_TRACE::POINTER_SIZE" << std::endl;
+		return false;
+	}
+
+	std::unordered_map<std::string, int> known;
+	for (int i = 0; i < traceEntryCount; i++)
+		known[traceEntries[i].name] = i;
+
+	// Entry points this build lacks only fail once a record uses them
+	uint32_t count = read<uint32_t>();
+	entries.assign(count, -1);
+	for (uint32_t i = 0; i < count && !failed; i++)
+	{
+		uint16_t length = read<uint16_t>();
+		const unsigned char* name = take(length);
+		if (!name)
+			break;
+
+		auto entry = known.find(std::string((const char*)name, length));
+		if (entry != known.end())
+			entries[i] = entry->second;
+	}
+
+	setupFrameCount = (int)read<uint32_t>();
+	frameCount = (int)read<uint32_t>();
+	return !failed;
+}
+
+int glTraceReplayer::setupFrames() const
+{
+	return setupFrameCount;
+}
+
+int glTraceReplayer::frames() const
+{
+	return frameCount;
+}
+
+bool glTraceReplayer::replaySetup()
+{
+	if (setupDone)
+		return !failed;
+
+	replayFrames(setupFrameCount);
+	rangeStart = cursor;
+	setupDone = true;
+	return !failed;
+}
+
+bool glTraceReplayer::replayFrame()
+{
+	if (!replaySetup() || nextFrame >= frameCount)
+		return false;
+
+	nextFrame++;
+	return replayFrames(1);
+}
+
+void glTraceReplayer::rewind()
+{
+	if (!setupDone)
+		return;
+
+	cursor = rangeStart;
+	nextFrame = 0;
+	mapped.clear();
+}
+
+uint64_t glTraceReplayer::callsReplayed() const
+{
+	return calls;
+}
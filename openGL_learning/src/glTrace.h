@@ -0,0 +1,115 @@
+#pragma once
+
+#ifndef GL_TRACE_CLASS
+#define GL_TRACE_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+	GL command traces: record exactly what the renderer submitted for a range of frames, and
+	replay it without the application (openGL_learning_replay).
+
+		gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+		loadGLModern((GLADloadproc)glfwGetProcAddress);
+		glTraceStart("frames.ogltrace", 300, 5);    // before anything is created
+
+		... every frame, after the swap ...
+		glTraceEndFrame();
+
+	Recording wraps glad's function pointers, and the glModern ones, the way glInstrument
+	does, on top of it when both are installed. Until glTraceStart nothing is touched.
+
+	The range needs the buffers, textures and programs made before it, so recording starts
+	at once: frames before the range keep every call except draws, clears, blits and read
+	backs, which holds the state without the cost. After the last frame of the range the
+	file is finished and the pointers go back.
+
+	A call is stored as made: the entry point, the raw argument values and the data behind
+	input pointers (uploads, uniform arrays, shader sources, name lists). Object names and
+	uniform locations are mapped to whatever the replaying driver hands out, so a trace
+	replays on any machine with the same pointer size. Writes through a mapped buffer are
+	stored at glFlushMappedBufferRange / glUnmapBuffer. glGetTexImage and
+	glGetCompressedTexImage are not recorded.
+*/
+
+// False if the file can't be written or a trace is already running
+bool glTraceStart(const char* path, int firstFrame, int frameCount);
+void glTraceEndFrame();
+// Finishes the file early
+void glTraceStop();
+bool glTraceRecording();
+
+class glTraceReplayer
+{
+	public:
+		// The trace stays owned by the caller, e.g. a mappedFile
+		bool open(const unsigned char* data, size_t size);
+
+		// Frames recorded before the range, and in it
+		int setupFrames() const;
+		int frames() const;
+
+		// Everything before the range, run by the first replayFrame if not called
+		bool replaySetup();
+		// The next frame of the range, false when there is none left or the trace is broken
+		bool replayFrame();
+		// Back to the first frame of the range
+		void rewind();
+
+		uint64_t callsReplayed() const;
+
+	private:
+		const unsigned char* bytes = nullptr;
+		size_t size = 0;
+		size_t cursor = 0;
+		size_t rangeStart = 0;
+		bool setupDone = false;
+		bool failed = false;
+
+		int setupFrameCount = 0;
+		int frameCount = 0;
+		int nextFrame = 0;
+		uint64_t calls = 0;
+
+		// Trace entry index -> this build's entry index
+		std::vector<int> entries;
+
+		std::unordered_map<uint64_t, uint64_t> names[9];
+		std::unordered_map<uint64_t, GLint> locations;
+		std::unordered_map<GLenum, unsigned char*> mapped;
+		GLuint currentProgram = 0;
+		GLuint callProgram = 0;
+		uint64_t firstArgument = 0;
+
+		// Per call scratch
+		std::vector<const GLchar*> strings;
+		std::vector<GLuint> nameList;
+		std::vector<GLuint> generated;
+		std::vector<uint64_t> output;
+		char generatedKind = 0;
+
+		bool replayFrames(int count);
+		bool replayRecord(uint16_t id);
+		void bufferWrite();
+
+		const unsigned char* take(size_t count);
+		const unsigned char* takeAligned(size_t count);
+		template <typename T> T read();
+
+		template <typename A> A argument(int entry, size_t index);
+		void afterCall(int entry);
+		template <typename R> void returned(int entry, R value);
+
+		uint64_t mapName(char kind, uint64_t recorded) const;
+		GLint mapLocation(GLint recorded) const;
+		GLuint locationProgram() const;
+
+		template <typename F> friend struct glTraceReplayCall;
+};
+
+#endif
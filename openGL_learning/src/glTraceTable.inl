@@ -0,0 +1,358 @@
+// Every entry point of glInstrumentTable.inl again, with what the trace needs to know:
+// GL_TRACE_ENTRY(return type, name, pointer type, parameters, arguments, codes, return code, dropped before the range, sizes)
+//
+// codes: two characters per parameter, what it is and, for object names, which kind
+//   v.  plain value                    nX  object name of kind X        l.  uniform location
+//   o.  pointer used as an offset      d.  input data, sizes[i] bytes   c.  C string
+//   S.  sizes[i] strings               L.  string lengths (ShaderSource)
+//   NX  sizes[i] names in              GX  sizes[i] names out           w.  output, sizes[i] bytes
+//   x.  not supported, replayed as null
+// kinds: b buffer, t texture, p program / shader, a vertex array, f framebuffer,
+//   r renderbuffer, q query, s sampler, y sync
+// return codes: - nothing to keep, p new program / shader, y new sync, l uniform location,
+//   m mapped buffer pointer
+
+GL_TRACE_ENTRY(void, ActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, AttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), "npnp", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode), "nqv.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id), "v.nq", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, BindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar* name), (program, index, name), "npv.c.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, BindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer), "v.nb", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), "v.v.nb", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, BindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), "v.v.nbv.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, BindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar* name), (program, color, name), "npv.c.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, BindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar* name), (program, colorNumber, index, name), "npv.v.c.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, BindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer), "v.nf", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer), "v.nr", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler), "v.ns", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture), "v.nt", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array), "na", '-', 0, (0))
+GL_TRACE_ENTRY(void, BlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, BlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, BlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, BlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, BlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), "v.v.v.v.v.v.v.v.v.v.", '-', 1, (0, 0, 0, 0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, BufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), (target, size, data, usage), "v.v.d.v.", '-', 0, (0, 0, data ? (size_t)size : 0, 0))
+GL_TRACE_ENTRY(void, BufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), (target, offset, size, data), "v.v.v.d.", '-', 0, (0, 0, 0, data ? (size_t)size : 0))
+GL_TRACE_ENTRY(GLenum, CheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target), "v.", '-', 1, (0))
+GL_TRACE_ENTRY(void, ClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, Clear, PFNGLCLEARPROC, (GLbitfield mask), (mask), "v.", '-', 1, (0))
+GL_TRACE_ENTRY(void, ClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil), "v.v.v.v.", '-', 1, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, ClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat* value), (buffer, drawbuffer, value), "v.v.d.", '-', 1, (0, 0, (buffer == GL_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, ClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint* value), (buffer, drawbuffer, value), "v.v.d.", '-', 1, (0, 0, (buffer == GL_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, ClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint* value), (buffer, drawbuffer, value), "v.v.d.", '-', 1, (0, 0, (buffer == GL_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, ClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, ClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, ClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(GLenum, ClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), "nyv.v.", '-', 1, (0, 0, 0))
+GL_TRACE_ENTRY(void, ColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, ColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, CompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader), "np", '-', 0, (0))
+GL_TRACE_ENTRY(void, CompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, border, imageSize, data), "v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, (size_t)imageSize))
+GL_TRACE_ENTRY(void, CompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, border, imageSize, data), "v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, (size_t)imageSize))
+GL_TRACE_ENTRY(void, CompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, depth, border, imageSize, data), "v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, (size_t)imageSize))
+GL_TRACE_ENTRY(void, CompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, width, format, imageSize, data), "v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, (size_t)imageSize))
+GL_TRACE_ENTRY(void, CompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), "v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, (size_t)imageSize))
+GL_TRACE_ENTRY(void, CompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), "v.v.v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, (size_t)imageSize))
+GL_TRACE_ENTRY(void, CopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, CopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), "v.v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, CopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), "v.v.v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, CopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), "v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, CopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), "v.v.v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, CopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), "v.v.v.v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(GLuint, CreateProgram, PFNGLCREATEPROGRAMPROC, (), (), "", 'p', 0, (0))
+GL_TRACE_ENTRY(GLuint, CreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type), "v.", 'p', 0, (0))
+GL_TRACE_ENTRY(void, CullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, DeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint* buffers), (n, buffers), "v.Nb", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, DeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint* framebuffers), (n, framebuffers), "v.Nf", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, DeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program), "np", '-', 0, (0))
+GL_TRACE_ENTRY(void, DeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint* ids), (n, ids), "v.Nq", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, DeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint* renderbuffers), (n, renderbuffers), "v.Nr", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, DeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint* samplers), (count, samplers), "v.Ns", '-', 0, (0, (size_t)count))
+GL_TRACE_ENTRY(void, DeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader), "np", '-', 0, (0))
+GL_TRACE_ENTRY(void, DeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync), "ny", '-', 0, (0))
+GL_TRACE_ENTRY(void, DeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint* textures), (n, textures), "v.Nt", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint* arrays), (n, arrays), "v.Na", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, DepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, DepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, DepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, DetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), "npnp", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, Disable, PFNGLDISABLEPROC, (GLenum cap), (cap), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, DisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, Disablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, DrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count), "v.v.v.", '-', 1, (0, 0, 0))
+GL_TRACE_ENTRY(void, DrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount), "v.v.v.v.", '-', 1, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, DrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf), "v.", '-', 1, (0))
+GL_TRACE_ENTRY(void, DrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum* bufs), (n, bufs), "v.d.", '-', 1, (0, (size_t)n * 4))
+GL_TRACE_ENTRY(void, DrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices), "v.v.v.o.", '-', 1, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, DrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, count, type, indices, basevertex), "v.v.v.o.v.", '-', 1, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, DrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount), (mode, count, type, indices, instancecount), "v.v.v.o.v.", '-', 1, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, DrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex), "v.v.v.o.v.v.", '-', 1, (0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, DrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices), (mode, start, end, count, type, indices), "v.v.v.v.v.o.", '-', 1, (0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, DrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex), "v.v.v.v.v.o.v.", '-', 1, (0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Enable, PFNGLENABLEPROC, (GLenum cap), (cap), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, EnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, Enablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, EndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (), (), "", '-', 0, (0))
+GL_TRACE_ENTRY(void, EndQuery, PFNGLENDQUERYPROC, (GLenum target), (target), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, EndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (), (), "", '-', 0, (0))
+GL_TRACE_ENTRY(GLsync, FenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags), "v.v.", 'y', 0, (0, 0))
+GL_TRACE_ENTRY(void, Finish, PFNGLFINISHPROC, (), (), "", '-', 1, (0))
+GL_TRACE_ENTRY(void, Flush, PFNGLFLUSHPROC, (), (), "", '-', 1, (0))
+GL_TRACE_ENTRY(void, FlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, FramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), "v.v.v.nr", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, FramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), "v.v.ntv.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, FramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), "v.v.v.ntv.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, FramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), "v.v.v.ntv.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, FramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), "v.v.v.ntv.v.", '-', 0, (0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, FramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), "v.v.ntv.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, FrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, GenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint* buffers), (n, buffers), "v.Gb", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, GenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint* framebuffers), (n, framebuffers), "v.Gf", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, GenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint* ids), (n, ids), "v.Gq", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, GenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint* renderbuffers), (n, renderbuffers), "v.Gr", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, GenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint* samplers), (count, samplers), "v.Gs", '-', 0, (0, (size_t)count))
+GL_TRACE_ENTRY(void, GenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint* textures), (n, textures), "v.Gt", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, GenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint* arrays), (n, arrays), "v.Ga", '-', 0, (0, (size_t)n))
+GL_TRACE_ENTRY(void, GenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, GetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name), "npv.v.w.w.w.w.", '-', 1, (0, 0, 0, 256, 256, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name), "npv.v.w.w.w.w.", '-', 1, (0, 0, 0, 256, 256, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName), "npv.v.w.w.", '-', 1, (0, 0, 0, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params), (program, uniformBlockIndex, pname, params), "npv.v.w.", '-', 1, (0, 0, 0, 256))
+GL_TRACE_ENTRY(void, GetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName), (program, uniformIndex, bufSize, length, uniformName), "npv.v.w.w.", '-', 1, (0, 0, 0, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params), (program, uniformCount, uniformIndices, pname, params), "npv.d.v.w.", '-', 1, (0, 0, (size_t)uniformCount * 4, 0, (size_t)uniformCount * 4))
+GL_TRACE_ENTRY(void, GetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders), (program, maxCount, count, shaders), "npv.w.w.", '-', 1, (0, 0, 256, 256))
+GL_TRACE_ENTRY(GLint, GetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar* name), (program, name), "npc.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, GetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean* data), (target, index, data), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean* data), (pname, data), "v.w.", '-', 1, (0, 256))
+GL_TRACE_ENTRY(void, GetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void** params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void* data), (target, offset, size, data), "v.v.v.w.", '-', 1, (0, 0, 0, (size_t)size))
+GL_TRACE_ENTRY(void, GetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void* img), (target, level, img), "v.v.x.", '-', 1, (0, 0, 0))
+GL_TRACE_ENTRY(void, GetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble* data), (pname, data), "v.w.", '-', 1, (0, 256))
+GL_TRACE_ENTRY(GLenum, GetError, PFNGLGETERRORPROC, (), (), "", '-', 1, (0))
+GL_TRACE_ENTRY(void, GetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat* data), (pname, data), "v.w.", '-', 1, (0, 256))
+GL_TRACE_ENTRY(GLint, GetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar* name), (program, name), "npc.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(GLint, GetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar* name), (program, name), "npc.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, GetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint* params), (target, attachment, pname, params), "v.v.v.w.", '-', 1, (0, 0, 0, 256))
+GL_TRACE_ENTRY(void, GetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64* data), (target, index, data), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64* data), (pname, data), "v.w.", '-', 1, (0, 256))
+GL_TRACE_ENTRY(void, GetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint* data), (target, index, data), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint* data), (pname, data), "v.w.", '-', 1, (0, 256))
+GL_TRACE_ENTRY(void, GetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat* val), (pname, index, val), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (program, bufSize, length, infoLog), "npv.w.w.", '-', 1, (0, 0, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint* params), (program, pname, params), "npv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64* params), (id, pname, params), "nqv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint* params), (id, pname, params), "nqv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64* params), (id, pname, params), "nqv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint* params), (id, pname, params), "nqv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint* params), (sampler, pname, params), "nsv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint* params), (sampler, pname, params), "nsv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat* params), (sampler, pname, params), "nsv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint* params), (sampler, pname, params), "nsv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (shader, bufSize, length, infoLog), "npv.w.w.", '-', 1, (0, 0, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source), (shader, bufSize, length, source), "npv.w.w.", '-', 1, (0, 0, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(void, GetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint* params), (shader, pname, params), "npv.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(const GLubyte*, GetString, PFNGLGETSTRINGPROC, (GLenum name), (name), "v.", '-', 1, (0))
+GL_TRACE_ENTRY(const GLubyte*, GetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index), "v.v.", '-', 1, (0, 0))
+GL_TRACE_ENTRY(void, GetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei* length, GLint* values), (sync, pname, count, length, values), "nyv.v.w.w.", '-', 1, (0, 0, 0, 256, 256))
+GL_TRACE_ENTRY(void, GetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void* pixels), (target, level, format, type, pixels), "v.v.v.v.x.", '-', 1, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, GetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat* params), (target, level, pname, params), "v.v.v.w.", '-', 1, (0, 0, 0, 256))
+GL_TRACE_ENTRY(void, GetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint* params), (target, level, pname, params), "v.v.v.w.", '-', 1, (0, 0, 0, 256))
+GL_TRACE_ENTRY(void, GetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint* params), (target, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name), "npv.v.w.w.w.w.", '-', 1, (0, 0, 0, 256, 256, 256, (size_t)bufSize))
+GL_TRACE_ENTRY(GLuint, GetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar* uniformBlockName), (program, uniformBlockName), "npc.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, GetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar* const* uniformNames, GLuint* uniformIndices), (program, uniformCount, uniformNames, uniformIndices), "npv.S.w.", '-', 1, (0, 0, (size_t)uniformCount, (size_t)uniformCount * 4))
+GL_TRACE_ENTRY(GLint, GetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar* name), (program, name), "npc.", 'l', 0, (0, 0))
+GL_TRACE_ENTRY(void, GetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat* params), (program, location, params), "npl.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint* params), (program, location, params), "npl.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint* params), (program, location, params), "npl.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint* params), (index, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint* params), (index, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void** pointer), (index, pname, pointer), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble* params), (index, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat* params), (index, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, GetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint* params), (index, pname, params), "v.v.w.", '-', 1, (0, 0, 256))
+GL_TRACE_ENTRY(void, Hint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(GLboolean, IsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer), "nb", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap), "v.", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index), "v.v.", '-', 1, (0, 0))
+GL_TRACE_ENTRY(GLboolean, IsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer), "nf", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program), "np", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsQuery, PFNGLISQUERYPROC, (GLuint id), (id), "nq", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer), "nr", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler), "ns", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsShader, PFNGLISSHADERPROC, (GLuint shader), (shader), "np", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsSync, PFNGLISSYNCPROC, (GLsync sync), (sync), "ny", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture), "nt", '-', 1, (0))
+GL_TRACE_ENTRY(GLboolean, IsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array), "na", '-', 1, (0))
+GL_TRACE_ENTRY(void, LineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, LinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program), "np", '-', 0, (0))
+GL_TRACE_ENTRY(void, LogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void*, MapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access), "v.v.", 'm', 0, (0, 0))
+GL_TRACE_ENTRY(void*, MapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access), "v.v.v.v.", 'm', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, MultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount), (mode, first, count, drawcount), "v.d.d.v.", '-', 1, (0, (size_t)drawcount * 4, (size_t)drawcount * 4, 0))
+GL_TRACE_ENTRY(void, MultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount), (mode, count, type, indices, drawcount), "v.d.v.d.v.", '-', 1, (0, (size_t)drawcount * 4, 0, (size_t)drawcount * sizeof(void*), 0))
+GL_TRACE_ENTRY(void, MultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex), (mode, count, type, indices, drawcount, basevertex), "v.d.v.d.v.d.", '-', 1, (0, (size_t)drawcount * 4, 0, (size_t)drawcount * sizeof(void*), 0, (size_t)drawcount * 4))
+GL_TRACE_ENTRY(void, PixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, PixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, PointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, PointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat* params), (pname, params), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, PointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, PointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint* params), (pname, params), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, PointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, PolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, PolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, PrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, ProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, QueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target), "nqv.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, ReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, ReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels), (x, y, width, height, format, type, pixels), "v.v.v.v.v.v.w.", '-', 1, (0, 0, 0, 0, 0, 0, glTraceReadBytes(format, type, width, height)))
+GL_TRACE_ENTRY(void, RenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, RenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, SampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, SampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, SamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint* param), (sampler, pname, param), "nsv.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, SamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint* param), (sampler, pname, param), "nsv.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, SamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param), "nsv.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, SamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat* param), (sampler, pname, param), "nsv.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, SamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param), "nsv.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, SamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint* param), (sampler, pname, param), "nsv.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, Scissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, ShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length), (shader, count, string, length), "npv.S.L.", '-', 0, (0, 0, (size_t)count, 0))
+GL_TRACE_ENTRY(void, StencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, StencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, StencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, StencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, StencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, StencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, TexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), "v.v.nb", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, TexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, border, format, type, pixels), "v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, pixels ? glTraceImageBytes(format, type, width, 1, 1) : 0))
+GL_TRACE_ENTRY(void, TexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, border, format, type, pixels), "v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, pixels ? glTraceImageBytes(format, type, width, height, 1) : 0))
+GL_TRACE_ENTRY(void, TexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), "v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, TexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels), "v.v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, 0, pixels ? glTraceImageBytes(format, type, width, height, depth) : 0))
+GL_TRACE_ENTRY(void, TexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), "v.v.v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, TexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint* params), (target, pname, params), "v.v.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, TexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint* params), (target, pname, params), "v.v.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, TexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, TexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat* params), (target, pname, params), "v.v.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, TexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, TexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint* params), (target, pname, params), "v.v.d.", '-', 0, (0, 0, (pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * 4))
+GL_TRACE_ENTRY(void, TexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, width, format, type, pixels), "v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, pixels ? glTraceImageBytes(format, type, width, 1, 1) : 0))
+GL_TRACE_ENTRY(void, TexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), "v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, pixels ? glTraceImageBytes(format, type, width, height, 1) : 0))
+GL_TRACE_ENTRY(void, TexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), "v.v.v.v.v.v.v.v.v.v.d.", '-', 0, (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, pixels ? glTraceImageBytes(format, type, width, height, depth) : 0))
+GL_TRACE_ENTRY(void, TransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode), (program, count, varyings, bufferMode), "npv.S.v.", '-', 0, (0, 0, (size_t)count, 0))
+GL_TRACE_ENTRY(void, Uniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0), "l.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, Uniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 1 * 4))
+GL_TRACE_ENTRY(void, Uniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0), "l.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, Uniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 1 * 4))
+GL_TRACE_ENTRY(void, Uniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0), "l.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, Uniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 1 * 4))
+GL_TRACE_ENTRY(void, Uniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), "l.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 2 * 4))
+GL_TRACE_ENTRY(void, Uniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1), "l.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 2 * 4))
+GL_TRACE_ENTRY(void, Uniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), "l.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 2 * 4))
+GL_TRACE_ENTRY(void, Uniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), "l.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 3 * 4))
+GL_TRACE_ENTRY(void, Uniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), "l.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 3 * 4))
+GL_TRACE_ENTRY(void, Uniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), "l.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 3 * 4))
+GL_TRACE_ENTRY(void, Uniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), "l.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 4 * 4))
+GL_TRACE_ENTRY(void, Uniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), "l.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 4 * 4))
+GL_TRACE_ENTRY(void, Uniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), "l.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Uniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint* value), (location, count, value), "l.v.d.", '-', 0, (0, 0, (size_t)count * 4 * 4))
+GL_TRACE_ENTRY(void, UniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding), "npv.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, UniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 16))
+GL_TRACE_ENTRY(void, UniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 24))
+GL_TRACE_ENTRY(void, UniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 32))
+GL_TRACE_ENTRY(void, UniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 36))
+GL_TRACE_ENTRY(void, UniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 24))
+GL_TRACE_ENTRY(void, UniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 48))
+GL_TRACE_ENTRY(void, UniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 64))
+GL_TRACE_ENTRY(void, UniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 32))
+GL_TRACE_ENTRY(void, UniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value), "l.v.v.d.", '-', 0, (0, 0, 0, (size_t)count * 48))
+GL_TRACE_ENTRY(GLboolean, UnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target), "v.", '-', 0, (0))
+GL_TRACE_ENTRY(void, UseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program), "np", '-', 0, (0))
+GL_TRACE_ENTRY(void, ValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program), "np", '-', 0, (0))
+GL_TRACE_ENTRY(void, VertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort* v), (index, v), "v.d.", '-', 0, (0, 2))
+GL_TRACE_ENTRY(void, VertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble* v), (index, v), "v.d.", '-', 0, (0, 24))
+GL_TRACE_ENTRY(void, VertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat* v), (index, v), "v.d.", '-', 0, (0, 12))
+GL_TRACE_ENTRY(void, VertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort* v), (index, v), "v.d.", '-', 0, (0, 6))
+GL_TRACE_ENTRY(void, VertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble* v), (index, v), "v.d.", '-', 0, (0, 32))
+GL_TRACE_ENTRY(void, VertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x), "v.v.", '-', 0, (0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y), "v.v.v.", '-', 0, (0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint* v), (index, v), "v.d.", '-', 0, (0, 12))
+GL_TRACE_ENTRY(void, VertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint* v), (index, v), "v.d.", '-', 0, (0, 12))
+GL_TRACE_ENTRY(void, VertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte* v), (index, v), "v.d.", '-', 0, (0, 4))
+GL_TRACE_ENTRY(void, VertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), "v.v.v.v.v.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint* v), (index, v), "v.d.", '-', 0, (0, 16))
+GL_TRACE_ENTRY(void, VertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort* v), (index, v), "v.d.", '-', 0, (0, 8))
+GL_TRACE_ENTRY(void, VertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer), (index, size, type, stride, pointer), "v.v.v.v.o.", '-', 0, (0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), "v.v.v.d.", '-', 0, (0, 0, 0, 4))
+GL_TRACE_ENTRY(void, VertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), "v.v.v.d.", '-', 0, (0, 0, 0, 4))
+GL_TRACE_ENTRY(void, VertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), "v.v.v.d.", '-', 0, (0, 0, 0, 4))
+GL_TRACE_ENTRY(void, VertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, VertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value), "v.v.v.d.", '-', 0, (0, 0, 0, 4))
+GL_TRACE_ENTRY(void, VertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer), (index, size, type, normalized, stride, pointer), "v.v.v.v.v.o.", '-', 0, (0, 0, 0, 0, 0, 0))
+GL_TRACE_ENTRY(void, Viewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), "v.v.v.v.", '-', 0, (0, 0, 0, 0))
+GL_TRACE_ENTRY(void, WaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), "nyv.v.", '-', 1, (0, 0, 0))
@@ -0,0 +1,823 @@
+#include "meshImport.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "mappedFile.h"
+
+// ********** JSON **********
+
+// Just enough JSON for glTF, objects keep their members in file order
+struct jsonValue
+{
+	enum kind { nullKind, boolKind, numberKind, stringKind, arrayKind, objectKind };
+
+	kind type = nullKind;
+	double number = 0.0;
+	bool boolean = false;
+	std::string text;
+	std::vector<jsonValue> items;
+	std::vector<std::pair<std::string, jsonValue>> members;
+
+	const jsonValue* get(const char* key) const
+	{
+		for (const std::pair<std::string, jsonValue>& member : members)
+		{
+			if (member.first == key)
+				return &member.second;
+		}
+		return nullptr;
+	}
+
+	const jsonValue* at(size_t index) const
+	{
+		return (type == arrayKind && index < items.size()) ? &items[index] : nullptr;
+	}
+
+	double numberOr(const char* key, double fallback) const
+	{
+		const jsonValue* value = get(key);
+		return (value && value->type == numberKind) ? value->number : fallback;
+	}
+
+	std::string textOr(const char* key, const char* fallback) const
+	{
+		const jsonValue* value = get(key);
+		return (value && value->type == stringKind) ? value->text : fallback;
+	}
+
+	// Counts, offsets and indices: a negative or huge double cast to size_t is undefined
+	bool isIndex() const
+	{
+		return type == numberKind && number >= 0.0 && number < 4294967296.0;
+	}
+
+	size_t sizeOr(const char* key, size_t fallback) const
+	{
+		const jsonValue* value = get(key);
+		return (value && value->isIndex()) ? (size_t)value->number : fallback;
+	}
+
+	// Element index of another glTF array, false when the member is missing or no index
+	bool indexOf(const char* key, size_t& out) const
+	{
+		const jsonValue* value = get(key);
+		if (!value || !value->isIndex())
+			return false;
+		out = (size_t)value->number;
+		return true;
+	}
+};
+
+class jsonParser
+{
+	public:
+		jsonParser(const char* text, size_t length) : s(text), end(text + length) {}
+
+		bool parse(jsonValue& root)
+		{
+			return value(root, 0) && (skip(), s == end);
+		}
+
+	private:
+		const char* s;
+		const char* end;
+
+		void skip()
+		{
+			while (s < end && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r'))
+				s++;
+		}
+
+		bool literal(const char* word)
+		{
+			size_t length = std::strlen(word);
+			if ((size_t)(end - s) < length || std::strncmp(s, word, length) != 0)
+				return false;
+			s += length;
+			return true;
+		}
+
+		static void appendUtf8(std::string& out, unsigned code)
+		{
+			if (code < 0x80)
+				out += (char)code;
+			else if (code < 0x800)
+			{
+				out += (char)(0xC0 | (code >> 6));
+				out += (char)(0x80 | (code & 0x3F));
+			}
+			else
+			{
+				out += (char)(0xE0 | (code >> 12));
+				out += (char)(0x80 | ((code >> 6) & 0x3F));
+				out += (char)(0x80 | (code & 0x3F));
+			}
+		}
+
+		bool string(std::string& out)
+		{
+			if (s >= end || *s != '"')
+				return false;
+			s++;
+
+			while (s < end && *s != '"')
+			{
+				if (*s != '\\')
+				{
+					out += *s++;
+					continue;
+				}
+
+				if (++s >= end)
+					return false;
+
+				switch (*s++)
+				{
+				case '"': out += '"'; break;
+				case '\\': out += '\\'; break;
+				case '/': out += '/'; break;
+				case 'b': out += '\b'; break;
+				case 'f': out += '\f'; break;
+				case 'n': out += '\n'; break;
+				case 'r': out += '\r'; break;
+				case 't': out += '\t'; break;
+				case 'u':
+				{
+					unsigned code = 0;
+					if (end - s < 4 || std::from_chars(s, s + 4, code, 16).ptr != s + 4)
+						return false;
+					appendUtf8(out, code);
+					s += 4;
+					break;
+				}
+				default:
+					return false;
+				}
+			}
+
+			if (s >= end)
+				return false;
+			s++;
+			return true;
+		}
+
+		bool value(jsonValue& out, int depth)
+		{
+			if (depth > 64)
+				return false;
+
+			skip();
+			if (s >= end)
+				return false;
+
+			switch (*s)
+			{
+			case '{':
+			{
+				out.type = jsonValue::objectKind;
+				s++;
+				skip();
+				if (s < end && *s == '}')
+				{
+					s++;
+					return true;
+				}
+
+				for (;;)
+				{
+					std::pair<std::string, jsonValue> member;
+					skip();
+					if (!string(member.first))
+						return false;
+					skip();
+					if (s >= end || *s++ != ':')
+						return false;
+					if (!value(member.second, depth + 1))
+						return false;
+					out.members.push_back(std::move(member));
+
+					skip();
+					if (s < end && *s == ',')
+					{
+						s++;
+						continue;
+					}
+					if (s < end && *s == '}')
+					{
+						s++;
+						return true;
+					}
+					return false;
+				}
+			}
+			case '[':
+			{
+				out.type = jsonValue::arrayKind;
+				s++;
+				skip();
+				if (s < end && *s == ']')
+				{
+					s++;
+					return true;
+				}
+
+				for (;;)
+				{
+					out.items.emplace_back();
+					if (!value(out.items.back(), depth + 1))
+						return false;
+
+					skip();
+					if (s < end && *s == ',')
+					{
+						s++;
+						continue;
+					}
+					if (s < end && *s == ']')
+					{
+						s++;
+						return true;
+					}
+					return false;
+				}
+			}
+			case '"':
+				out.type = jsonValue::stringKind;
+				return string(out.text);
+			case 't':
+				out.type = jsonValue::boolKind;
+				out.boolean = true;
+				return literal("true");
+			case 'f':
+				out.type = jsonValue::boolKind;
+				return literal("false");
+			case 'n':
+				return literal("null");
+			default:
+			{
+				char* stop = nullptr;
+				std::string number(s, (size_t)std::min<ptrdiff_t>(end - s, 64));
+				out.type = jsonValue::numberKind;
+				out.number = std::strtod(number.c_str(), &stop);
+				if (stop == number.c_str())
+					return false;
+				s += stop - number.c_str();
+				return true;
+			}
+			}
+		}
+};
+
+// ********** glTF **********
+
+struct gltfBuffer
+{
+	const unsigned char* data = nullptr;
+	size_t size = 0;
+};
+
+// Buffers either point into a mapped file or into decoded data URIs owned here
+struct gltfDocument
+{
+	jsonValue json;
+	std::vector<gltfBuffer> buffers;
+	std::vector<std::unique_ptr<mappedFile>> files;
+	std::vector<std::vector<unsigned char>> decoded;
+};
+
+struct gltfAccessor
+{
+	const unsigned char* data = nullptr;
+	size_t count = 0;
+	size_t stride = 0;
+	int componentType = 0;
+	int components = 0;
+	bool normalized = false;
+};
+
+static int componentSize(int componentType)
+{
+	switch (componentType)
+	{
+	case 5120: case 5121: return 1;
+	case 5122: case 5123: return 2;
+	case 5125: case 5126: return 4;
+	default: return 0;
+	}
+}
+
+static int typeComponents(const std::string& type)
+{
+	if (type == "SCALAR") return 1;
+	if (type == "VEC2") return 2;
+	if (type == "VEC3") return 3;
+	if (type == "VEC4") return 4;
+	if (type == "MAT4") return 16;
+	return 0;
+}
+
+static bool decodeBase64(const char* s, size_t length, std::vector<unsigned char>& out)
+{
+	unsigned value = 0;
+	int bits = 0;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		char c = s[i];
+		int digit;
+		if (c >= 'A' && c <= 'Z') digit = c - 'A';
+		else if (c >= 'a' && c <= 'z') digit = c - 'a' + 26;
+		else if (c >= '0' && c <= '9') digit = c - '0' + 52;
+		else if (c == '+' || c == '-') digit = 62;
+		else if (c == '/' || c == '_') digit = 63;
+		else if (c == '=') break;
+		else return false;
+
+		value = (value << 6) | (unsigned)digit;
+		bits += 6;
+		if (bits >= 8)
+		{
+			bits -= 8;
+			out.push_back((unsigned char)((value >> bits) & 0xFF));
+		}
+	}
+	return true;
+}
+
+static bool decodeUri(const std::string& uri, std::string& out)
+{
+	for (size_t i = 0; i < uri.size(); i++)
+	{
+		if (uri[i] == '%' && i + 2 < uri.size())
+		{
+			unsigned code = 0;
+			if (std::from_chars(uri.data() + i + 1, uri.data() + i + 3, code, 16).ptr != uri.data() + i + 3)
+			{
+				std::cout << "ERROR::MESHIMPORT::GLTF_BAD_URI " << uri << std::endl;
+				return false;
+			}
+			out += (char)code;
+			i += 2;
+		}
+		else
+			out += uri[i];
+	}
+	return true;
+}
+
+static bool loadBuffers(gltfDocument& doc, const std::string& directory, const gltfBuffer& glbChunk)
+{
+	const jsonValue* buffers = doc.json.get("buffers");
+	if (!buffers || buffers->type != jsonValue::arrayKind)
+		return true;
+
+	for (size_t i = 0; i < buffers->items.size(); i++)
+	{
+		const jsonValue& buffer = buffers->items[i];
+		const jsonValue* uri = buffer.get("uri");
+		gltfBuffer view;
+
+		if (!uri)
+		{
+			// The first buffer without a uri is the BIN chunk of a .glb
+			if (i != 0 || !glbChunk.data)
+				return false;
+			view = glbChunk;
+		}
+		else if (uri->text.compare(0, 5, "data:") == 0)
+		{
+			size_t comma = uri->text.find(',');
+			if (comma == std::string::npos)
+				return false;
+
+			doc.decoded.emplace_back();
+			if (!decodeBase64(uri->text.data() + comma + 1, uri->text.size() - comma - 1, doc.decoded.back()))
+				return false;
+			view.data = doc.decoded.back().data();
+			view.size = doc.decoded.back().size();
+		}
+		else
+		{
+			std::string path = directory;
+			if (!decodeUri(uri->text, path))
+				return false;
+			doc.files.emplace_back(new mappedFile(path.c_str()));
+			if (!doc.files.back()->valid())
+			{
+				std::cout << "ERROR::MESHIMPORT::GLTF_BUFFER_NOT_FOUND " << path << std::endl;
+				return false;
+			}
+			view.data = doc.files.back()->data();
+			view.size = (size_t)doc.files.back()->size();
+		}
+
+		size_t declared = buffer.sizeOr("byteLength", 0);
+		if (declared > view.size)
+			return false;
+		view.size = declared;
+		doc.buffers.push_back(view);
+	}
+
+	return true;
+}
+
+// Resolves accessor -> bufferView -> buffer and checks every element lies inside the buffer
+static bool resolveAccessor(const gltfDocument& doc, const jsonValue* index, gltfAccessor& out)
+{
+	if (!index || !index->isIndex())
+		return false;
+
+	const jsonValue* accessors = doc.json.get("accessors");
+	const jsonValue* accessor = accessors ? accessors->at((size_t)index->number) : nullptr;
+	if (!accessor)
+		return false;
+
+	if (accessor->get("sparse"))
+	{
+		std::cout << "ERROR::MESHIMPORT::GLTF_SPARSE_ACCESSORS_UNSUPPORTED" << std::endl;
+		return false;
+	}
+
+	out.count = accessor->sizeOr("count", 0);
+	out.componentType = (int)accessor->sizeOr("componentType", 0);
+	out.components = typeComponents(accessor->textOr("type", ""));
+	const jsonValue* normalized = accessor->get("normalized");
+	out.normalized = normalized && normalized->boolean;
+
+	size_t elementSize = (size_t)componentSize(out.componentType) * out.components;
+	if (elementSize == 0)
+		return false;
+
+	size_t viewIndex = 0;
+	const jsonValue* views = doc.json.get("bufferViews");
+	const jsonValue* view = (views && accessor->indexOf("bufferView", viewIndex)) ? views->at(viewIndex) : nullptr;
+	if (!view)
+		return false;
+
+	size_t bufferIndex = 0;
+	if (!view->indexOf("buffer", bufferIndex) || bufferIndex >= doc.buffers.size())
+		return false;
+
+	const gltfBuffer& buffer = doc.buffers[bufferIndex];
+	size_t viewOffset = view->sizeOr("byteOffset", 0);
+	size_t viewLength = view->sizeOr("byteLength", 0);
+	size_t accessorOffset = accessor->sizeOr("byteOffset", 0);
+	out.stride = view->sizeOr("byteStride", 0);
+	if (out.stride == 0)
+		out.stride = elementSize;
+
+	if (viewOffset > buffer.size || viewLength > buffer.size - viewOffset)
+		return false;
+	if (out.count > 0 && accessorOffset + out.stride * (out.count - 1) + elementSize > viewLength)
+		return false;
+
+	out.data = buffer.data + viewOffset + accessorOffset;
+	return true;
+}
+
+static float readComponent(const gltfAccessor& a, size_t element, int component)
+{
+	const unsigned char* p = a.data + element * a.stride + (size_t)component * componentSize(a.componentType);
+
+	switch (a.componentType)
+	{
+	case 5126: { float v; std::memcpy(&v, p, 4); return v; }
+	case 5121: return a.normalized ? *p / 255.0f : (float)*p;
+	case 5120: { signed char v = (signed char)*p; return a.normalized ? std::max(v / 127.0f, -1.0f) : (float)v; }
+	case 5123: { uint16_t v; std::memcpy(&v, p, 2); return a.normalized ? v / 65535.0f : (float)v; }
+	case 5122: { int16_t v; std::memcpy(&v, p, 2); return a.normalized ? std::max(v / 32767.0f, -1.0f) : (float)v; }
+	case 5125: { uint32_t v; std::memcpy(&v, p, 4); return (float)v; }
+	default: return 0.0f;
+	}
+}
+
+static uint32_t readIndex(const gltfAccessor& a, size_t element)
+{
+	const unsigned char* p = a.data + element * a.stride;
+
+	switch (a.componentType)
+	{
+	case 5121: return *p;
+	case 5123: { uint16_t v; std::memcpy(&v, p, 2); return v; }
+	case 5125: { uint32_t v; std::memcpy(&v, p, 4); return v; }
+	default: return 0;
+	}
+}
+
+static glm::mat4 nodeMatrix(const jsonValue& node)
+{
+	glm::mat4 m(1.0f);
+
+	const jsonValue* matrix = node.get("matrix");
+	if (matrix && matrix->items.size() == 16)
+	{
+		for (int i = 0; i < 16; i++)
+			m[i / 4][i % 4] = (float)matrix->items[i].number;
+		return m;
+	}
+
+	const jsonValue* t = node.get("translation");
+	const jsonValue* r = node.get("rotation");
+	const jsonValue* s = node.get("scale");
+
+	if (t && t->items.size() == 3)
+		m = glm::translate(m, glm::vec3((float)t->items[0].number, (float)t->items[1].number, (float)t->items[2].number));
+
+	if (r && r->items.size() == 4)
+	{
+		float x = (float)r->items[0].number, y = (float)r->items[1].number, z = (float)r->items[2].number, w = (float)r->items[3].number;
+		glm::mat4 rotation(1.0f);
+		rotation[0] = glm::vec4(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w), 0.0f);
+		rotation[1] = glm::vec4(2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w), 0.0f);
+		rotation[2] = glm::vec4(2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y), 0.0f);
+		m = m * rotation;
+	}
+
+	if (s && s->items.size() == 3)
+		m = glm::scale(m, glm::vec3((float)s->items[0].number, (float)s->items[1].number, (float)s->items[2].number));
+
+	return m;
+}
+
+struct gltfDraw
+{
+	const jsonValue* primitive;
+	glm::mat4 world;
+};
+
+static void collectDraws(const gltfDocument& doc, size_t nodeIndex, const glm::mat4& parent, std::vector<gltfDraw>& draws, int depth)
+{
+	const jsonValue* nodes = doc.json.get("nodes");
+	const jsonValue* node = nodes ? nodes->at(nodeIndex) : nullptr;
+	if (!node || depth > 256)
+		return;
+
+	glm::mat4 world = parent * nodeMatrix(*node);
+
+	size_t meshIndex = 0;
+	const jsonValue* meshes = doc.json.get("meshes");
+	const jsonValue* mesh = (meshes && node->indexOf("mesh", meshIndex)) ? meshes->at(meshIndex) : nullptr;
+	const jsonValue* primitives = mesh ? mesh->get("primitives") : nullptr;
+	if (primitives)
+	{
+		for (const jsonValue& primitive : primitives->items)
+			draws.push_back({ &primitive, world });
+	}
+
+	const jsonValue* children = node->get("children");
+	if (children)
+	{
+		for (const jsonValue& child : children->items)
+			if (child.isIndex())
+				collectDraws(doc, (size_t)child.number, world, draws, depth + 1);
+	}
+}
+
+// Hash of the raw bits of one interleaved vertex, for welding identical vertices
+struct vertexKey
+{
+	float v[importedMesh::floatsPerVertex];
+
+	bool operator==(const vertexKey& other) const
+	{
+		return std::memcmp(v, other.v, sizeof(v)) == 0;
+	}
+};
+
+struct vertexKeyHash
+{
+	size_t operator()(const vertexKey& key) const
+	{
+		uint32_t bits[importedMesh::floatsPerVertex];
+		std::memcpy(bits, key.v, sizeof(bits));
+
+		uint64_t h = 0xCBF29CE484222325ull;
+		for (uint32_t b : bits)
+			h = (h ^ b) * 0x100000001B3ull;
+		return (size_t)h;
+	}
+};
+
+// Reads one triangle primitive into its own welded vertex and index lists
+static bool readPrimitive(const gltfDocument& doc, const gltfDraw& draw, std::vector<float>& vertices, std::vector<uint32_t>& indices, size_t& corners)
+{
+	const jsonValue& primitive = *draw.primitive;
+	if (primitive.sizeOr("mode", 4) != 4)
+		return true;
+
+	const jsonValue* attributes = primitive.get("attributes");
+	const jsonValue* position = attributes ? attributes->get("POSITION") : nullptr;
+	if (!position)
+		return true;
+
+	gltfAccessor positions, normals, texcoords, indexList;
+	if (!resolveAccessor(doc, position, positions) || positions.components != 3)
+		return false;
+
+	const jsonValue* normal = attributes->get("NORMAL");
+	bool hasNormals = resolveAccessor(doc, normal, normals) && normals.components == 3 && normals.count == positions.count;
+
+	const jsonValue* texcoord = attributes->get("TEXCOORD_0");
+	bool hasTexcoords = resolveAccessor(doc, texcoord, texcoords) && texcoords.components == 2 && texcoords.count == positions.count;
+
+	const jsonValue* indexAccessor = primitive.get("indices");
+	bool indexed = indexAccessor != nullptr;
+	if (indexed && (!resolveAccessor(doc, indexAccessor, indexList) || indexList.components != 1))
+		return false;
+
+	glm::mat3 normalMatrix = glm::mat3(glm::transpose(glm::inverse(draw.world)));
+
+	std::unordered_map<vertexKey, uint32_t, vertexKeyHash> welded;
+	std::vector<uint32_t> remap(positions.count);
+
+	for (size_t i = 0; i < positions.count; i++)
+	{
+		vertexKey key;
+
+		glm::vec4 p = draw.world * glm::vec4(readComponent(positions, i, 0), readComponent(positions, i, 1), readComponent(positions, i, 2), 1.0f);
+		key.v[0] = p.x;
+		key.v[1] = p.y;
+		key.v[2] = p.z;
+
+		glm::vec3 n(0.0f);
+		if (hasNormals)
+		{
+			n = normalMatrix * glm::vec3(readComponent(normals, i, 0), readComponent(normals, i, 1), readComponent(normals, i, 2));
+			float length = glm::length(n);
+			if (length > 0.0f)
+				n = n / length;
+		}
+		key.v[3] = n.x;
+		key.v[4] = n.y;
+		key.v[5] = n.z;
+
+		key.v[6] = hasTexcoords ? readComponent(texcoords, i, 0) : 0.0f;
+		key.v[7] = hasTexcoords ? readComponent(texcoords, i, 1) : 0.0f;
+
+		auto inserted = welded.emplace(key, (uint32_t)(vertices.size() / importedMesh::floatsPerVertex));
+		if (inserted.second)
+			vertices.insert(vertices.end(), key.v, key.v + importedMesh::floatsPerVertex);
+		remap[i] = inserted.first->second;
+	}
+
+	size_t count = indexed ? indexList.count : positions.count;
+	count -= count % 3;
+	corners += count;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		uint32_t index = indexed ? readIndex(indexList, i) : (uint32_t)i;
+		if (index >= positions.count)
+			return false;
+		indices.push_back(remap[index]);
+	}
+
+	if (!hasNormals)
+		smoothNormals(vertices.data(), vertices.size() / importedMesh::floatsPerVertex, indices.data(), indices.size());
+
+	return true;
+}
+
+bool importGLTF(const char* path, importedMesh& mesh, jobSystem& jobs)
+{
+	mesh.vertices.clear();
+	mesh.indices.clear();
+	mesh.sourceCorners = 0;
+	mesh.lods = lodChain();
+	mesh.meshlets = meshletSet();
+
+	mappedFile file(path);
+	if (!file.valid())
+	{
+		std::cout << "ERROR::MESHIMPORT::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+		return false;
+	}
+
+	std::string name = path;
+	size_t slash = name.find_last_of("/\\");
+	std::string directory = slash == std::string::npos ? "" : name.substr(0, slash + 1);
+
+	const unsigned char* data = file.data();
+	size_t size = (size_t)file.size();
+
+	const char* jsonText = (const char*)data;
+	size_t jsonLength = size;
+	gltfBuffer binChunk;
+
+	// .glb: 12 byte header, then a JSON chunk and an optional BIN chunk
+	uint32_t header[3] = { 0, 0, 0 };
+	if (size >= 12)
+		std::memcpy(header, data, 12);
+
+	if (header[0] == 0x46546C67)
+	{
+		if (header[1] != 2 || header[2] > size || size < 20)
+		{
+			std::cout << "ERROR::MESHIMPORT::GLB_HEADER " << path << std::endl;
+			return false;
+		}
+
+		size_t offset = 12;
+		while (offset + 8 <= header[2])
+		{
+			uint32_t chunk[2];
+			std::memcpy(chunk, data + offset, 8);
+			offset += 8;
+			if (chunk[0] > header[2] - offset)
+				break;
+
+			if (chunk[1] == 0x4E4F534A)
+			{
+				jsonText = (const char*)data + offset;
+				jsonLength = chunk[0];
+			}
+			else if (chunk[1] == 0x004E4942)
+			{
+				binChunk.data = data + offset;
+				binChunk.size = chunk[0];
+			}
+			offset += chunk[0];
+		}
+	}
+
+	gltfDocument doc;
+	jsonParser parser(jsonText, jsonLength);
+	if (!parser.parse(doc.json) || doc.json.type != jsonValue::objectKind)
+	{
+		std::cout << "ERROR::MESHIMPORT::GLTF_JSON " << path << std::endl;
+		return false;
+	}
+
+	if (!loadBuffers(doc, directory, binChunk))
+	{
+		std::cout << "ERROR::MESHIMPORT::GLTF_BUFFERS " << path << std::endl;
+		return false;
+	}
+
+	// Default scene, or every root of every scene, or every mesh untransformed
+	std::vector<gltfDraw> draws;
+	const jsonValue* scenes = doc.json.get("scenes");
+	size_t sceneIndex = 0;
+	doc.json.indexOf("scene", sceneIndex);
+	const jsonValue* scene = scenes ? scenes->at(sceneIndex) : nullptr;
+	const jsonValue* roots = scene ? scene->get("nodes") : nullptr;
+
+	if (roots)
+	{
+		for (const jsonValue& root : roots->items)
+			if (root.isIndex())
+				collectDraws(doc, (size_t)root.number, glm::mat4(1.0f), draws, 0);
+	}
+	else if (const jsonValue* meshes = doc.json.get("meshes"))
+	{
+		for (const jsonValue& m : meshes->items)
+		{
+			if (const jsonValue* primitives = m.get("primitives"))
+				for (const jsonValue& primitive : primitives->items)
+					draws.push_back({ &primitive, glm::mat4(1.0f) });
+		}
+	}
+
+	struct primitiveResult
+	{
+		std::vector<float> vertices;
+		std::vector<uint32_t> indices;
+		size_t corners = 0;
+		bool ok = true;
+	};
+
+	std::vector<primitiveResult> results(draws.size());
+	jobs.parallelFor(draws.size(), [&](size_t begin, size_t stop)
+	{
+		for (size_t i = begin; i < stop; i++)
+			results[i].ok = readPrimitive(doc, draws[i], results[i].vertices, results[i].indices, results[i].corners);
+	});
+
+	for (primitiveResult& result : results)
+	{
+		if (!result.ok)
+		{
+			std::cout << "ERROR::MESHIMPORT::GLTF_ACCESSOR " << path << std::endl;
+			return false;
+		}
+
+		uint32_t base = mesh.vertexCount();
+		mesh.vertices.insert(mesh.vertices.end(), result.vertices.begin(), result.vertices.end());
+		for (uint32_t index : result.indices)
+			mesh.indices.push_back(base + index);
+		mesh.sourceCorners += result.corners;
+	}
+
+	return true;
+}
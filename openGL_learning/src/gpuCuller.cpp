@@ -0,0 +1,356 @@
+#include "gpuCuller.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtc/type_ptr.hpp>
+
+#include "EBO.h"
+#include "glModern.h"
+#include "gpuMemory.h"
+#include "profiler.h"
+
+gpuCuller::gpuCuller(const char* cullPath, const char* pyramidPath)
+{
+	if (!glModern.compute)
+		return;
+
+	cullProgram.reset(new shader(cullPath));
+	pyramidProgram.reset(new shader(pyramidPath));
+
+	viewProjectionLocation = glGetUniformLocation(cullProgram->ID, "viewProjection");
+	cameraPositionLocation = glGetUniformLocation(cullProgram->ID, "cameraPosition");
+	objectCountLocation = glGetUniformLocation(cullProgram->ID, "objectCount");
+	compactLocation = glGetUniformLocation(cullProgram->ID, "compact");
+	useHiZLocation = glGetUniformLocation(cullProgram->ID, "useHiZ");
+	depthPyramidLocation = glGetUniformLocation(cullProgram->ID, "depthPyramid");
+	pyramidSizeLocation = glGetUniformLocation(cullProgram->ID, "pyramidSize");
+	pyramidLevelsLocation = glGetUniformLocation(cullProgram->ID, "pyramidLevels");
+
+	sourceLocation = glGetUniformLocation(pyramidProgram->ID, "source");
+	sourceLevelLocation = glGetUniformLocation(pyramidProgram->ID, "sourceLevel");
+	sourceSizeLocation = glGetUniformLocation(pyramidProgram->ID, "sourceSize");
+
+	GLuint buffers[5];
+	glGenBuffers(5, buffers);
+	objectBuffer = buffers[0];
+	meshBuffer = buffers[1];
+	commandBuffer = buffers[2];
+	visibleBuffer = buffers[3];
+	counterBuffer = buffers[4];
+
+	GLuint zero = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, counterBuffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GLuint), &zero, GL_DYNAMIC_DRAW);
+	gpuMemoryAllocate(gpuMemoryUniform, GL_BUFFER, counterBuffer, sizeof(GLuint), "gpuCuller counter");
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+bool gpuCuller::gpuDriven() const
+{
+	return cullProgram != nullptr;
+}
+
+uint32_t gpuCuller::addMesh(GLuint indexCount, GLuint firstIndex, GLint baseVertex)
+{
+	meshes.push_back({ indexCount, firstIndex, baseVertex, 0 });
+	meshesDirty = true;
+	return (uint32_t)(meshes.size() - 1);
+}
+
+uint32_t gpuCuller::addObject(uint32_t mesh, const glm::mat4& model, const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+{
+	uint32_t object = (uint32_t)objects.size();
+	objects.push_back({ model, boundsMin, mesh, boundsMax, 0, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f) });
+	spheres.push_back(glm::vec4(0.0f));
+	updateSphere(object);
+
+	dirtyBegin = std::min(dirtyBegin, (size_t)object);
+	dirtyEnd = objects.size();
+	return object;
+}
+
+uint32_t gpuCuller::addMeshlets(const meshletSet& set, GLuint firstIndex, GLint baseVertex, const glm::mat4& model)
+{
+	uint32_t first = (uint32_t)objects.size();
+	for (const meshlet& m : set.meshlets)
+	{
+		// A cube around the sphere, so the cull shader gets the radius back from its width
+		uint32_t object = addObject(addMesh(m.indexCount, firstIndex + m.indexOffset, baseVertex), model, m.centre - glm::vec3(m.radius), m.centre + glm::vec3(m.radius));
+		objects[object].cone = glm::vec4(m.coneAxis, m.coneCutoff);
+	}
+	return first;
+}
+
+void gpuCuller::setModel(uint32_t object, const glm::mat4& model)
+{
+	objects[object].model = model;
+	updateSphere(object);
+
+	// One range covering every change, moving objects tend to be next to each other
+	if (dirtyBegin >= dirtyEnd)
+	{
+		dirtyBegin = object;
+		dirtyEnd = object + 1;
+	}
+	else
+	{
+		dirtyBegin = std::min(dirtyBegin, (size_t)object);
+		dirtyEnd = std::max(dirtyEnd, (size_t)object + 1);
+	}
+}
+
+size_t gpuCuller::objectCount() const
+{
+	return objects.size();
+}
+
+void gpuCuller::updateSphere(uint32_t object)
+{
+	const gpuObject& o = objects[object];
+	glm::vec3 centre = glm::vec3(o.model * glm::vec4((o.boundsMin + o.boundsMax) * 0.5f, 1.0f));
+
+	float scale = std::max(glm::length(glm::vec3(o.model[0])), std::max(glm::length(glm::vec3(o.model[1])), glm::length(glm::vec3(o.model[2]))));
+	spheres[object] = glm::vec4(centre, glm::length(o.boundsMax - o.boundsMin) * 0.5f * scale);
+}
+
+void gpuCuller::linkObjectAttribute(GLuint location)
+{
+	if (!gpuDriven())
+		return;
+
+	glBindBuffer(GL_ARRAY_BUFFER, visibleBuffer);
+	glVertexAttribIPointer(location, 1, GL_UNSIGNED_INT, sizeof(GLuint), (void*)0);
+	glVertexAttribDivisor(location, 1);
+	glEnableVertexAttribArray(location);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void gpuCuller::upload()
+{
+	if (objects.size() > objectCapacity)
+	{
+		objectCapacity = std::max(objects.size(), objectCapacity * 2);
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, objectBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, objectCapacity * sizeof(gpuObject), nullptr, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, commandBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, objectCapacity * sizeof(drawElementsIndirectCommand), nullptr, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, visibleBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, objectCapacity * sizeof(GLuint), nullptr, GL_DYNAMIC_DRAW);
+		gpuMemoryAllocate(gpuMemoryUniform, GL_BUFFER, objectBuffer, objectCapacity * sizeof(gpuObject), "gpuCuller objects");
+		gpuMemoryAllocate(gpuMemoryUniform, GL_BUFFER, commandBuffer, objectCapacity * sizeof(drawElementsIndirectCommand), "gpuCuller commands");
+		gpuMemoryAllocate(gpuMemoryUniform, GL_BUFFER, visibleBuffer, objectCapacity * sizeof(GLuint), "gpuCuller visible");
+
+		dirtyBegin = 0;
+		dirtyEnd = objects.size();
+	}
+
+	if (dirtyBegin < dirtyEnd)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, objectBuffer);
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, dirtyBegin * sizeof(gpuObject), (dirtyEnd - dirtyBegin) * sizeof(gpuObject), &objects[dirtyBegin]);
+		dirtyBegin = objects.size();
+		dirtyEnd = 0;
+	}
+
+	if (meshesDirty)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, meshBuffer);
+		if (meshes.size() > meshCapacity)
+		{
+			meshCapacity = std::max(meshes.size(), meshCapacity * 2);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, meshCapacity * sizeof(gpuMesh), nullptr, GL_STATIC_DRAW);
+			gpuMemoryAllocate(gpuMemoryUniform, GL_BUFFER, meshBuffer, meshCapacity * sizeof(gpuMesh), "gpuCuller meshes");
+		}
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, meshes.size() * sizeof(gpuMesh), meshes.data());
+		meshesDirty = false;
+	}
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void gpuCuller::buildDepthPyramid(GLuint depthTexture, int width, int height)
+{
+	if (!gpuDriven() || width < 2 || height < 2)
+		return;
+
+	// Level 0 is half the depth buffer, every further level halves again down to 1x1
+	int levelWidth = width / 2, levelHeight = height / 2;
+	if (levelWidth != pyramidWidth || levelHeight != pyramidHeight)
+	{
+		if (pyramid == 0)
+			glGenTextures(1, &pyramid);
+
+		pyramidWidth = levelWidth;
+		pyramidHeight = levelHeight;
+		pyramidLevels = 1;
+		while ((std::max(pyramidWidth, pyramidHeight) >> pyramidLevels) > 0)
+			pyramidLevels++;
+
+		size_t pyramidBytes = 0;
+		glBindTexture(GL_TEXTURE_2D, pyramid);
+		for (int level = 0; level < pyramidLevels; level++)
+		{
+			int w = std::max(pyramidWidth >> level, 1), h = std::max(pyramidHeight >> level, 1);
+			glTexImage2D(GL_TEXTURE_2D, level, GL_R32F, w, h, 0, GL_RED, GL_FLOAT, nullptr);
+			pyramidBytes += (size_t)w * h * 4;
+		}
+		gpuMemoryAllocate(gpuMemoryRenderTarget, GL_TEXTURE, pyramid, pyramidBytes, "gpuCuller depth pyramid");
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, pyramidLevels - 1);
+	}
+
+	pyramidProgram->use();
+	glUniform1i(sourceLocation, 0);
+	glActiveTexture(GL_TEXTURE0);
+
+	int sourceWidth = width, sourceHeight = height;
+	for (int level = 0; level < pyramidLevels; level++)
+	{
+		int destinationWidth = std::max(pyramidWidth >> level, 1);
+		int destinationHeight = std::max(pyramidHeight >> level, 1);
+
+		glBindTexture(GL_TEXTURE_2D, level == 0 ? depthTexture : pyramid);
+		glUniform1i(sourceLevelLocation, level == 0 ? 0 : level - 1);
+		glUniform2i(sourceSizeLocation, sourceWidth, sourceHeight);
+		glModern.bindImageTexture(0, pyramid, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+
+		glModern.dispatchCompute((GLuint)(destinationWidth + 7) / 8, (GLuint)(destinationHeight + 7) / 8, 1);
+		glModern.memoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+		sourceWidth = destinationWidth;
+		sourceHeight = destinationHeight;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void gpuCuller::cull(const glm::mat4& viewProjection, const glm::vec3& cameraPosition)
+{
+	PROFILE_SCOPE("gpuCuller::cull");
+
+	if (!gpuDriven())
+		return;
+
+	upload();
+	if (objects.empty())
+		return;
+
+	GLuint zero = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, counterBuffer);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), &zero);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	cullProgram->use();
+	glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
+	glUniform3fv(cameraPositionLocation, 1, glm::value_ptr(cameraPosition));
+	glUniform1ui(objectCountLocation, (GLuint)objects.size());
+	glUniform1i(compactLocation, glModern.indirectCount ? 1 : 0);
+	glUniform1i(useHiZLocation, pyramidLevels > 0 ? 1 : 0);
+
+	if (pyramidLevels > 0)
+	{
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, pyramid);
+		glUniform1i(depthPyramidLocation, 0);
+		glUniform2i(pyramidSizeLocation, pyramidWidth, pyramidHeight);
+		glUniform1i(pyramidLevelsLocation, pyramidLevels);
+	}
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, objectBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, meshBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, commandBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, visibleBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, counterBuffer);
+
+	glModern.dispatchCompute((GLuint)((objects.size() + 63) / 64), 1, 1);
+
+	// Commands, the draw count and the object attribute are all read by the draw
+	glModern.memoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+}
+
+void gpuCuller::draw(GLenum indexType)
+{
+	if (!gpuDriven() || objects.empty())
+		return;
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, objectBuffer);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+
+	if (glModern.indirectCount)
+	{
+		glBindBuffer(GL_PARAMETER_BUFFER, counterBuffer);
+		glModern.multiDrawElementsIndirectCount(GL_TRIANGLES, indexType, (void*)0, 0, (GLsizei)objects.size(), 0);
+		glBindBuffer(GL_PARAMETER_BUFFER, 0);
+	}
+	else
+	{
+		glModern.multiDrawElementsIndirect(GL_TRIANGLES, indexType, (void*)0, (GLsizei)objects.size(), 0);
+	}
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void gpuCuller::drawFallback(const glm::mat4& viewProjection, GLint modelLocation, GLenum indexType)
+{
+	// Frustum planes straight from the rows of the matrix
+	glm::vec4 planes[6];
+	for (int i = 0; i < 3; i++)
+	{
+		glm::vec4 row(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+		glm::vec4 w(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+		planes[i * 2] = w + row;
+		planes[i * 2 + 1] = w - row;
+	}
+	for (glm::vec4& plane : planes)
+		plane /= glm::length(glm::vec3(plane));
+
+	lastDrawn = 0;
+	for (size_t i = 0; i < objects.size(); i++)
+	{
+		const glm::vec4& sphere = spheres[i];
+		bool outside = false;
+		for (const glm::vec4& plane : planes)
+		{
+			if (glm::dot(glm::vec3(plane), glm::vec3(sphere)) + plane.w < -sphere.w)
+			{
+				outside = true;
+				break;
+			}
+		}
+		if (outside)
+			continue;
+
+		const gpuMesh& mesh = meshes[objects[i].mesh];
+		glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(objects[i].model));
+		glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)mesh.indexCount, indexType,
+			(void*)((size_t)mesh.firstIndex * EBO::typeSize(indexType)), mesh.baseVertex);
+		lastDrawn++;
+	}
+}
+
+void gpuCuller::del()
+{
+	if (cullProgram)
+	{
+		cullProgram->del();
+		pyramidProgram->del();
+
+		GLuint buffers[5] = { objectBuffer, meshBuffer, commandBuffer, visibleBuffer, counterBuffer };
+		for (GLuint buffer : buffers)
+			gpuMemoryRelease(GL_BUFFER, buffer);
+		glDeleteBuffers(5, buffers);
+	}
+	if (pyramid != 0)
+	{
+		gpuMemoryRelease(GL_TEXTURE, pyramid);
+		glDeleteTextures(1, &pyramid);
+	}
+
+	pyramid = 0;
+	pyramidLevels = 0;
+	pyramidWidth = 0;
+	pyramidHeight = 0;
+}
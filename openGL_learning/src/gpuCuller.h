@@ -0,0 +1,152 @@
+#pragma once
+
+#ifndef GPU_CULLER_CLASS
+#define GPU_CULLER_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "meshlet.h"
+#include "shader.h"
+
+/*
+	GPU driven culling and submission, GL 4.3+.
+
+	All meshes share one VAO / EBO, a mesh is a range of it. Objects (model matrix, local
+	box, mesh) live in a shader storage buffer, only the ones that changed are re-uploaded.
+	Every frame:
+
+		culler.buildDepthPyramid(depthTexture, width, height); // last frame's depth, optional
+		culler.cull(projection * view, cam.position);          // compute pass writes the draws
+		vao.bind();
+		culler.draw(ebo.indexType());                          // one multi draw for the scene
+
+	The compute pass (shaders/gpuCull.comp) tests every object box against the frustum and
+	the Hi-Z pyramid and writes a DrawElementsIndirectCommand per survivor. With
+	glMultiDrawElementsIndirectCount the commands are compacted and the count stays on the
+	GPU, otherwise every object keeps its slot and culled ones have instanceCount 0.
+
+	Big meshes can go in as their meshlets (addMeshlets), one object per cluster. Those are
+	culled one by one, and their normal cone drops clusters facing away from the camera.
+
+	The vertex shader (shaders/gpuDriven.vert) reads its model matrix from the object buffer
+	through a per instance attribute, see linkObjectAttribute.
+
+	Without GL 4.3 (gpuDriven() is false) drawFallback tests spheres on the CPU and issues
+	one glDrawElementsBaseVertex per visible object with the model as a uniform.
+*/
+
+struct drawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+class gpuCuller
+{
+	public:
+		// Objects drawn by the last drawFallback, the GPU path never reads its count back
+		size_t lastDrawn = 0;
+
+		gpuCuller(const char* cullPath, const char* pyramidPath);
+
+		bool gpuDriven() const;
+
+		// indexCount indices from firstIndex in the shared EBO, baseVertex added to each
+		uint32_t addMesh(GLuint indexCount, GLuint firstIndex, GLint baseVertex);
+		// Box in the mesh's own space
+		uint32_t addObject(uint32_t mesh, const glm::mat4& model, const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+		// One mesh and object per meshlet of a mesh whose indices start at firstIndex, returns
+		// the first object, the others follow it. Scaling in model has to be uniform
+		uint32_t addMeshlets(const meshletSet& set, GLuint firstIndex, GLint baseVertex, const glm::mat4& model);
+		void setModel(uint32_t object, const glm::mat4& model);
+		size_t objectCount() const;
+
+		// With the scene VAO bound: the per instance object index gpuDriven.vert reads
+		void linkObjectAttribute(GLuint location = 5);
+
+		// Downsamples a depth texture into the Hi-Z pyramid, the Hi-Z test is off until the
+		// first call. Last frame's depth with this frame's matrices, so objects that just came
+		// out from behind an occluder can show up a frame late.
+		void buildDepthPyramid(GLuint depthTexture, int width, int height);
+
+		// The camera position is for the meshlet cone test
+		void cull(const glm::mat4& viewProjection, const glm::vec3& cameraPosition);
+		void draw(GLenum indexType);
+
+		void drawFallback(const glm::mat4& viewProjection, GLint modelLocation, GLenum indexType);
+
+		void del();
+
+	private:
+		// std430 layout of objectData in the shaders
+		struct gpuObject
+		{
+			glm::mat4 model;
+			glm::vec3 boundsMin;
+			uint32_t mesh;
+			glm::vec3 boundsMax;
+			uint32_t pad;
+			// Meshlet normal cone, axis and cutoff (meshlet.h). A cutoff of 1 never culls
+			glm::vec4 cone;
+		};
+
+		struct gpuMesh
+		{
+			GLuint indexCount;
+			GLuint firstIndex;
+			GLint baseVertex;
+			GLuint pad;
+		};
+
+		// Only built on a 4.3 context
+		std::unique_ptr<shader> cullProgram;
+		std::unique_ptr<shader> pyramidProgram;
+
+		std::vector<gpuObject> objects;
+		std::vector<gpuMesh> meshes;
+		// World space bounding spheres for drawFallback
+		std::vector<glm::vec4> spheres;
+
+		GLuint objectBuffer = 0;
+		GLuint meshBuffer = 0;
+		GLuint commandBuffer = 0;
+		GLuint visibleBuffer = 0;
+		GLuint counterBuffer = 0;
+		size_t objectCapacity = 0;
+		size_t meshCapacity = 0;
+		size_t dirtyBegin = 0;
+		size_t dirtyEnd = 0;
+		bool meshesDirty = false;
+
+		GLuint pyramid = 0;
+		int pyramidWidth = 0;
+		int pyramidHeight = 0;
+		int pyramidLevels = 0;
+
+		GLint viewProjectionLocation = -1;
+		GLint cameraPositionLocation = -1;
+		GLint objectCountLocation = -1;
+		GLint compactLocation = -1;
+		GLint useHiZLocation = -1;
+		GLint depthPyramidLocation = -1;
+		GLint pyramidSizeLocation = -1;
+		GLint pyramidLevelsLocation = -1;
+		GLint sourceLocation = -1;
+		GLint sourceLevelLocation = -1;
+		GLint sourceSizeLocation = -1;
+
+		void upload();
+		void updateSphere(uint32_t object);
+};
+
+#endif
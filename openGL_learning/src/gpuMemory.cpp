@@ -0,0 +1,135 @@
+#include "gpuMemory.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+
+#include "glModern.h"
+
+struct gpuAllocation
+{
+	gpuMemoryCategory category;
+	size_t bytes;
+	const char* label;
+};
+
+static std::unordered_map<uint64_t, gpuAllocation> allocations;
+static gpuMemoryUsage usage;
+
+static uint64_t allocationKey(GLenum objectType, GLuint name)
+{
+	return ((uint64_t)objectType << 32) | name;
+}
+
+void gpuMemoryAllocate(gpuMemoryCategory category, GLenum objectType, GLuint name, size_t bytes, const char* label)
+{
+	if (name == 0)
+		return;
+
+	gpuMemoryRelease(objectType, name);
+	allocations[allocationKey(objectType, name)] = { category, bytes, label };
+
+	usage.current[category] += bytes;
+	usage.allocations[category]++;
+	usage.currentTotal += bytes;
+	usage.peak[category] = std::max(usage.peak[category], usage.current[category]);
+	usage.peakTotal = std::max(usage.peakTotal, usage.currentTotal);
+}
+
+void gpuMemoryRelease(GLenum objectType, GLuint name)
+{
+	auto allocation = allocations.find(allocationKey(objectType, name));
+	if (allocation == allocations.end())
+		return;
+
+	const gpuAllocation& a = allocation->second;
+	usage.current[a.category] -= a.bytes;
+	usage.allocations[a.category]--;
+	usage.currentTotal -= a.bytes;
+	allocations.erase(allocation);
+}
+
+const gpuMemoryUsage& gpuMemoryCurrent()
+{
+	return usage;
+}
+
+const char* gpuMemoryCategoryName(gpuMemoryCategory category)
+{
+	switch (category)
+	{
+	case gpuMemoryVertex: return "vertex";
+	case gpuMemoryIndex: return "index";
+	case gpuMemoryUniform: return "uniform";
+	case gpuMemoryTexture: return "texture";
+	case gpuMemoryRenderTarget: return "render target";
+	default: return "unknown";
+	}
+}
+
+gpuMemoryCategory gpuMemoryBufferCategory(GLenum target)
+{
+	switch (target)
+	{
+	case GL_ELEMENT_ARRAY_BUFFER:
+		return gpuMemoryIndex;
+	case GL_UNIFORM_BUFFER:
+	case GL_SHADER_STORAGE_BUFFER:
+	case GL_DRAW_INDIRECT_BUFFER:
+		return gpuMemoryUniform;
+	default:
+		return gpuMemoryVertex;
+	}
+}
+
+size_t gpuMemoryFormatBytes(GLenum internalFormat)
+{
+	switch (internalFormat)
+	{
+	case GL_R8:
+		return 1;
+	case GL_RG8:
+	case GL_R16F:
+	case GL_DEPTH_COMPONENT16:
+		return 2;
+	// Three component formats are padded to four by every driver
+	case GL_RGB8:
+	case GL_RGBA8:
+	case GL_SRGB8_ALPHA8:
+	case GL_RGB10_A2:
+	case GL_R11F_G11F_B10F:
+	case GL_RG16F:
+	case GL_RG16_SNORM:
+	case GL_R32F:
+	case GL_DEPTH_COMPONENT24:
+	case GL_DEPTH_COMPONENT32F:
+	case GL_DEPTH24_STENCIL8:
+		return 4;
+	case GL_RGBA16F:
+	case GL_RG32F:
+	case GL_DEPTH32F_STENCIL8:
+		return 8;
+	case GL_RGBA32F:
+		return 16;
+	default:
+		std::cout << "ERROR::GPU_MEMORY::UNKNOWN_FORMAT " << internalFormat << std::endl;
+		return 4;
+	}
+}
+
+size_t gpuMemoryReportLeaks()
+{
+	std::cout << "GPU memory peak " << usage.peakTotal / 1024 << " KB:";
+	for (int i = 0; i < gpuMemoryCategoryCount; i++)
+		std::cout << " " << gpuMemoryCategoryName((gpuMemoryCategory)i) << " " << usage.peak[i] / 1024 << " KB";
+	std::cout << std::endl;
+
+	for (const auto& allocation : allocations)
+	{
+		const gpuAllocation& a = allocation.second;
+		std::cout << "ERROR::GPU_MEMORY::LEAK " << (a.label ? a.label : "?") << " (" << gpuMemoryCategoryName(a.category) << ", name "
+			<< (GLuint)allocation.first << ") " << a.bytes << " bytes" << std::endl;
+	}
+	return allocations.size();
+}
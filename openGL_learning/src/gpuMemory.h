@@ -0,0 +1,67 @@
+#pragma once
+
+#ifndef GPU_MEMORY_CLASS
+#define GPU_MEMORY_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+// GL 4.3 object identifier, only used here as a key
+#ifndef GL_BUFFER
+#define GL_BUFFER 0x82E0
+#endif
+
+/*
+	Ledger of the GPU memory the renderer allocates, by what it is for.
+
+	Every class that creates storage (VBO, EBO, bufferArena, the render targets of
+	deferredRenderer, dynamicResolution, renderGraph, shadowAtlas, gpuCuller) reports it here
+	under its GL name, and again when the storage is replaced (glBufferData on a live buffer,
+	a resize), then releases it when the object is deleted:
+
+		gpuMemoryAllocate(gpuMemoryVertex, GL_BUFFER, ID, size, "VBO");
+		...
+		gpuMemoryRelease(GL_BUFFER, ID);
+
+	Sizes are what was asked for, drivers add padding and mip tails on top.
+	gpuMemoryReportLeaks() at shutdown, after every object is gone, prints what is still
+	alive with the label it was allocated under.
+*/
+
+enum gpuMemoryCategory
+{
+	gpuMemoryVertex,
+	gpuMemoryIndex,
+	// Uniform, shader storage and indirect buffers
+	gpuMemoryUniform,
+	gpuMemoryTexture,
+	gpuMemoryRenderTarget,
+	gpuMemoryCategoryCount
+};
+
+struct gpuMemoryUsage
+{
+	size_t current[gpuMemoryCategoryCount] = {};
+	size_t peak[gpuMemoryCategoryCount] = {};
+	size_t allocations[gpuMemoryCategoryCount] = {};
+	size_t currentTotal = 0;
+	size_t peakTotal = 0;
+};
+
+// objectType is GL_BUFFER, GL_TEXTURE or GL_RENDERBUFFER, label is kept as a pointer
+void gpuMemoryAllocate(gpuMemoryCategory category, GLenum objectType, GLuint name, size_t bytes, const char* label);
+void gpuMemoryRelease(GLenum objectType, GLuint name);
+
+const gpuMemoryUsage& gpuMemoryCurrent();
+const char* gpuMemoryCategoryName(gpuMemoryCategory category);
+
+// Category of a buffer by the target it is made for
+gpuMemoryCategory gpuMemoryBufferCategory(GLenum target);
+// Bytes per texel of a sized internal format
+size_t gpuMemoryFormatBytes(GLenum internalFormat);
+
+// Prints usage and every allocation still alive, returns how many are
+size_t gpuMemoryReportLeaks();
+
+#endif
@@ -0,0 +1,156 @@
+#include "jobSystem.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "profiler.h"
+
+jobSystem::jobSystem(int threads)
+{
+	if (threads < 0)
+	{
+		unsigned hardware = std::thread::hardware_concurrency();
+		threads = hardware > 1 ? (int)hardware - 1 : 0;
+	}
+
+	for (int i = 0; i < threads; i++)
+		workers.emplace_back(&jobSystem::workerLoop, this);
+}
+
+jobSystem::~jobSystem()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	wake.notify_all();
+
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+unsigned jobSystem::concurrency() const
+{
+	return (unsigned)workers.size() + 1;
+}
+
+jobSystem& jobSystem::shared()
+{
+	static jobSystem pool;
+	return pool;
+}
+
+void jobSystem::submit(std::function<void()> job)
+{
+	if (workers.empty())
+	{
+		job();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		queue.push_back(std::move(job));
+	}
+	wake.notify_one();
+}
+
+// Pops and runs one queued job on the calling thread, false if the queue was empty
+bool jobSystem::runOne()
+{
+	std::function<void()> job;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (queue.empty())
+			return false;
+		job = std::move(queue.front());
+		queue.pop_front();
+	}
+
+	job();
+	return true;
+}
+
+void jobSystem::workerLoop()
+{
+	profilerThreadName("jobSystem worker");
+
+	for (;;)
+	{
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			wake.wait(guard, [this] { return stopping || !queue.empty(); });
+			if (stopping && queue.empty())
+				return;
+			job = std::move(queue.front());
+			queue.pop_front();
+		}
+
+		PROFILE_SCOPE("jobSystem::job");
+		job();
+	}
+}
+
+void jobSystem::parallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& fn, size_t grain)
+{
+	if (count == 0)
+		return;
+
+	grain = std::max<size_t>(grain, 1);
+	size_t ranges = (count + grain - 1) / grain;
+
+	if (ranges == 1 || workers.empty())
+	{
+		fn(0, count);
+		return;
+	}
+
+	// Helpers can still be sitting in the queue after the loop is done, so they share ownership
+	struct loopState
+	{
+		std::function<void(size_t, size_t)> fn;
+		std::atomic<size_t> next{ 0 };
+		std::atomic<size_t> finished{ 0 };
+		size_t count;
+		size_t grain;
+		size_t ranges;
+	};
+
+	std::shared_ptr<loopState> state = std::make_shared<loopState>();
+	state->fn = fn;
+	state->count = count;
+	state->grain = grain;
+	state->ranges = ranges;
+
+	auto work = [](loopState& s)
+	{
+		for (;;)
+		{
+			size_t range = s.next.fetch_add(1);
+			if (range >= s.ranges)
+				return;
+
+			size_t begin = range * s.grain;
+			s.fn(begin, std::min(begin + s.grain, s.count));
+			s.finished.fetch_add(1);
+		}
+	};
+
+	size_t helpers = std::min(workers.size(), ranges - 1);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		for (size_t i = 0; i < helpers; i++)
+			queue.push_back([state, work] { work(*state); });
+	}
+	wake.notify_all();
+
+	work(*state);
+
+	// Help with other queued jobs (e.g. nested loops) instead of idling
+	while (state->finished.load() < ranges)
+	{
+		if (!runOne())
+			std::this_thread::yield();
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#ifndef JOB_SYSTEM_CLASS
+#define JOB_SYSTEM_CLASS
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+	A fixed pool of worker threads.
+
+	parallelFor splits [0, count) into ranges and runs them on the workers, the calling
+	thread helps out and only returns once every range is finished, so it can be used
+	anywhere a plain for loop was used before:
+
+		jobSystem::shared().parallelFor(chunks.size(), [&](size_t begin, size_t end) { ... });
+*/
+
+class jobSystem
+{
+	public:
+		// Number of worker threads, -1 means one per hardware thread minus the caller
+		// and 0 runs everything on the calling thread
+		jobSystem(int threads = -1);
+		~jobSystem();
+
+		jobSystem(const jobSystem&) = delete;
+		jobSystem& operator=(const jobSystem&) = delete;
+
+		// Workers plus the calling thread
+		unsigned concurrency() const;
+
+		// Runs fn(begin, end) over ranges of at most grain items, blocks until all are done
+		void parallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& fn, size_t grain = 1);
+
+		// Fire and forget, use a counter or future in the job to know when it finished
+		void submit(std::function<void()> job);
+
+		// Pool shared by the whole program
+		static jobSystem& shared();
+
+	private:
+		std::vector<std::thread> workers;
+		std::deque<std::function<void()>> queue;
+		std::mutex lock;
+		std::condition_variable wake;
+		bool stopping = false;
+
+		void workerLoop();
+		bool runOne();
+};
+
+#endif
@@ -0,0 +1,166 @@
+#include "lightBaker.h"
+
+#include <algorithm>
+#include <cfloat>
+
+#include "profiler.h"
+
+int lightBaker::addObject(const glm::vec3* positions, const glm::vec3* normals, const glm::vec3* colours, size_t vertexCount, const glm::mat4& model)
+{
+	objects.emplace_back();
+	bakedObject& o = objects.back();
+
+	o.positions.assign(positions, positions + vertexCount);
+	o.normals.assign(normals, normals + vertexCount);
+	if (colours)
+		o.base.assign(colours, colours + vertexCount);
+	else
+		o.base.assign(vertexCount, glm::vec3(1.0f));
+
+	o.model = model;
+	o.colours.assign(vertexCount * 3, 0.0f);
+	updateBounds(o);
+
+	return (int)objects.size() - 1;
+}
+
+void lightBaker::updateBounds(bakedObject& o)
+{
+	o.boundsMin = glm::vec3(FLT_MAX);
+	o.boundsMax = glm::vec3(-FLT_MAX);
+	for (const glm::vec3& p : o.positions)
+	{
+		glm::vec3 world = glm::vec3(o.model * glm::vec4(p, 1.0f));
+		o.boundsMin = glm::min(o.boundsMin, world);
+		o.boundsMax = glm::max(o.boundsMax, world);
+	}
+}
+
+void lightBaker::setModel(int object, const glm::mat4& model)
+{
+	bakedObject& o = objects[object];
+	if (o.model == model)
+		return;
+
+	o.model = model;
+	updateBounds(o);
+	o.dirty = true;
+}
+
+int lightBaker::addLight(const bakedLight& light)
+{
+	lights.push_back(light);
+	dirtySphere(light.position, light.range);
+	return (int)lights.size() - 1;
+}
+
+void lightBaker::setLight(int light, const bakedLight& value)
+{
+	bakedLight& l = lights[light];
+	if (l.position == value.position && l.colour == value.colour && l.intensity == value.intensity && l.range == value.range)
+		return;
+
+	// Lit before, lit now: both spheres are the dirty region
+	dirtySphere(l.position, l.range);
+	dirtySphere(value.position, value.range);
+	l = value;
+}
+
+void lightBaker::invalidate()
+{
+	for (bakedObject& o : objects)
+		o.dirty = true;
+}
+
+void lightBaker::dirtySphere(const glm::vec3& centre, float radius)
+{
+	for (bakedObject& o : objects)
+	{
+		glm::vec3 nearest = glm::clamp(centre, o.boundsMin, o.boundsMax);
+		if (glm::dot(nearest - centre, nearest - centre) <= radius * radius)
+			o.dirty = true;
+	}
+}
+
+void lightBaker::bakeRange(bakedObject& o, size_t begin, size_t end) const
+{
+	glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(o.model)));
+
+	for (size_t v = begin; v < end; v++)
+	{
+		glm::vec3 p = glm::vec3(o.model * glm::vec4(o.positions[v], 1.0f));
+		glm::vec3 n = normalMatrix * o.normals[v];
+		float nLength = glm::length(n);
+		n = nLength > 0.0f ? n / nLength : n;
+
+		glm::vec3 light(ambient);
+		for (const bakedLight& l : lights)
+		{
+			glm::vec3 toLight = l.position - p;
+			float distance = glm::length(toLight);
+			if (distance >= l.range || distance <= 0.0f)
+				continue;
+
+			float falloff = 1.0f - distance / l.range;
+			light += l.colour * (l.intensity * std::max(glm::dot(n, toLight / distance), 0.0f) * falloff * falloff);
+		}
+
+		glm::vec3 c = o.base[v] * light;
+		o.colours[v * 3] = c.x;
+		o.colours[v * 3 + 1] = c.y;
+		o.colours[v * 3 + 2] = c.z;
+	}
+}
+
+bool lightBaker::bake(jobSystem& jobs)
+{
+	PROFILE_SCOPE("lightBaker::bake");
+
+	changedObjects.clear();
+	lastBakedVertices = 0;
+
+	// Big objects are split so one of them does not end up on a single worker
+	const size_t chunk = 4096;
+	struct workItem
+	{
+		int object;
+		size_t begin, end;
+	};
+	std::vector<workItem> work;
+
+	for (int i = 0; i < (int)objects.size(); i++)
+	{
+		bakedObject& o = objects[i];
+		if (!o.dirty)
+			continue;
+
+		for (size_t begin = 0; begin < o.positions.size(); begin += chunk)
+			work.push_back({ i, begin, std::min(begin + chunk, o.positions.size()) });
+
+		o.dirty = false;
+		changedObjects.push_back(i);
+		lastBakedVertices += o.positions.size();
+	}
+
+	lastBakedObjects = changedObjects.size();
+	if (work.empty())
+		return false;
+
+	jobs.parallelFor(work.size(), [&](size_t begin, size_t end)
+	{
+		for (size_t w = begin; w < end; w++)
+			bakeRange(objects[work[w].object], work[w].begin, work[w].end);
+	}, 4);
+
+	return true;
+}
+
+const std::vector<int>& lightBaker::changed() const
+{
+	return changedObjects;
+}
+
+const std::vector<float>& lightBaker::colours(int object) const
+{
+	return objects[object].colours;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef LIGHT_BAKER_CLASS
+#define LIGHT_BAKER_CLASS
+
+#include <cstddef>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "jobSystem.h"
+
+/*
+	Per vertex lighting of static geometry, computed on the CPU and kept as a colour
+	stream the vertex shader only has to pass on (shaders/bakedVertex.vert).
+
+	Lights have a range, so a change only reaches part of the scene: moving a light dirties
+	the objects whose bounds touch its old or new sphere, moving an object dirties just that
+	object. bake() relights the dirty objects in parallel and lists them in changed(), only
+	their colour buffers need uploading.
+
+		baker.setLight(lamp, { lightCentre, glm::vec3(1.0f), 1.0f, 3.0f });
+		if (baker.bake())
+			for (int object : baker.changed())
+				... glBufferSubData(colours(object)) ...
+
+	colour = base * (ambient + sum over lights of max(dot(n, l), 0) * intensity * (1 - d / range)^2)
+*/
+
+struct bakedLight
+{
+	glm::vec3 position;
+	glm::vec3 colour;
+	float intensity;
+	float range;
+};
+
+class lightBaker
+{
+	public:
+		float ambient = 0.5f;
+
+		size_t lastBakedObjects = 0;
+		size_t lastBakedVertices = 0;
+
+		// Positions and normals in model space, colours may be null for white
+		int addObject(const glm::vec3* positions, const glm::vec3* normals, const glm::vec3* colours, size_t vertexCount, const glm::mat4& model);
+		void setModel(int object, const glm::mat4& model);
+
+		int addLight(const bakedLight& light);
+		void setLight(int light, const bakedLight& value);
+
+		// Everything, e.g. after changing ambient
+		void invalidate();
+
+		// Returns false when nothing was dirty
+		bool bake(jobSystem& jobs = jobSystem::shared());
+
+		const std::vector<int>& changed() const;
+		// Three floats per vertex
+		const std::vector<float>& colours(int object) const;
+
+	private:
+		struct bakedObject
+		{
+			std::vector<glm::vec3> positions;
+			std::vector<glm::vec3> normals;
+			std::vector<glm::vec3> base;
+			glm::mat4 model;
+			glm::vec3 boundsMin;
+			glm::vec3 boundsMax;
+			std::vector<float> colours;
+			bool dirty = true;
+		};
+
+		std::vector<bakedObject> objects;
+		std::vector<bakedLight> lights;
+		std::vector<int> changedObjects;
+
+		void updateBounds(bakedObject& o);
+		void dirtySphere(const glm::vec3& centre, float radius);
+		void bakeRange(bakedObject& o, size_t begin, size_t end) const;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#include "mappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+mappedFile::mappedFile(const char* path)
+{
+#ifdef _WIN32
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		file = nullptr;
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize))
+		length = (uint64_t)fileSize.QuadPart;
+
+	if (length > 0)
+	{
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping)
+			bytes = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	}
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (fstat(fd, &st) == 0)
+		length = (uint64_t)st.st_size;
+
+	if (length > 0)
+	{
+		void* mapped = mmap(nullptr, (size_t)length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped != MAP_FAILED)
+			bytes = (const unsigned char*)mapped;
+	}
+
+	// The mapping keeps its own reference to the file
+	close(fd);
+#endif
+}
+
+mappedFile::~mappedFile()
+{
+#ifdef _WIN32
+	if (bytes)
+		UnmapViewOfFile(bytes);
+	if (mapping)
+		CloseHandle(mapping);
+	if (file)
+		CloseHandle(file);
+#else
+	if (bytes)
+		munmap((void*)bytes, (size_t)length);
+#endif
+}
+
+bool mappedFile::valid() const
+{
+	return bytes != nullptr;
+}
+
+const unsigned char* mappedFile::data() const
+{
+	return bytes;
+}
+
+uint64_t mappedFile::size() const
+{
+	return length;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef MAPPED_FILE_CLASS
+#define MAPPED_FILE_CLASS
+
+#include <cstdint>
+
+// Read only memory mapping of a whole file (mmap / MapViewOfFile), unmapped on destruction
+class mappedFile
+{
+	public:
+		mappedFile(const char* path);
+		~mappedFile();
+
+		mappedFile(const mappedFile&) = delete;
+		mappedFile& operator=(const mappedFile&) = delete;
+
+		// False if the file could not be opened or mapped, empty files are never mapped
+		bool valid() const;
+
+		const unsigned char* data() const;
+		uint64_t size() const;
+
+	private:
+		const unsigned char* bytes = nullptr;
+		uint64_t length = 0;
+
+#ifdef _WIN32
+		void* file = nullptr;
+		void* mapping = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,236 @@
+#include "meshFile.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// The header is written and mapped as is, so its layout must not change between compilers
+static_assert(sizeof(meshAttribute) == 20, "meshAttribute layout changed");
+static_assert(sizeof(meshFileHeader) == 248, "meshFileHeader layout changed");
+
+static uint64_t alignUp(uint64_t value)
+{
+	return (value + meshFileAlignment - 1) / meshFileAlignment * meshFileAlignment;
+}
+
+uint32_t meshFile::indexSize(GLenum indexType)
+{
+	switch (indexType)
+	{
+	case GL_UNSIGNED_BYTE:
+		return 1;
+	case GL_UNSIGNED_SHORT:
+		return 2;
+	case GL_UNSIGNED_INT:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+uint32_t meshFile::attributeSize(GLenum type, uint32_t components)
+{
+	if (components < 1 || components > 4)
+		return 0;
+
+	switch (type)
+	{
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE:
+		return components;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		return components * 2;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		return components * 4;
+	case GL_DOUBLE:
+		return components * 8;
+	// Packed, all four components in one 32 bit word
+	case GL_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+		return components == 4 ? 4 : 0;
+	default:
+		return 0;
+	}
+}
+
+meshFile::meshFile(const char* path) : file(path)
+{
+	if (!file.valid())
+	{
+		std::cout << "ERROR::MESHFILE::FILE_NOT_SUCCESSFULLY_MAPPED " << path << std::endl;
+		return;
+	}
+
+	ok = check(path);
+}
+
+// Validates the header against the file size so a truncated or foreign file is never read past its end
+bool meshFile::check(const char* path)
+{
+	uint64_t size = file.size();
+
+	if (size < sizeof(meshFileHeader))
+	{
+		std::cout << "ERROR::MESHFILE::TRUNCATED_HEADER " << path << std::endl;
+		return false;
+	}
+
+	const meshFileHeader& h = header();
+
+	if (h.magic != meshFileMagic || h.version != meshFileVersion)
+	{
+		std::cout << "ERROR::MESHFILE::UNKNOWN_FORMAT " << path << std::endl;
+		return false;
+	}
+
+	uint32_t iSize = indexSize(h.indexType);
+
+	bool layoutOk = iSize != 0
+		&& h.attributeCount <= meshFileMaxAttributes
+		&& h.vertexOffset % meshFileAlignment == 0
+		&& h.indexOffset % meshFileAlignment == 0
+		&& h.vertexBytes == (uint64_t)h.vertexCount * h.vertexStride
+		&& h.indexBytes == (uint64_t)h.indexCount * iSize
+		&& h.vertexOffset >= sizeof(meshFileHeader)
+		&& h.vertexOffset <= size && h.vertexBytes <= size - h.vertexOffset
+		&& h.indexOffset <= size && h.indexBytes <= size - h.indexOffset;
+
+	// Every attribute a type GL takes and inside its vertex, or the GPU reads past the blob
+	for (uint32_t i = 0; layoutOk && i < h.attributeCount; i++)
+	{
+		const meshAttribute& a = h.attributes[i];
+		uint32_t bytes = attributeSize(a.type, a.components);
+		layoutOk = bytes != 0 && a.offset < h.vertexStride && bytes <= h.vertexStride - a.offset;
+	}
+
+	if (!layoutOk)
+	{
+		std::cout << "ERROR::MESHFILE::CORRUPT_LAYOUT " << path << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+bool meshFile::valid() const
+{
+	return ok;
+}
+
+const meshFileHeader& meshFile::header() const
+{
+	return *(const meshFileHeader*)file.data();
+}
+
+const void* meshFile::vertexData() const
+{
+	return file.data() + header().vertexOffset;
+}
+
+const void* meshFile::indexData() const
+{
+	return file.data() + header().indexOffset;
+}
+
+GLsizeiptr meshFile::vertexBytes() const
+{
+	return (GLsizeiptr)header().vertexBytes;
+}
+
+GLsizeiptr meshFile::indexBytes() const
+{
+	return (GLsizeiptr)header().indexBytes;
+}
+
+void meshFile::linkAttributes(VAO& vao, VBO& vbo) const
+{
+	const meshFileHeader& h = header();
+
+	for (uint32_t i = 0; i < h.attributeCount; i++)
+	{
+		const meshAttribute& a = h.attributes[i];
+		vao.linkArray(vbo, a.location, (GLint)a.components, a.type, (GLboolean)a.normalized, h.vertexStride, (void*)(size_t)a.offset);
+	}
+}
+
+bool meshFile::write(const char* path, const meshAttribute* attributes, uint32_t attributeCount, uint32_t vertexStride,
+	const void* vertices, uint32_t vertexCount, const void* indices, uint32_t indexCount, GLenum indexType)
+{
+	bool layoutOk = attributeCount <= meshFileMaxAttributes && indexSize(indexType) != 0;
+	for (uint32_t i = 0; layoutOk && i < attributeCount; i++)
+	{
+		uint32_t bytes = attributeSize(attributes[i].type, attributes[i].components);
+		layoutOk = bytes != 0 && attributes[i].offset < vertexStride && bytes <= vertexStride - attributes[i].offset;
+	}
+
+	if (!layoutOk)
+	{
+		std::cout << "ERROR::MESHFILE::UNSUPPORTED_LAYOUT " << path << std::endl;
+		return false;
+	}
+
+	meshFileHeader h;
+	std::memset(&h, 0, sizeof(h));
+
+	h.magic = meshFileMagic;
+	h.version = meshFileVersion;
+	h.vertexCount = vertexCount;
+	h.vertexStride = vertexStride;
+	h.indexCount = indexCount;
+	h.indexType = indexType;
+	h.attributeCount = attributeCount;
+	std::memcpy(h.attributes, attributes, attributeCount * sizeof(meshAttribute));
+
+	h.vertexBytes = (uint64_t)vertexCount * vertexStride;
+	h.indexBytes = (uint64_t)indexCount * indexSize(indexType);
+	h.vertexOffset = alignUp(sizeof(meshFileHeader));
+	h.indexOffset = alignUp(h.vertexOffset + h.vertexBytes);
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		h.boundsMin[axis] = vertexCount ? FLT_MAX : 0.0f;
+		h.boundsMax[axis] = vertexCount ? -FLT_MAX : 0.0f;
+	}
+
+	for (uint32_t i = 0; i < attributeCount; i++)
+	{
+		if (attributes[i].location != 0 || attributes[i].type != GL_FLOAT || attributes[i].components < 3)
+			continue;
+
+		for (uint32_t v = 0; v < vertexCount; v++)
+		{
+			float position[3];
+			std::memcpy(position, (const unsigned char*)vertices + (size_t)v * vertexStride + attributes[i].offset, sizeof(position));
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				h.boundsMin[axis] = std::min(h.boundsMin[axis], position[axis]);
+				h.boundsMax[axis] = std::max(h.boundsMax[axis], position[axis]);
+			}
+		}
+	}
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		std::cout << "ERROR::MESHFILE::FILE_NOT_SUCCESSFULLY_WRITTEN " << path << std::endl;
+		return false;
+	}
+
+	std::vector<char> padding(meshFileAlignment, 0);
+
+	out.write((const char*)&h, sizeof(h));
+	out.write(padding.data(), (std::streamsize)(h.vertexOffset - sizeof(h)));
+	out.write((const char*)vertices, (std::streamsize)h.vertexBytes);
+	out.write(padding.data(), (std::streamsize)(h.indexOffset - h.vertexOffset - h.vertexBytes));
+	out.write((const char*)indices, (std::streamsize)h.indexBytes);
+
+	return (bool)out;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef MESH_FILE_CLASS
+#define MESH_FILE_CLASS
+
+#include <glad/glad.h>
+
+#include <cstdint>
+
+#include "VAO.h"
+#include "VBO.h"
+#include "mappedFile.h"
+
+/*
+	Binary mesh container (.oglm)
+
+	[ meshFileHeader ][ pad ][ vertex blob ][ pad ][ index blob ]
+
+	Both blobs start on a meshFileAlignment boundary and are stored exactly as the GPU wants
+	them, so after mapping the file the pointers go straight into glBufferData / glBufferSubData
+	without any parsing or copying. Loading a mesh is an open + mmap + header check, the pages
+	are only read in when the driver copies them.
+*/
+
+const uint32_t meshFileMagic = 0x4D4C474F; // "OGLM"
+const uint32_t meshFileVersion = 1;
+const uint32_t meshFileAlignment = 64;
+const uint32_t meshFileMaxAttributes = 8;
+
+// One glVertexAttribPointer worth of layout
+struct meshAttribute
+{
+	uint32_t location;
+	uint32_t components;
+	uint32_t type;        // GL_FLOAT, GL_UNSIGNED_BYTE, ...
+	uint32_t normalized;
+	uint32_t offset;      // byte offset inside one vertex
+};
+
+struct meshFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+
+	uint32_t vertexCount;
+	uint32_t vertexStride;
+	uint32_t indexCount;
+	uint32_t indexType;   // GL_UNSIGNED_INT, GL_UNSIGNED_SHORT or GL_UNSIGNED_BYTE
+
+	uint32_t attributeCount;
+	uint32_t flags;
+	meshAttribute attributes[meshFileMaxAttributes];
+
+	uint64_t vertexOffset;
+	uint64_t vertexBytes;
+	uint64_t indexOffset;
+	uint64_t indexBytes;
+
+	// Axis aligned bounds of attribute location 0
+	float boundsMin[3];
+	float boundsMax[3];
+};
+
+class meshFile
+{
+	public:
+		// Maps the file read only, check valid() before use
+		meshFile(const char* path);
+
+		meshFile(const meshFile&) = delete;
+		meshFile& operator=(const meshFile&) = delete;
+
+		bool valid() const;
+		const meshFileHeader& header() const;
+
+		const void* vertexData() const;
+		const void* indexData() const;
+		GLsizeiptr vertexBytes() const;
+		GLsizeiptr indexBytes() const;
+
+		// glVertexAttribPointer for every attribute in the layout, vbo must hold vertexData()
+		void linkAttributes(VAO& vao, VBO& vbo) const;
+
+		// Writes a mesh, bounds are computed from the float3 attribute at location 0
+		static bool write(const char* path, const meshAttribute* attributes, uint32_t attributeCount, uint32_t vertexStride,
+			const void* vertices, uint32_t vertexCount, const void* indices, uint32_t indexCount, GLenum indexType);
+
+		static uint32_t indexSize(GLenum indexType);
+		// Bytes of one attribute inside a vertex, 0 when glVertexAttribPointer would refuse it
+		static uint32_t attributeSize(GLenum type, uint32_t components);
+
+	private:
+		mappedFile file;
+		bool ok = false;
+
+		bool check(const char* path);
+};
+
+#endif
@@ -0,0 +1,635 @@
+#include "meshImport.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "EBO.h"
+#include "mappedFile.h"
+
+const meshAttribute importedMesh::attributes[importedMesh::attributeCount] = {
+	{ 0, 3, GL_FLOAT, GL_FALSE, 0 * sizeof(float) },
+	{ 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float) },
+	{ 2, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float) },
+};
+
+uint32_t importedMesh::vertexCount() const
+{
+	return (uint32_t)(vertices.size() / floatsPerVertex);
+}
+
+void importedMesh::buildLods(int maxLevels)
+{
+	buildLodChain(vertices, indices, floatsPerVertex, lods, maxLevels);
+	meshlets = meshletSet();
+}
+
+void importedMesh::buildMeshlets(jobSystem& jobs)
+{
+	size_t count = lods.levels.empty() ? indices.size() : lods.levels[0].indexCount;
+	::buildMeshlets(meshlets, indices.data(), count, vertices.data(), vertexCount(), floatsPerVertex, meshletMaxVertices, meshletMaxTriangles, jobs);
+}
+
+bool importedMesh::writeMeshFile(const char* path) const
+{
+	// The file has no level table, so only the finest level goes in. It comes first in indices
+	size_t count = lods.levels.empty() ? indices.size() : lods.levels[0].indexCount;
+
+	// Stored as the narrowest index type so the blob can go to the EBO as is
+	GLenum indexType = EBO::narrowestType(vertexCount() > 0 ? vertexCount() - 1 : 0);
+	std::vector<unsigned char> narrowed;
+	EBO::narrow(indices.data(), count, indexType, narrowed);
+
+	return meshFile::write(path, attributes, attributeCount, floatsPerVertex * sizeof(float),
+		vertices.data(), vertexCount(), narrowed.data(), (uint32_t)count, indexType);
+}
+
+void importedMesh::linkAttributes(VAO& vao, VBO& vbo) const
+{
+	for (const meshAttribute& a : attributes)
+		vao.linkArray(vbo, a.location, (GLint)a.components, a.type, (GLboolean)a.normalized, floatsPerVertex * sizeof(float), (void*)(size_t)a.offset);
+}
+
+void smoothNormals(float* vertices, size_t vertexCount, const uint32_t* indices, size_t indexCount)
+{
+	const uint32_t stride = importedMesh::floatsPerVertex;
+
+	for (size_t i = 0; i + 2 < indexCount; i += 3)
+	{
+		float* a = vertices + (size_t)indices[i] * stride;
+		float* b = vertices + (size_t)indices[i + 1] * stride;
+		float* c = vertices + (size_t)indices[i + 2] * stride;
+
+		float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+		float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+		float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+
+		for (float* corner : { a, b, c })
+		{
+			corner[3] += n[0];
+			corner[4] += n[1];
+			corner[5] += n[2];
+		}
+	}
+
+	for (size_t i = 0; i < vertexCount; i++)
+	{
+		float* n = vertices + i * stride + 3;
+		float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (length > 0.0f)
+		{
+			n[0] /= length;
+			n[1] /= length;
+			n[2] /= length;
+		}
+	}
+}
+
+static bool hasExtension(const std::string& path, const char* extension)
+{
+	size_t length = std::strlen(extension);
+	if (path.size() < length)
+		return false;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		if (std::tolower((unsigned char)path[path.size() - length + i]) != extension[i])
+			return false;
+	}
+	return true;
+}
+
+bool importMesh(const char* path, importedMesh& mesh, jobSystem& jobs)
+{
+	std::string name = path;
+	bool imported;
+
+	if (hasExtension(name, ".obj"))
+		imported = importOBJ(path, mesh, jobs);
+	else if (hasExtension(name, ".gltf") || hasExtension(name, ".glb"))
+		imported = importGLTF(path, mesh, jobs);
+	else
+	{
+		std::cout << "ERROR::MESHIMPORT::UNKNOWN_EXTENSION " << path << std::endl;
+		return false;
+	}
+
+	if (imported)
+	{
+		mesh.buildLods();
+		mesh.buildMeshlets(jobs);
+	}
+	return imported;
+}
+
+// ********** OBJ **********
+
+static const uint32_t noIndex = 0xFFFFFFFFu;
+static const size_t objChunkBytes = 1 << 22;
+
+// One position / uv / normal index triple of a face
+struct objCorner
+{
+	uint32_t p;
+	uint32_t t;
+	uint32_t n;
+};
+
+struct objChunk
+{
+	const char* begin;
+	const char* end;
+
+	// Element counts in this chunk, turned into global offsets by a prefix sum
+	size_t positions = 0;
+	size_t texcoords = 0;
+	size_t normals = 0;
+
+	std::vector<objCorner> corners;
+	bool failed = false;
+};
+
+static const char* skipSpaces(const char* s, const char* end)
+{
+	while (s < end && (*s == ' ' || *s == '\t'))
+		s++;
+	return s;
+}
+
+static const char* lineEnd(const char* s, const char* end)
+{
+	const char* found = (const char*)std::memchr(s, '\n', (size_t)(end - s));
+	return found ? found : end;
+}
+
+static const char* parseFloat(const char* s, const char* end, float& value)
+{
+	s = skipSpaces(s, end);
+	if (s < end && *s == '+')
+		s++;
+
+	std::from_chars_result result = std::from_chars(s, end, value);
+	if (result.ec != std::errc())
+	{
+		value = 0.0f;
+		return nullptr;
+	}
+	return result.ptr;
+}
+
+// OBJ indices are 1 based, negative ones count back from the newest element so far
+static bool resolveIndex(long long index, size_t count, size_t total, uint32_t& out)
+{
+	if (index > 0 && (size_t)index <= total)
+		out = (uint32_t)(index - 1);
+	else if (index < 0 && (size_t)(-index) <= count)
+		out = (uint32_t)((long long)count + index);
+	else
+		return false;
+	return true;
+}
+
+static const char* parseCorner(const char* s, const char* end, const size_t counts[3], const size_t totals[3], objCorner& corner)
+{
+	uint32_t* parts[3] = { &corner.p, &corner.t, &corner.n };
+	corner = { noIndex, noIndex, noIndex };
+
+	for (int part = 0; part < 3; part++)
+	{
+		if (part > 0)
+		{
+			if (s >= end || *s != '/')
+				break;
+			s++;
+			// "p//n" leaves the uv empty
+			if (s < end && *s == '/')
+				continue;
+		}
+
+		long long index = 0;
+		std::from_chars_result result = std::from_chars(s, end, index);
+		if (result.ec != std::errc() || !resolveIndex(index, counts[part], totals[part], *parts[part]))
+			return nullptr;
+		s = result.ptr;
+	}
+
+	return corner.p == noIndex ? nullptr : s;
+}
+
+enum objLine
+{
+	objOther,
+	objPosition,
+	objTexcoord,
+	objNormal,
+	objFace
+};
+
+// Both passes must agree on what a line is, or the counts would not match the data
+static objLine classifyLine(const char* s, const char* line)
+{
+	size_t length = (size_t)(line - s);
+	bool space1 = length > 1 && (s[1] == ' ' || s[1] == '\t');
+	bool space2 = length > 2 && (s[2] == ' ' || s[2] == '\t');
+
+	if (s[0] == 'v' && space1)
+		return objPosition;
+	if (s[0] == 'v' && length > 1 && s[1] == 't' && space2)
+		return objTexcoord;
+	if (s[0] == 'v' && length > 1 && s[1] == 'n' && space2)
+		return objNormal;
+	if (s[0] == 'f' && space1)
+		return objFace;
+	return objOther;
+}
+
+// Line without its terminator and leading blanks
+static const char* lineStart(const char* s, const char* next, const char*& line)
+{
+	line = next;
+	if (line > s && line[-1] == '\r')
+		line--;
+	return skipSpaces(s, line);
+}
+
+// Cheap first pass: only counts v / vt / vn lines so every chunk knows where its data goes
+static void countChunk(objChunk& chunk)
+{
+	for (const char* s = chunk.begin; s < chunk.end; )
+	{
+		const char* next = lineEnd(s, chunk.end);
+		const char* line;
+		s = lineStart(s, next, line);
+
+		if (s < line)
+		{
+			switch (classifyLine(s, line))
+			{
+			case objPosition:
+				chunk.positions++;
+				break;
+			case objTexcoord:
+				chunk.texcoords++;
+				break;
+			case objNormal:
+				chunk.normals++;
+				break;
+			default:
+				break;
+			}
+		}
+
+		s = next + 1;
+	}
+}
+
+// Second pass: writes attributes straight into the shared arrays and fan triangulates faces
+static void parseChunk(objChunk& chunk, const size_t base[3], const size_t totals[3], float* positions, float* texcoords, float* normals)
+{
+	// Running totals including everything before this chunk, for negative indices
+	size_t counts[3] = { base[0], base[1], base[2] };
+	std::vector<objCorner> face;
+
+	for (const char* s = chunk.begin; s < chunk.end && !chunk.failed; )
+	{
+		const char* next = lineEnd(s, chunk.end);
+		const char* line;
+		s = lineStart(s, next, line);
+
+		switch (s < line ? classifyLine(s, line) : objOther)
+		{
+		case objPosition:
+		{
+			float* out = positions + counts[0] * 3;
+			const char* p = s + 1;
+			for (int i = 0; i < 3 && p; i++)
+				p = parseFloat(p, line, out[i]);
+			chunk.failed = p == nullptr;
+			counts[0]++;
+			break;
+		}
+		case objTexcoord:
+		{
+			float* out = texcoords + counts[1] * 2;
+			const char* p = parseFloat(s + 2, line, out[0]);
+			// The v coordinate is optional
+			if (p == nullptr || parseFloat(p, line, out[1]) == nullptr)
+				out[1] = 0.0f;
+			chunk.failed = p == nullptr;
+			counts[1]++;
+			break;
+		}
+		case objNormal:
+		{
+			float* out = normals + counts[2] * 3;
+			const char* p = s + 2;
+			for (int i = 0; i < 3 && p; i++)
+				p = parseFloat(p, line, out[i]);
+			chunk.failed = p == nullptr;
+			counts[2]++;
+			break;
+		}
+		case objFace:
+		{
+			face.clear();
+
+			for (const char* p = skipSpaces(s + 1, line); p < line; p = skipSpaces(p, line))
+			{
+				objCorner corner;
+				p = parseCorner(p, line, counts, totals, corner);
+				if (p == nullptr)
+				{
+					chunk.failed = true;
+					break;
+				}
+				face.push_back(corner);
+			}
+
+			for (size_t i = 2; i < face.size(); i++)
+			{
+				chunk.corners.push_back(face[0]);
+				chunk.corners.push_back(face[i - 1]);
+				chunk.corners.push_back(face[i]);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+
+		s = next + 1;
+	}
+}
+
+// Open addressing map from a corner to its vertex number inside one shard
+class cornerMap
+{
+	public:
+		cornerMap(size_t expected)
+		{
+			size_t capacity = 16;
+			while (capacity < expected * 2)
+				capacity *= 2;
+			slots.resize(capacity, { { noIndex, noIndex, noIndex }, 0 });
+		}
+
+		uint32_t insert(const objCorner& key, uint32_t next)
+		{
+			if ((used + 1) * 10 > slots.size() * 7)
+				grow();
+
+			size_t mask = slots.size() - 1;
+			for (size_t i = hash(key) & mask; ; i = (i + 1) & mask)
+			{
+				entry& e = slots[i];
+				if (e.key.p == noIndex)
+				{
+					e.key = key;
+					e.value = next;
+					used++;
+					return next;
+				}
+				if (e.key.p == key.p && e.key.t == key.t && e.key.n == key.n)
+					return e.value;
+			}
+		}
+
+	private:
+		struct entry
+		{
+			objCorner key;
+			uint32_t value;
+		};
+
+		std::vector<entry> slots;
+		size_t used = 0;
+
+		static size_t hash(const objCorner& key)
+		{
+			uint64_t h = key.p * 0x9E3779B97F4A7C15ull;
+			h ^= (key.t + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+			h ^= (key.n + 0x165667B19E3779F9ull) * 0x85EBCA77C2B2AE63ull;
+			return (size_t)(h ^ (h >> 29));
+		}
+
+		void grow()
+		{
+			std::vector<entry> old;
+			old.swap(slots);
+			slots.resize(old.size() * 2, { { noIndex, noIndex, noIndex }, 0 });
+			used = 0;
+
+			for (const entry& e : old)
+			{
+				if (e.key.p != noIndex)
+					insert(e.key, e.value);
+			}
+		}
+};
+
+bool importOBJText(const char* text, size_t length, importedMesh& mesh, jobSystem& jobs)
+{
+	mesh.vertices.clear();
+	mesh.indices.clear();
+	mesh.sourceCorners = 0;
+	mesh.lods = lodChain();
+	mesh.meshlets = meshletSet();
+
+	const char* end = text + length;
+
+	// Cut into chunks that end on a line break
+	std::vector<objChunk> chunks;
+	for (const char* s = text; s < end; )
+	{
+		const char* stop = s + std::min(objChunkBytes, (size_t)(end - s));
+		stop = stop < end ? lineEnd(stop, end) : end;
+		if (stop < end)
+			stop++;
+
+		objChunk chunk;
+		chunk.begin = s;
+		chunk.end = stop;
+		chunks.push_back(std::move(chunk));
+		s = stop;
+	}
+
+	jobs.parallelFor(chunks.size(), [&](size_t begin, size_t stop)
+	{
+		for (size_t c = begin; c < stop; c++)
+			countChunk(chunks[c]);
+	});
+
+	std::vector<size_t> bases(chunks.size() * 3);
+	size_t totals[3] = { 0, 0, 0 };
+	for (size_t c = 0; c < chunks.size(); c++)
+	{
+		bases[c * 3 + 0] = totals[0];
+		bases[c * 3 + 1] = totals[1];
+		bases[c * 3 + 2] = totals[2];
+		totals[0] += chunks[c].positions;
+		totals[1] += chunks[c].texcoords;
+		totals[2] += chunks[c].normals;
+	}
+
+	std::vector<float> positions(totals[0] * 3);
+	std::vector<float> texcoords(totals[1] * 2);
+	std::vector<float> normals(totals[2] * 3);
+
+	jobs.parallelFor(chunks.size(), [&](size_t begin, size_t stop)
+	{
+		for (size_t c = begin; c < stop; c++)
+			parseChunk(chunks[c], &bases[c * 3], totals, positions.data(), texcoords.data(), normals.data());
+	});
+
+	size_t cornerCount = 0;
+	for (const objChunk& chunk : chunks)
+	{
+		if (chunk.failed)
+		{
+			std::cout << "ERROR::MESHIMPORT::OBJ_PARSE_FAILED" << std::endl;
+			return false;
+		}
+		cornerCount += chunk.corners.size();
+	}
+
+	if (totals[0] == 0 || cornerCount == 0)
+		return true;
+
+	// Corners with different positions can never be the same vertex, so sharding by position
+	// range lets every shard deduplicate on its own and keeps vertices near their positions
+	size_t shardCount = std::min<size_t>(jobs.concurrency() * 4, totals[0]);
+	auto shardOf = [&](const objCorner& corner) { return (size_t)((uint64_t)corner.p * shardCount / totals[0]); };
+
+	// Counting sort of corner numbers into shards, chunk order is kept inside each shard
+	std::vector<size_t> shardStart(chunks.size() * shardCount, 0);
+	jobs.parallelFor(chunks.size(), [&](size_t begin, size_t stop)
+	{
+		for (size_t c = begin; c < stop; c++)
+			for (const objCorner& corner : chunks[c].corners)
+				shardStart[c * shardCount + shardOf(corner)]++;
+	});
+
+	std::vector<size_t> cornerBase(chunks.size(), 0);
+	std::vector<size_t> shardBegin(shardCount + 1, 0);
+	size_t offset = 0;
+	for (size_t s = 0; s < shardCount; s++)
+	{
+		shardBegin[s] = offset;
+		for (size_t c = 0; c < chunks.size(); c++)
+		{
+			size_t count = shardStart[c * shardCount + s];
+			shardStart[c * shardCount + s] = offset;
+			offset += count;
+		}
+	}
+	shardBegin[shardCount] = offset;
+
+	for (size_t c = 1; c < chunks.size(); c++)
+		cornerBase[c] = cornerBase[c - 1] + chunks[c - 1].corners.size();
+
+	std::vector<uint32_t> sortedCorners(cornerCount);
+	jobs.parallelFor(chunks.size(), [&](size_t begin, size_t stop)
+	{
+		for (size_t c = begin; c < stop; c++)
+		{
+			const std::vector<objCorner>& corners = chunks[c].corners;
+			for (size_t i = 0; i < corners.size(); i++)
+				sortedCorners[shardStart[c * shardCount + shardOf(corners[i])]++] = (uint32_t)(cornerBase[c] + i);
+		}
+	});
+
+	auto cornerAt = [&](uint32_t global) -> const objCorner&
+	{
+		size_t c = std::upper_bound(cornerBase.begin(), cornerBase.end(), (size_t)global) - cornerBase.begin() - 1;
+		return chunks[c].corners[global - cornerBase[c]];
+	};
+
+	// Per shard deduplication, local vertex numbers first
+	std::vector<uint32_t> localIndex(cornerCount);
+	std::vector<std::vector<objCorner>> shardVertices(shardCount);
+
+	jobs.parallelFor(shardCount, [&](size_t begin, size_t stop)
+	{
+		for (size_t s = begin; s < stop; s++)
+		{
+			size_t positionSpan = totals[0] / shardCount + 1;
+			cornerMap map(positionSpan);
+			std::vector<objCorner>& unique = shardVertices[s];
+
+			for (size_t i = shardBegin[s]; i < shardBegin[s + 1]; i++)
+			{
+				const objCorner& corner = cornerAt(sortedCorners[i]);
+				uint32_t index = map.insert(corner, (uint32_t)unique.size());
+				if (index == unique.size())
+					unique.push_back(corner);
+				localIndex[sortedCorners[i]] = index;
+			}
+		}
+	});
+
+	std::vector<uint32_t> vertexBase(shardCount + 1, 0);
+	for (size_t s = 0; s < shardCount; s++)
+		vertexBase[s + 1] = vertexBase[s] + (uint32_t)shardVertices[s].size();
+
+	mesh.sourceCorners = cornerCount;
+	mesh.vertices.resize((size_t)vertexBase[shardCount] * importedMesh::floatsPerVertex);
+	mesh.indices.resize(cornerCount);
+
+	// Interleave the vertices of every shard into its range of the final buffer
+	jobs.parallelFor(shardCount, [&](size_t begin, size_t stop)
+	{
+		for (size_t s = begin; s < stop; s++)
+		{
+			float* out = mesh.vertices.data() + (size_t)vertexBase[s] * importedMesh::floatsPerVertex;
+
+			for (const objCorner& corner : shardVertices[s])
+			{
+				std::memcpy(out, &positions[(size_t)corner.p * 3], 3 * sizeof(float));
+
+				if (corner.n != noIndex)
+					std::memcpy(out + 3, &normals[(size_t)corner.n * 3], 3 * sizeof(float));
+				else
+					out[3] = out[4] = out[5] = 0.0f;
+
+				if (corner.t != noIndex)
+					std::memcpy(out + 6, &texcoords[(size_t)corner.t * 2], 2 * sizeof(float));
+				else
+					out[6] = out[7] = 0.0f;
+
+				out += importedMesh::floatsPerVertex;
+			}
+		}
+	});
+
+	jobs.parallelFor(chunks.size(), [&](size_t begin, size_t stop)
+	{
+		for (size_t c = begin; c < stop; c++)
+		{
+			const std::vector<objCorner>& corners = chunks[c].corners;
+			for (size_t i = 0; i < corners.size(); i++)
+				mesh.indices[cornerBase[c] + i] = vertexBase[shardOf(corners[i])] + localIndex[cornerBase[c] + i];
+		}
+	});
+
+	// Files without normals get smooth ones from the face normals
+	if (totals[2] == 0)
+		smoothNormals(mesh.vertices.data(), mesh.vertexCount(), mesh.indices.data(), mesh.indices.size());
+
+	return true;
+}
+
+bool importOBJ(const char* path, importedMesh& mesh, jobSystem& jobs)
+{
+	mappedFile file(path);
+	if (!file.valid())
+	{
+		std::cout << "ERROR::MESHIMPORT::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+		return false;
+	}
+
+	return importOBJText((const char*)file.data(), (size_t)file.size(), mesh, jobs);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef MESH_IMPORT_CLASS
+#define MESH_IMPORT_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "VAO.h"
+#include "VBO.h"
+#include "jobSystem.h"
+#include "meshFile.h"
+#include "meshLod.h"
+#include "meshlet.h"
+
+/*
+	Wavefront OBJ and glTF 2.0 (.gltf / .glb) import into one indexed triangle mesh.
+
+	OBJ files are mapped and cut into chunks at line boundaries, the chunks are counted and
+	then parsed in parallel on the job system. Face corners (position / uv / normal index
+	triples) are deduplicated through hash maps sharded by position index, so every shard
+	can run on its own worker and the result does not depend on the thread count.
+
+	glTF primitives are read in parallel, transformed by their node and welded by value.
+
+	The result uses a fixed interleaved layout and can be written as an .oglm mesh file or
+	handed to VBO / EBO directly.
+*/
+
+struct importedMesh
+{
+	// position (location 0), normal (location 1), uv (location 2)
+	static const uint32_t floatsPerVertex = 8;
+	static const uint32_t attributeCount = 3;
+	static const meshAttribute attributes[attributeCount];
+
+	std::vector<float> vertices;
+	std::vector<uint32_t> indices;
+
+	// Face corners before deduplication, vertexCount() after
+	size_t sourceCorners = 0;
+
+	// Empty until buildLods(), afterwards indices holds every level back to back
+	lodChain lods;
+
+	// Empty until buildMeshlets(), covers the finest level only
+	meshletSet meshlets;
+
+	uint32_t vertexCount() const;
+
+	// Reorders the indices, so meshlets are built after the LODs
+	void buildLods(int maxLevels = lodMaxLevels);
+	void buildMeshlets(jobSystem& jobs = jobSystem::shared());
+
+	// The finest level only once the LODs are built
+	bool writeMeshFile(const char* path) const;
+	void linkAttributes(VAO& vao, VBO& vbo) const;
+};
+
+// Area weighted normals from the faces, added onto the normals already in the vertices
+void smoothNormals(float* vertices, size_t vertexCount, const uint32_t* indices, size_t indexCount);
+
+// Picks the importer from the file extension, then builds the LOD chain and the meshlets
+// of its finest level. The importers below leave both to the caller
+bool importMesh(const char* path, importedMesh& mesh, jobSystem& jobs = jobSystem::shared());
+
+bool importOBJ(const char* path, importedMesh& mesh, jobSystem& jobs = jobSystem::shared());
+bool importOBJText(const char* text, size_t length, importedMesh& mesh, jobSystem& jobs = jobSystem::shared());
+
+bool importGLTF(const char* path, importedMesh& mesh, jobSystem& jobs = jobSystem::shared());
+
+#endif
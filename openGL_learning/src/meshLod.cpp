@@ -0,0 +1,117 @@
+#include "meshLod.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "EBO.h"
+#include "meshOptimize.h"
+#include "meshSimplify.h"
+
+void buildLodChain(std::vector<float>& vertices, std::vector<uint32_t>& indices, size_t floatsPerVertex,
+	lodChain& chain, int maxLevels, float reduction)
+{
+	chain.levels.clear();
+	size_t vertexCount = vertices.size() / floatsPerVertex;
+	indices.resize(indices.size() - indices.size() % 3);
+	if (vertexCount == 0 || indices.empty())
+		return;
+
+	glm::vec3 low(FLT_MAX), high(-FLT_MAX);
+	for (size_t v = 0; v < vertexCount; v++)
+	{
+		glm::vec3 p(vertices[v * floatsPerVertex], vertices[v * floatsPerVertex + 1], vertices[v * floatsPerVertex + 2]);
+		low = glm::min(low, p);
+		high = glm::max(high, p);
+	}
+
+	chain.centre = (low + high) * 0.5f;
+	chain.radius = 0.0f;
+	for (size_t v = 0; v < vertexCount; v++)
+	{
+		glm::vec3 p(vertices[v * floatsPerVertex], vertices[v * floatsPerVertex + 1], vertices[v * floatsPerVertex + 2]);
+		chain.radius = std::max(chain.radius, glm::length(p - chain.centre));
+	}
+
+	// Every level is simplified from the one before, so the errors add up
+	std::vector<uint32_t> all;
+	std::vector<uint32_t> level = indices;
+	std::vector<uint32_t> next;
+	float error = 0.0f;
+
+	for (int l = 0; l < maxLevels; l++)
+	{
+		if (l > 0)
+		{
+			size_t target = (size_t)(level.size() / 3 * reduction) * 3;
+			float stepError = 0.0f;
+
+			next.resize(level.size());
+			next.resize(simplifyMesh(next.data(), level.data(), level.size(), vertices.data(), vertexCount, floatsPerVertex, target, FLT_MAX, &stepError));
+
+			// Locked borders and seams stop the simplifier at some point
+			if (next.empty() || next.size() > level.size() * 9 / 10)
+				break;
+
+			level.swap(next);
+			error += stepError;
+		}
+
+		next.resize(level.size());
+		optimizeVertexCache(next.data(), level.data(), level.size(), vertexCount);
+		level.swap(next);
+
+		chain.levels.push_back({ (uint32_t)all.size(), (uint32_t)level.size(), error });
+		all.insert(all.end(), level.begin(), level.end());
+	}
+
+	// The finest level decides the vertex order, coarser levels use a subset of it
+	std::vector<float> fetchOrder(vertices.size());
+	size_t used = optimizeVertexFetch(fetchOrder.data(), all.data(), all.size(), vertices.data(), vertexCount, floatsPerVertex * sizeof(float));
+	fetchOrder.resize(used * floatsPerVertex);
+
+	vertices.swap(fetchOrder);
+	indices.swap(all);
+}
+
+void lodSelector::setView(const glm::vec3& cameraPosition, float fovDegrees, int viewportHeight)
+{
+	eye = cameraPosition;
+	pixelsPerUnit = (float)viewportHeight / (2.0f * std::tan(glm::radians(fovDegrees) * 0.5f));
+}
+
+float lodSelector::projectedError(const lodChain& chain, int level, const glm::vec3& centre, float scale) const
+{
+	// Distance to the nearest point of the bounding sphere, inside it every error is too big
+	float distance = glm::length(centre - eye) - chain.radius * scale;
+	if (distance <= 1e-4f)
+		return chain.levels[level].error > 0.0f ? FLT_MAX : 0.0f;
+
+	return chain.levels[level].error * scale / distance * pixelsPerUnit;
+}
+
+int lodSelector::select(const lodChain& chain, const glm::vec3& centre, float scale, int current) const
+{
+	int count = (int)chain.levels.size();
+	if (count == 0)
+		return 0;
+
+	int level = std::min(std::max(current, 0), count - 1);
+
+	if (projectedError(chain, level, centre, scale) > thresholdPixels * (1.0f + hysteresis))
+	{
+		while (level > 0 && projectedError(chain, level, centre, scale) > thresholdPixels)
+			level--;
+		return level;
+	}
+
+	while (level + 1 < count && projectedError(chain, level + 1, centre, scale) <= thresholdPixels * (1.0f - hysteresis))
+		level++;
+	return level;
+}
+
+void drawLod(const lodChain& chain, int level, GLenum indexType)
+{
+	const meshLod& lod = chain.levels[level];
+	glDrawElements(GL_TRIANGLES, (GLsizei)lod.indexCount, indexType, (void*)((size_t)lod.indexOffset * EBO::typeSize(indexType)));
+}
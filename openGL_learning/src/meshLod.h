@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef MESH_LOD_CLASS
+#define MESH_LOD_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm.hpp>
+
+/*
+	Level of detail chains.
+
+	buildLodChain simplifies a mesh a few times, every level keeping about half of the
+	triangles of the one before, and appends every level to the same index list. The vertex
+	buffer is shared by all levels and the index list goes into one EBO, so switching level is
+	only a different count and byte offset in glDrawElements.
+
+	Each level remembers its geometric error, lodSelector projects that error to pixels for
+	the current camera and picks the coarsest level below the threshold. Going coarser needs
+	the error to be a margin below the threshold and going finer a margin above it, so an
+	object sitting right at a switching distance does not flicker between two levels.
+*/
+
+struct meshLod
+{
+	uint32_t indexOffset;
+	uint32_t indexCount;
+	// Largest distance the surface moved compared to level 0, in mesh units
+	float error;
+};
+
+struct lodChain
+{
+	std::vector<meshLod> levels;
+	glm::vec3 centre = glm::vec3(0.0f);
+	float radius = 0.0f;
+};
+
+const int lodMaxLevels = 8;
+
+// Replaces indices with all levels back to back and reorders vertices for the finest one,
+// positions are the first three floats of every vertex
+void buildLodChain(std::vector<float>& vertices, std::vector<uint32_t>& indices, size_t floatsPerVertex,
+	lodChain& chain, int maxLevels = lodMaxLevels, float reduction = 0.5f);
+
+class lodSelector
+{
+	public:
+		// Switching point in pixels and the relative margin around it
+		float thresholdPixels = 1.0f;
+		float hysteresis = 0.25f;
+
+		// Has to be called when the camera or viewport changes
+		void setView(const glm::vec3& cameraPosition, float fovDegrees, int viewportHeight);
+
+		// Error of a level in pixels, for an object placed at centre with a uniform scale
+		float projectedError(const lodChain& chain, int level, const glm::vec3& centre, float scale) const;
+
+		// Level to draw next frame given the one drawn this frame
+		int select(const lodChain& chain, const glm::vec3& centre, float scale, int current) const;
+
+	private:
+		glm::vec3 eye = glm::vec3(0.0f);
+		float pixelsPerUnit = 1.0f;
+};
+
+// Draws one level out of the shared index buffer bound to the current VAO
+void drawLod(const lodChain& chain, int level, GLenum indexType);
+
+#endif
@@ -0,0 +1,345 @@
+#include "meshOptimize.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+static const uint32_t noVertex = 0xFFFFFFFFu;
+
+// FIFO cache emulated with timestamps: a vertex is cached while fewer than cacheSize
+// misses happened after its own, moving the clock forward by cacheSize + 1 empties it
+struct fifoCache
+{
+	std::vector<uint32_t> time;
+	uint32_t now;
+	unsigned size;
+
+	fifoCache(size_t vertexCount, unsigned cacheSize) : time(vertexCount, 0), now(cacheSize + 1), size(cacheSize) {}
+
+	bool cached(uint32_t v) const
+	{
+		return now - time[v] <= size;
+	}
+
+	// Returns 1 on a miss
+	unsigned touch(uint32_t v)
+	{
+		if (cached(v))
+			return 0;
+		time[v] = now++;
+		return 1;
+	}
+
+	void clear()
+	{
+		now += size + 1;
+	}
+};
+
+vertexCacheStats analyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize)
+{
+	vertexCacheStats stats;
+	fifoCache cache(vertexCount, cacheSize);
+	std::vector<char> used(vertexCount, 0);
+	size_t unique = 0;
+
+	for (size_t i = 0; i < indexCount; i++)
+	{
+		stats.transformed += cache.touch(indices[i]);
+		if (!used[indices[i]])
+		{
+			used[indices[i]] = 1;
+			unique++;
+		}
+	}
+
+	if (indexCount >= 3)
+		stats.acmr = (float)stats.transformed / (float)(indexCount / 3);
+	if (unique > 0)
+		stats.atvr = (float)stats.transformed / (float)unique;
+	return stats;
+}
+
+void optimizeVertexCache(uint32_t* destination, const uint32_t* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize, std::vector<uint32_t>* clusters)
+{
+	size_t faceCount = indexCount / 3;
+	if (clusters)
+		clusters->clear();
+	if (faceCount == 0)
+		return;
+
+	// Triangles around every vertex, live counts how many of them are not emitted yet
+	std::vector<uint32_t> live(vertexCount, 0);
+	for (size_t i = 0; i < faceCount * 3; i++)
+		live[indices[i]]++;
+
+	std::vector<uint32_t> offsets(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; v++)
+		offsets[v + 1] = offsets[v] + live[v];
+
+	std::vector<uint32_t> adjacency(faceCount * 3);
+	std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+	for (size_t f = 0; f < faceCount; f++)
+	{
+		for (int k = 0; k < 3; k++)
+			adjacency[fill[indices[f * 3 + k]]++] = (uint32_t)f;
+	}
+
+	fifoCache cache(vertexCount, cacheSize);
+	std::vector<char> emitted(faceCount, 0);
+	std::vector<uint32_t> deadEnd;
+	deadEnd.reserve(faceCount * 3);
+
+	size_t cursor = 0;
+	size_t written = 0;
+
+	while (cursor < vertexCount && live[cursor] == 0)
+		cursor++;
+	uint32_t fan = cursor < vertexCount ? (uint32_t)cursor : noVertex;
+
+	if (clusters)
+		clusters->push_back(0);
+
+	while (fan != noVertex)
+	{
+		// Emit every remaining triangle around the fanning vertex
+		size_t candidates = deadEnd.size();
+
+		for (uint32_t j = offsets[fan]; j < offsets[fan + 1]; j++)
+		{
+			uint32_t f = adjacency[j];
+			if (emitted[f])
+				continue;
+
+			for (int k = 0; k < 3; k++)
+			{
+				uint32_t v = indices[f * 3 + k];
+				destination[written++] = v;
+				deadEnd.push_back(v);
+				live[v]--;
+				cache.touch(v);
+			}
+			emitted[f] = 1;
+		}
+
+		// Next fan: the oldest candidate that will still be cached after its own triangles
+		uint32_t best = noVertex;
+		long long bestPriority = -1;
+
+		for (size_t j = candidates; j < deadEnd.size(); j++)
+		{
+			uint32_t v = deadEnd[j];
+			if (live[v] == 0)
+				continue;
+
+			long long age = (long long)(cache.now - cache.time[v]);
+			long long priority = age + 2 * (long long)live[v] <= (long long)cacheSize ? age : 0;
+			if (priority > bestPriority)
+			{
+				best = v;
+				bestPriority = priority;
+			}
+		}
+
+		// Dead end: back up through recently used vertices, then scan for any unfinished one
+		if (best == noVertex)
+		{
+			while (!deadEnd.empty() && best == noVertex)
+			{
+				uint32_t v = deadEnd.back();
+				deadEnd.pop_back();
+				if (live[v] > 0)
+					best = v;
+			}
+
+			while (best == noVertex && cursor < vertexCount)
+			{
+				if (live[cursor] > 0)
+					best = (uint32_t)cursor;
+				else
+					cursor++;
+			}
+
+			if (best != noVertex && clusters)
+				clusters->push_back((uint32_t)written);
+		}
+
+		fan = best;
+	}
+}
+
+void optimizeOverdraw(uint32_t* destination, const uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& clusters,
+	const float* positions, size_t vertexCount, size_t positionStride, float threshold, unsigned cacheSize)
+{
+	size_t faceCount = indexCount / 3;
+	if (faceCount == 0)
+		return;
+
+	fifoCache cache(vertexCount, cacheSize);
+
+	auto misses = [&](size_t f)
+	{
+		return cache.touch(indices[f * 3]) + cache.touch(indices[f * 3 + 1]) + cache.touch(indices[f * 3 + 2]);
+	};
+
+	// Cut every hard cluster again as soon as the part so far is within threshold of the
+	// cluster's own ACMR, the smaller pieces can then be reordered almost for free
+	std::vector<size_t> starts;
+	for (size_t c = 0; c < clusters.size(); c++)
+	{
+		size_t begin = clusters[c] / 3;
+		size_t end = c + 1 < clusters.size() ? clusters[c + 1] / 3 : faceCount;
+		if (begin >= end)
+			continue;
+
+		cache.clear();
+		unsigned clusterMisses = 0;
+		for (size_t f = begin; f < end; f++)
+			clusterMisses += misses(f);
+
+		float limit = threshold * (float)clusterMisses / (float)(end - begin);
+
+		cache.clear();
+		starts.push_back(begin);
+		unsigned running = 0;
+		size_t runBegin = begin;
+
+		for (size_t f = begin; f + 1 < end; f++)
+		{
+			running += misses(f);
+			if ((float)running / (float)(f + 1 - runBegin) <= limit)
+			{
+				starts.push_back(f + 1);
+				cache.clear();
+				running = 0;
+				runBegin = f + 1;
+			}
+		}
+	}
+
+	auto position = [&](uint32_t v)
+	{
+		return positions + (size_t)v * positionStride;
+	};
+
+	// Area weighted centroid of the whole mesh
+	double meshCentre[3] = { 0.0, 0.0, 0.0 };
+	double meshArea = 0.0;
+
+	std::vector<float> faceData(faceCount * 7);
+	for (size_t f = 0; f < faceCount; f++)
+	{
+		const float* a = position(indices[f * 3]);
+		const float* b = position(indices[f * 3 + 1]);
+		const float* c = position(indices[f * 3 + 2]);
+
+		float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+		float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+		float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+		float* d = &faceData[f * 7];
+		for (int k = 0; k < 3; k++)
+		{
+			d[k] = (a[k] + b[k] + c[k]) / 3.0f;
+			d[3 + k] = n[k];
+			meshCentre[k] += d[k] * area;
+		}
+		d[6] = area;
+		meshArea += area;
+	}
+
+	for (int k = 0; k < 3; k++)
+		meshCentre[k] = meshArea > 0.0 ? meshCentre[k] / meshArea : 0.0;
+
+	// Clusters facing away from the centre are on the outside and go first
+	std::vector<float> keys(starts.size());
+	for (size_t c = 0; c < starts.size(); c++)
+	{
+		size_t end = c + 1 < starts.size() ? starts[c + 1] : faceCount;
+		double centre[3] = { 0.0, 0.0, 0.0 };
+		double normal[3] = { 0.0, 0.0, 0.0 };
+		double area = 0.0;
+
+		for (size_t f = starts[c]; f < end; f++)
+		{
+			const float* d = &faceData[f * 7];
+			for (int k = 0; k < 3; k++)
+			{
+				centre[k] += d[k] * d[6];
+				normal[k] += d[3 + k];
+			}
+			area += d[6];
+		}
+
+		double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		double key = 0.0;
+		if (area > 0.0 && length > 0.0)
+		{
+			for (int k = 0; k < 3; k++)
+				key += (centre[k] / area - meshCentre[k]) * normal[k] / length;
+		}
+		keys[c] = (float)key;
+	}
+
+	std::vector<uint32_t> order(starts.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+	size_t written = 0;
+	for (uint32_t c : order)
+	{
+		size_t end = c + 1 < starts.size() ? starts[c + 1] : faceCount;
+		for (size_t f = starts[c]; f < end; f++)
+		{
+			destination[written++] = indices[f * 3];
+			destination[written++] = indices[f * 3 + 1];
+			destination[written++] = indices[f * 3 + 2];
+		}
+	}
+}
+
+size_t optimizeVertexFetch(void* destination, uint32_t* indices, size_t indexCount, const void* vertices, size_t vertexCount, size_t vertexSize)
+{
+	std::vector<uint32_t> remap(vertexCount, noVertex);
+	unsigned char* out = (unsigned char*)destination;
+	const unsigned char* in = (const unsigned char*)vertices;
+	uint32_t next = 0;
+
+	for (size_t i = 0; i < indexCount; i++)
+	{
+		uint32_t v = indices[i];
+		if (remap[v] == noVertex)
+		{
+			remap[v] = next;
+			std::memcpy(out + (size_t)next * vertexSize, in + (size_t)v * vertexSize, vertexSize);
+			next++;
+		}
+		indices[i] = remap[v];
+	}
+
+	return next;
+}
+
+meshOptimizeReport optimizeMesh(std::vector<float>& vertices, std::vector<uint32_t>& indices, size_t floatsPerVertex)
+{
+	meshOptimizeReport report;
+	size_t vertexCount = vertices.size() / floatsPerVertex;
+	indices.resize(indices.size() - indices.size() % 3);
+
+	report.before = analyzeVertexCache(indices.data(), indices.size(), vertexCount);
+
+	std::vector<uint32_t> cacheOrder(indices.size());
+	std::vector<uint32_t> clusters;
+	optimizeVertexCache(cacheOrder.data(), indices.data(), indices.size(), vertexCount, vertexCacheSize, &clusters);
+	optimizeOverdraw(indices.data(), cacheOrder.data(), cacheOrder.size(), clusters, vertices.data(), vertexCount, floatsPerVertex);
+
+	std::vector<float> fetchOrder(vertices.size());
+	size_t used = optimizeVertexFetch(fetchOrder.data(), indices.data(), indices.size(), vertices.data(), vertexCount, floatsPerVertex * sizeof(float));
+	fetchOrder.resize(used * floatsPerVertex);
+	vertices.swap(fetchOrder);
+
+	report.after = analyzeVertexCache(indices.data(), indices.size(), used);
+	return report;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef MESH_OPTIMIZE_CLASS
+#define MESH_OPTIMIZE_CLASS
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+	Offline reordering of indexed triangle lists, run once after import:
+
+		1. optimizeVertexCache  Tipsify (Sander et al. 2007), orders triangles so vertices are
+		                        reused while they are still in the post-transform cache
+		2. optimizeOverdraw     splits that order into clusters that keep the cache behaviour
+		                        and sorts the clusters outside-in, so near surfaces tend to be
+		                        drawn first and the depth test rejects more fragments
+		3. optimizeVertexFetch  renumbers vertices in first-use order so the vertex fetch reads
+		                        memory linearly and drops unreferenced vertices
+
+	ACMR (transformed vertices per triangle, 0.5 is ideal for a regular grid, 3 is worst) and
+	ATVR (transformed vertices per unique vertex, 1 is ideal) are measured on a FIFO cache.
+*/
+
+const unsigned vertexCacheSize = 16;
+
+struct vertexCacheStats
+{
+	size_t transformed = 0;
+	float acmr = 0.0f;
+	float atvr = 0.0f;
+};
+
+vertexCacheStats analyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize = vertexCacheSize);
+
+// destination may not alias indices, clusters receives the first index of every hard cluster
+void optimizeVertexCache(uint32_t* destination, const uint32_t* indices, size_t indexCount, size_t vertexCount,
+	unsigned cacheSize = vertexCacheSize, std::vector<uint32_t>* clusters = nullptr);
+
+// indices must come from optimizeVertexCache, threshold is how much ACMR may be given up (1.05 = 5%)
+void optimizeOverdraw(uint32_t* destination, const uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& clusters,
+	const float* positions, size_t vertexCount, size_t positionStride, float threshold = 1.05f, unsigned cacheSize = vertexCacheSize);
+
+// Rewrites indices in place, returns the number of vertices written to destination
+size_t optimizeVertexFetch(void* destination, uint32_t* indices, size_t indexCount, const void* vertices, size_t vertexCount, size_t vertexSize);
+
+struct meshOptimizeReport
+{
+	vertexCacheStats before;
+	vertexCacheStats after;
+};
+
+// All three passes on interleaved float vertices with the position in the first three floats
+meshOptimizeReport optimizeMesh(std::vector<float>& vertices, std::vector<uint32_t>& indices, size_t floatsPerVertex);
+
+#endif
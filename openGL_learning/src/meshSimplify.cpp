@@ -0,0 +1,284 @@
+#include "meshSimplify.h"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+// Symmetric 3x3 A, vector b and constant c of sum(area * (n.p + d)^2), w is the summed area
+struct quadric
+{
+	double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+	double b0 = 0, b1 = 0, b2 = 0;
+	double c = 0;
+	double w = 0;
+
+	void addPlane(const double n[3], double d, double weight)
+	{
+		a00 += weight * n[0] * n[0];
+		a01 += weight * n[0] * n[1];
+		a02 += weight * n[0] * n[2];
+		a11 += weight * n[1] * n[1];
+		a12 += weight * n[1] * n[2];
+		a22 += weight * n[2] * n[2];
+		b0 += weight * n[0] * d;
+		b1 += weight * n[1] * d;
+		b2 += weight * n[2] * d;
+		c += weight * d * d;
+		w += weight;
+	}
+
+	void add(const quadric& q)
+	{
+		a00 += q.a00; a01 += q.a01; a02 += q.a02;
+		a11 += q.a11; a12 += q.a12; a22 += q.a22;
+		b0 += q.b0; b1 += q.b1; b2 += q.b2;
+		c += q.c;
+		w += q.w;
+	}
+
+	// Mean squared distance of p to the accumulated planes
+	double error(const float* p) const
+	{
+		double x = p[0], y = p[1], z = p[2];
+		double e = a00 * x * x + a11 * y * y + a22 * z * z
+			+ 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+			+ 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+		return w > 0.0 ? std::fabs(e) / w : 0.0;
+	}
+};
+
+struct collapse
+{
+	uint32_t from;
+	uint32_t to;
+	double cost;
+};
+
+static void triangleNormal(const float* a, const float* b, const float* c, double n[3])
+{
+	double e1[3] = { (double)b[0] - a[0], (double)b[1] - a[1], (double)b[2] - a[2] };
+	double e2[3] = { (double)c[0] - a[0], (double)c[1] - a[1], (double)c[2] - a[2] };
+	n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+	n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+	n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+size_t simplifyMesh(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+	const float* positions, size_t vertexCount, size_t positionStride,
+	size_t targetIndexCount, float errorLimit, float* error)
+{
+	auto position = [&](uint32_t v)
+	{
+		return positions + (size_t)v * positionStride;
+	};
+
+	std::vector<uint32_t> current(indices, indices + indexCount - indexCount % 3);
+	double maxCost = 0.0;
+	double costLimit = (double)errorLimit * errorLimit;
+
+	// Vertices sharing a position: the first one stands in for all of them in the topology
+	// and all of them are locked, collapsing one side of a seam would tear it open
+	std::vector<uint32_t> canonical(vertexCount);
+	std::vector<char> locked(vertexCount, 0);
+	{
+		auto key = [&](uint32_t v)
+		{
+			std::array<uint32_t, 3> bits;
+			std::memcpy(bits.data(), position(v), sizeof(bits));
+			return bits;
+		};
+
+		std::vector<uint32_t> order(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; v++)
+			order[v] = v;
+		std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return key(a) < key(b) || (key(a) == key(b) && a < b); });
+
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			bool same = i > 0 && key(order[i]) == key(order[i - 1]);
+			canonical[order[i]] = same ? canonical[order[i - 1]] : order[i];
+			if (same)
+				locked[order[i]] = locked[order[i - 1]] = 1;
+		}
+	}
+
+	// An edge seen in only one direction is on a border
+	{
+		std::vector<uint64_t> forward, backward;
+		forward.reserve(current.size());
+		backward.reserve(current.size());
+
+		for (size_t i = 0; i < current.size(); i += 3)
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				uint64_t a = canonical[current[i + k]], b = canonical[current[i + (k + 1) % 3]];
+				forward.push_back(a << 32 | b);
+				backward.push_back(b << 32 | a);
+			}
+		}
+
+		std::sort(forward.begin(), forward.end());
+		std::sort(backward.begin(), backward.end());
+
+		std::vector<uint64_t> border;
+		std::set_difference(forward.begin(), forward.end(), backward.begin(), backward.end(), std::back_inserter(border));
+
+		// Other vertices at the same position are already locked as a seam
+		for (uint64_t edge : border)
+		{
+			locked[(uint32_t)(edge >> 32)] = 1;
+			locked[(uint32_t)edge] = 1;
+		}
+	}
+
+	std::vector<quadric> quadrics(vertexCount);
+	for (size_t i = 0; i < current.size(); i += 3)
+	{
+		double n[3];
+		triangleNormal(position(current[i]), position(current[i + 1]), position(current[i + 2]), n);
+
+		double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (length == 0.0)
+			continue;
+
+		n[0] /= length;
+		n[1] /= length;
+		n[2] /= length;
+
+		const float* p = position(current[i]);
+		double d = -(n[0] * p[0] + n[1] * p[1] + n[2] * p[2]);
+		double area = length * 0.5;
+
+		for (int k = 0; k < 3; k++)
+			quadrics[current[i + k]].addPlane(n, d, area);
+	}
+
+	std::vector<uint32_t> offsets(vertexCount + 1);
+	std::vector<uint32_t> adjacency;
+	std::vector<collapse> candidates;
+	std::vector<char> touched(vertexCount);
+	std::vector<uint32_t> remap(vertexCount);
+
+	while (current.size() > targetIndexCount)
+	{
+		// Triangles around every vertex for this pass
+		std::fill(offsets.begin(), offsets.end(), 0);
+		for (uint32_t v : current)
+			offsets[v + 1]++;
+		for (size_t v = 0; v < vertexCount; v++)
+			offsets[v + 1] += offsets[v];
+
+		adjacency.resize(current.size());
+		std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < current.size(); i++)
+			adjacency[fill[current[i]]++] = (uint32_t)(i / 3);
+
+		candidates.clear();
+		for (size_t i = 0; i < current.size(); i += 3)
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				// Interior edges show up once in each direction, border edges are locked anyway
+				uint32_t a = current[i + k], b = current[i + (k + 1) % 3];
+				if (a > b || (locked[a] && locked[b]))
+					continue;
+
+				quadric q = quadrics[a];
+				q.add(quadrics[b]);
+
+				// The cheaper of the two directions
+				double toB = locked[a] ? DBL_MAX : q.error(position(b));
+				double toA = locked[b] ? DBL_MAX : q.error(position(a));
+				if (toB <= toA)
+					candidates.push_back({ a, b, toB });
+				else
+					candidates.push_back({ b, a, toA });
+			}
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const collapse& x, const collapse& y) { return x.cost < y.cost; });
+
+		// Every interior collapse removes two triangles
+		size_t trianglesLeft = (current.size() - targetIndexCount) / 3;
+		size_t removed = 0;
+
+		std::fill(touched.begin(), touched.end(), 0);
+		for (uint32_t v = 0; v < vertexCount; v++)
+			remap[v] = v;
+
+		for (const collapse& c : candidates)
+		{
+			if (removed >= trianglesLeft || c.cost > costLimit)
+				break;
+			if (touched[c.from] || touched[c.to])
+				continue;
+
+			// Reject collapses that turn a remaining triangle over
+			bool flips = false;
+			size_t dies = 0;
+			for (uint32_t j = offsets[c.from]; j < offsets[c.from + 1] && !flips; j++)
+			{
+				const uint32_t* t = &current[(size_t)adjacency[j] * 3];
+				if (t[0] == c.to || t[1] == c.to || t[2] == c.to)
+				{
+					dies++;
+					continue;
+				}
+
+				const float* before[3];
+				const float* after[3];
+				for (int k = 0; k < 3; k++)
+				{
+					before[k] = position(t[k]);
+					after[k] = t[k] == c.from ? position(c.to) : before[k];
+				}
+
+				double n0[3], n1[3];
+				triangleNormal(before[0], before[1], before[2], n0);
+				triangleNormal(after[0], after[1], after[2], n1);
+				flips = n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] <= 0.0;
+			}
+
+			if (flips)
+				continue;
+
+			// Neighbours stay put for the rest of the pass so the flip test above stays valid
+			for (uint32_t j = offsets[c.from]; j < offsets[c.from + 1]; j++)
+			{
+				const uint32_t* t = &current[(size_t)adjacency[j] * 3];
+				touched[t[0]] = touched[t[1]] = touched[t[2]] = 1;
+			}
+
+			remap[c.from] = c.to;
+			quadrics[c.to].add(quadrics[c.from]);
+			maxCost = std::max(maxCost, c.cost);
+			removed += dies;
+		}
+
+		if (removed == 0)
+			break;
+
+		size_t write = 0;
+		for (size_t i = 0; i < current.size(); i += 3)
+		{
+			uint32_t a = remap[current[i]], b = remap[current[i + 1]], c = remap[current[i + 2]];
+			if (a == b || b == c || a == c)
+				continue;
+			current[write++] = a;
+			current[write++] = b;
+			current[write++] = c;
+		}
+		current.resize(write);
+	}
+
+	if (!current.empty())
+		std::memmove(destination, current.data(), current.size() * sizeof(uint32_t));
+	if (error)
+		*error = (float)std::sqrt(maxCost);
+	return current.size();
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef MESH_SIMPLIFY_CLASS
+#define MESH_SIMPLIFY_CLASS
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Quadric error metric simplification (Garland & Heckbert 1997).
+
+	Edges are collapsed onto one of their existing vertices, so the vertex buffer stays the
+	same and only the index list shrinks, which is what lets every LOD of a mesh share one
+	VBO. Every pass collects the cheapest collapses over the whole mesh, rejects the ones that
+	would flip a triangle and applies the rest, until the target count or the error limit is
+	reached.
+
+	Border vertices and vertices on an attribute seam (same position, several vertices) never
+	move, so open edges and uv / normal seams are kept exactly.
+*/
+
+// Writes at most indexCount indices to destination (which may alias indices) and returns how
+// many were written. error receives the largest collapse error as a distance in mesh units.
+size_t simplifyMesh(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+	const float* positions, size_t vertexCount, size_t positionStride,
+	size_t targetIndexCount, float errorLimit, float* error = nullptr);
+
+#endif
@@ -0,0 +1,277 @@
+#include "meshlet.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+static glm::vec3 position(const float* vertices, size_t floatsPerVertex, uint32_t index)
+{
+	const float* p = vertices + (size_t)index * floatsPerVertex;
+	return glm::vec3(p[0], p[1], p[2]);
+}
+
+static void computeBounds(meshlet& m, const uint32_t* indices, const float* vertices, size_t floatsPerVertex)
+{
+	glm::vec3 low(FLT_MAX), high(-FLT_MAX);
+	for (uint32_t i = 0; i < m.indexCount; i++)
+	{
+		glm::vec3 p = position(vertices, floatsPerVertex, indices[m.indexOffset + i]);
+		low = glm::min(low, p);
+		high = glm::max(high, p);
+	}
+
+	m.centre = (low + high) * 0.5f;
+	m.radius = 0.0f;
+	for (uint32_t i = 0; i < m.indexCount; i++)
+		m.radius = std::max(m.radius, glm::length(position(vertices, floatsPerVertex, indices[m.indexOffset + i]) - m.centre));
+
+	// Area weighted normal sum for the axis, the widest unit normal for the spread
+	glm::vec3 sum(0.0f);
+	for (uint32_t i = 0; i < m.indexCount; i += 3)
+	{
+		const uint32_t* t = indices + m.indexOffset + i;
+		glm::vec3 a = position(vertices, floatsPerVertex, t[0]);
+		sum += glm::cross(position(vertices, floatsPerVertex, t[1]) - a, position(vertices, floatsPerVertex, t[2]) - a);
+	}
+
+	m.coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+	m.coneCutoff = 1.0f;
+
+	float length = glm::length(sum);
+	if (length <= 0.0f)
+		return;
+	glm::vec3 axis = sum / length;
+
+	float minDot = 1.0f;
+	for (uint32_t i = 0; i < m.indexCount; i += 3)
+	{
+		const uint32_t* t = indices + m.indexOffset + i;
+		glm::vec3 a = position(vertices, floatsPerVertex, t[0]);
+		glm::vec3 n = glm::cross(position(vertices, floatsPerVertex, t[1]) - a, position(vertices, floatsPerVertex, t[2]) - a);
+		float nLength = glm::length(n);
+		if (nLength > 0.0f)
+			minDot = std::min(minDot, glm::dot(n / nLength, axis));
+	}
+
+	m.coneAxis = axis;
+	// Half angle of 90 degrees or more, some triangle always faces the camera
+	if (minDot > 0.0f)
+		m.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+}
+
+void buildMeshlets(meshletSet& set, uint32_t* indices, size_t indexCount, const float* vertices, size_t vertexCount, size_t floatsPerVertex,
+	size_t maxVertices, size_t maxTriangles, jobSystem& jobs)
+{
+	set.meshlets.clear();
+
+	size_t triangleCount = indexCount / 3;
+	if (triangleCount == 0 || vertexCount == 0)
+		return;
+
+	// Triangles around every vertex
+	std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+	for (size_t i = 0; i < triangleCount * 3; i++)
+		adjacencyOffsets[indices[i] + 1]++;
+	for (size_t v = 0; v < vertexCount; v++)
+		adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+
+	std::vector<uint32_t> adjacency(triangleCount * 3);
+	std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+	for (size_t i = 0; i < triangleCount * 3; i++)
+		adjacency[fill[indices[i]]++] = (uint32_t)(i / 3);
+
+	std::vector<glm::vec3> centroids(triangleCount);
+	for (size_t t = 0; t < triangleCount; t++)
+	{
+		centroids[t] = (position(vertices, floatsPerVertex, indices[t * 3]) + position(vertices, floatsPerVertex, indices[t * 3 + 1])
+			+ position(vertices, floatsPerVertex, indices[t * 3 + 2])) / 3.0f;
+	}
+
+	std::vector<unsigned char> emitted(triangleCount, 0);
+	// Meshlet number + 1 of the last meshlet a vertex went into
+	std::vector<uint32_t> stamp(vertexCount, 0);
+
+	std::vector<uint32_t> order;
+	order.reserve(triangleCount * 3);
+	std::vector<uint32_t> meshletVertices;
+	size_t seed = 0;
+
+	while (order.size() < triangleCount * 3)
+	{
+		uint32_t id = (uint32_t)set.meshlets.size() + 1;
+		meshlet m = {};
+		m.indexOffset = (uint32_t)order.size();
+		meshletVertices.clear();
+
+		glm::vec3 centroidSum(0.0f);
+		int64_t last = -1;
+
+		for (;;)
+		{
+			// Best neighbour: fewest new vertices, then closest to the meshlet centre
+			int64_t best = -1;
+			int bestExtra = 4;
+			float bestDistance = FLT_MAX;
+			glm::vec3 centre = m.indexCount > 0 ? centroidSum / (float)(m.indexCount / 3) : glm::vec3(0.0f);
+
+			auto consider = [&](uint32_t vertex)
+			{
+				for (uint32_t a = adjacencyOffsets[vertex]; a < adjacencyOffsets[vertex + 1]; a++)
+				{
+					uint32_t t = adjacency[a];
+					if (emitted[t])
+						continue;
+
+					int extra = (stamp[indices[t * 3]] != id) + (stamp[indices[t * 3 + 1]] != id) + (stamp[indices[t * 3 + 2]] != id);
+					float distance = glm::dot(centroids[t] - centre, centroids[t] - centre);
+					if (extra < bestExtra || (extra == bestExtra && distance < bestDistance))
+					{
+						best = t;
+						bestExtra = extra;
+						bestDistance = distance;
+					}
+				}
+			};
+
+			if (last >= 0)
+			{
+				for (int k = 0; k < 3; k++)
+					consider(indices[last * 3 + k]);
+			}
+
+			// The last triangle is boxed in, go back through the meshlet's other vertices
+			for (size_t v = meshletVertices.size(); best < 0 && v > 0; v--)
+				consider(meshletVertices[v - 1]);
+
+			// Nothing left around this meshlet, carry on with the next triangle in index order
+			if (best < 0)
+			{
+				while (emitted[seed])
+					seed++;
+				best = (int64_t)seed;
+				bestExtra = (stamp[indices[seed * 3]] != id) + (stamp[indices[seed * 3 + 1]] != id) + (stamp[indices[seed * 3 + 2]] != id);
+			}
+
+			if (meshletVertices.size() + bestExtra > maxVertices || m.indexCount / 3 + 1 > maxTriangles)
+				break;
+
+			emitted[best] = 1;
+			for (int k = 0; k < 3; k++)
+			{
+				uint32_t vertex = indices[best * 3 + k];
+				if (stamp[vertex] != id)
+				{
+					stamp[vertex] = id;
+					meshletVertices.push_back(vertex);
+				}
+				order.push_back(vertex);
+			}
+			m.indexCount += 3;
+			centroidSum += centroids[best];
+			last = best;
+
+			if (order.size() == triangleCount * 3)
+				break;
+		}
+
+		m.vertexCount = (uint32_t)meshletVertices.size();
+		set.meshlets.push_back(m);
+	}
+
+	std::memcpy(indices, order.data(), order.size() * sizeof(uint32_t));
+
+	jobs.parallelFor(set.meshlets.size(), [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+			computeBounds(set.meshlets[i], indices, vertices, floatsPerVertex);
+	}, 256);
+}
+
+size_t cullMeshlets(const meshletSet& set, const uint32_t* indices, const glm::mat4& model, const glm::mat4& viewProjection,
+	const glm::vec3& cameraPosition, std::vector<uint32_t>& out, meshletCullStats* stats,
+	const occlusionCuller* occlusion, jobSystem& jobs)
+{
+	// World space frustum planes from the rows of the matrix
+	glm::vec4 planes[6];
+	for (int i = 0; i < 3; i++)
+	{
+		glm::vec4 row(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+		glm::vec4 w(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+		planes[i * 2] = w + row;
+		planes[i * 2 + 1] = w - row;
+	}
+	for (glm::vec4& plane : planes)
+		plane /= glm::length(glm::vec3(plane));
+
+	float scale = std::max(glm::length(glm::vec3(model[0])), std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+	// The cone test runs in model space
+	glm::vec3 eye = glm::vec3(glm::inverse(model) * glm::vec4(cameraPosition, 1.0f));
+
+	size_t count = set.meshlets.size();
+	// 0 visible, 1 outside, 2 backfacing, 3 occluded
+	std::vector<unsigned char> result(count);
+
+	jobs.parallelFor(count, [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			const meshlet& m = set.meshlets[i];
+			glm::vec3 centre = glm::vec3(model * glm::vec4(m.centre, 1.0f));
+			float radius = m.radius * scale;
+
+			unsigned char r = 0;
+			for (const glm::vec4& plane : planes)
+			{
+				if (glm::dot(glm::vec3(plane), centre) + plane.w < -radius)
+				{
+					r = 1;
+					break;
+				}
+			}
+
+			if (r == 0)
+			{
+				glm::vec3 toCentre = m.centre - eye;
+				if (glm::dot(toCentre, m.coneAxis) >= m.coneCutoff * glm::length(toCentre) + m.radius)
+					r = 2;
+			}
+
+			if (r == 0 && occlusion && !occlusion->visible(centre - glm::vec3(radius), centre + glm::vec3(radius)))
+				r = 3;
+
+			result[i] = r;
+		}
+	}, 256);
+
+	out.clear();
+	size_t counts[4] = { 0, 0, 0, 0 };
+	size_t i = 0;
+	while (i < count)
+	{
+		counts[result[i]]++;
+		if (result[i] != 0)
+		{
+			i++;
+			continue;
+		}
+
+		// A run of visible meshlets is one contiguous block of indices
+		size_t first = i++;
+		while (i < count && result[i] == 0)
+			counts[result[i++]]++;
+
+		const meshlet& a = set.meshlets[first];
+		const meshlet& b = set.meshlets[i - 1];
+		out.insert(out.end(), indices + a.indexOffset, indices + b.indexOffset + b.indexCount);
+	}
+
+	if (stats)
+	{
+		stats->tested = count;
+		stats->outside = counts[1];
+		stats->backfacing = counts[2];
+		stats->occluded = counts[3];
+	}
+	return out.size();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef MESHLET_CLASS
+#define MESHLET_CLASS
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "jobSystem.h"
+#include "occlusionCuller.h"
+
+/*
+	Meshlets: a mesh cut into small clusters of neighbouring triangles, each with a bounding
+	sphere and a normal cone, so big meshes can be culled piece by piece.
+
+		meshletSet set;
+		buildMeshlets(set, indices, indexCount, vertices, vertexCount, floatsPerVertex);
+		...
+		size_t count = cullMeshlets(set, indices, model, projection * view, cam.position, visibleIndices);
+		// visibleIndices -> dynamic EBO, one glDrawElements
+
+	buildMeshlets reorders the triangles so every meshlet is a contiguous range of the index
+	buffer. cullMeshlets copies the ranges of the surviving meshlets into one compacted
+	index buffer, neighbouring survivors are copied as one block.
+
+	A meshlet is rejected when its sphere is outside the frustum, when the camera sees the
+	back of every triangle in it (normal cone) or when the occlusion culler hides its box.
+	The cone test assumes counter clockwise front faces and a model without non-uniform scale.
+*/
+
+const size_t meshletMaxVertices = 64;
+const size_t meshletMaxTriangles = 124;
+
+struct meshlet
+{
+	uint32_t indexOffset;
+	uint32_t indexCount;
+	uint32_t vertexCount;
+
+	// Bounding sphere in model space
+	glm::vec3 centre;
+	float radius;
+
+	// Average facing of the triangles, backfacing for every camera position with
+	// dot(centre - camera, coneAxis) >= coneCutoff * |centre - camera| + radius.
+	// coneCutoff is 1 when the triangles face too many ways, which never culls.
+	glm::vec3 coneAxis;
+	float coneCutoff;
+};
+
+struct meshletSet
+{
+	std::vector<meshlet> meshlets;
+};
+
+struct meshletCullStats
+{
+	size_t tested = 0;
+	size_t outside = 0;
+	size_t backfacing = 0;
+	size_t occluded = 0;
+};
+
+// Positions are the first three floats of every vertex, indices are reordered in place
+void buildMeshlets(meshletSet& set, uint32_t* indices, size_t indexCount, const float* vertices, size_t vertexCount, size_t floatsPerVertex,
+	size_t maxVertices = meshletMaxVertices, size_t maxTriangles = meshletMaxTriangles, jobSystem& jobs = jobSystem::shared());
+
+// Writes the indices of the visible meshlets to out, returns their count. cameraPosition
+// is in world space, occlusion is optional and must already be rasterized for this frame.
+size_t cullMeshlets(const meshletSet& set, const uint32_t* indices, const glm::mat4& model, const glm::mat4& viewProjection,
+	const glm::vec3& cameraPosition, std::vector<uint32_t>& out, meshletCullStats* stats = nullptr,
+	const occlusionCuller* occlusion = nullptr, jobSystem& jobs = jobSystem::shared());
+
+#endif
@@ -0,0 +1,293 @@
+#include "nullGL.h"
+
+#include <cstring>
+#include <vector>
+
+// The generic stub below is called through every glad function pointer type, which only
+// works where the caller cleans up the stack (x64 / System V), not with 32 bit __stdcall.
+static_assert(sizeof(void*) == 8, "The null GL backend needs a 64 bit calling convention");
+
+static GLuint nextName = 1;
+static std::vector<char> mapScratch;
+
+static void APIENTRY nullNoop()
+{
+}
+
+static const GLubyte* APIENTRY nullGetString(GLenum name)
+{
+	switch (name)
+	{
+	case GL_VERSION:
+		return (const GLubyte*)"4.6.0 null";
+	case GL_SHADING_LANGUAGE_VERSION:
+		return (const GLubyte*)"4.60 null";
+	default:
+		return (const GLubyte*)"null";
+	}
+}
+
+// glad needs at least one extension string on a 3.x context or loading fails
+static const GLubyte* APIENTRY nullGetStringi(GLenum, GLuint)
+{
+	return (const GLubyte*)"GL_null_backend";
+}
+
+static GLint viewport[4] = { 0, 0, 800, 600 };
+
+static void APIENTRY nullViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	viewport[0] = x;
+	viewport[1] = y;
+	viewport[2] = width;
+	viewport[3] = height;
+}
+
+// Limits of a typical desktop GPU, so code sizing things from them gets sane numbers
+static void APIENTRY nullGetIntegerv(GLenum pname, GLint* data)
+{
+	switch (pname)
+	{
+	case GL_NUM_EXTENSIONS:
+		*data = 1;
+		break;
+	case GL_MAJOR_VERSION:
+		*data = 4;
+		break;
+	case GL_MINOR_VERSION:
+		*data = 6;
+		break;
+	case GL_VIEWPORT:
+		std::memcpy(data, viewport, sizeof(viewport));
+		break;
+	case GL_MAX_TEXTURE_SIZE:
+	case GL_MAX_RENDERBUFFER_SIZE:
+		*data = 16384;
+		break;
+	case GL_MAX_3D_TEXTURE_SIZE:
+	case GL_MAX_ARRAY_TEXTURE_LAYERS:
+		*data = 2048;
+		break;
+	case GL_MAX_COLOR_ATTACHMENTS:
+	case GL_MAX_DRAW_BUFFERS:
+	case GL_MAX_SAMPLES:
+		*data = 8;
+		break;
+	case GL_MAX_VERTEX_ATTRIBS:
+		*data = 16;
+		break;
+	case GL_MAX_TEXTURE_IMAGE_UNITS:
+		*data = 32;
+		break;
+	case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+		*data = 192;
+		break;
+	case GL_MAX_UNIFORM_BLOCK_SIZE:
+		*data = 65536;
+		break;
+	case GL_MAX_TEXTURE_BUFFER_SIZE:
+		*data = 134217728;
+		break;
+	case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+		*data = 256;
+		break;
+	default:
+		*data = 0;
+	}
+}
+
+static void APIENTRY nullGetFloatv(GLenum, GLfloat* data)
+{
+	*data = 0.0f;
+}
+
+static void APIENTRY nullGenNames(GLsizei n, GLuint* names)
+{
+	for (GLsizei i = 0; i < n; i++)
+		names[i] = nextName++;
+}
+
+static GLuint APIENTRY nullCreateShader(GLenum)
+{
+	return nextName++;
+}
+
+static GLuint APIENTRY nullCreateProgram()
+{
+	return nextName++;
+}
+
+// Compile, link and validate status are reported as successful, log lengths as empty
+static void APIENTRY nullGetObjectiv(GLuint, GLenum pname, GLint* params)
+{
+	switch (pname)
+	{
+	case GL_COMPILE_STATUS:
+	case GL_LINK_STATUS:
+	case GL_VALIDATE_STATUS:
+		*params = GL_TRUE;
+		break;
+	default:
+		*params = 0;
+	}
+}
+
+static void APIENTRY nullGetInfoLog(GLuint, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+	if (length)
+		*length = 0;
+	if (infoLog && bufSize > 0)
+		infoLog[0] = '\0';
+}
+
+static GLint APIENTRY nullGetLocation(GLuint, const GLchar*)
+{
+	return 0;
+}
+
+static GLenum APIENTRY nullGetError()
+{
+	return GL_NO_ERROR;
+}
+
+static GLenum APIENTRY nullCheckFramebufferStatus(GLenum)
+{
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+static GLboolean APIENTRY nullTrue()
+{
+	return GL_TRUE;
+}
+
+// Buffer data is dropped, only the largest size is remembered so maps have somewhere to write
+static void APIENTRY nullBufferData(GLenum, GLsizeiptr size, const void*, GLenum)
+{
+	if ((size_t)size > mapScratch.size())
+		mapScratch.resize((size_t)size);
+}
+
+static void* APIENTRY nullMapBuffer(GLenum, GLenum)
+{
+	return mapScratch.data();
+}
+
+static void* APIENTRY nullMapBufferRange(GLenum, GLintptr, GLsizeiptr length, GLbitfield)
+{
+	if ((size_t)length > mapScratch.size())
+		mapScratch.resize((size_t)length);
+	return mapScratch.data();
+}
+
+static void APIENTRY nullGetBufferParameteriv(GLenum, GLenum, GLint* params)
+{
+	*params = 0;
+}
+
+// Every attachment is there, depth stencil as the usual 24 + 8 bit unsigned normalized
+static void APIENTRY nullGetFramebufferAttachmentParameteriv(GLenum, GLenum, GLenum pname, GLint* params)
+{
+	switch (pname)
+	{
+	case GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE:
+		*params = GL_TEXTURE;
+		break;
+	case GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE:
+		*params = 24;
+		break;
+	case GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE:
+		*params = 8;
+		break;
+	case GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE:
+		*params = GL_UNSIGNED_NORMALIZED;
+		break;
+	default:
+		*params = 0;
+	}
+}
+
+static void APIENTRY nullGetQueryObjectiv(GLuint, GLenum pname, GLint* params)
+{
+	*params = (pname == GL_QUERY_RESULT_AVAILABLE) ? 1 : 0;
+}
+
+static void APIENTRY nullGetQueryObjectui64v(GLuint, GLenum pname, GLuint64* params)
+{
+	*params = (pname == GL_QUERY_RESULT_AVAILABLE) ? 1 : 0;
+}
+
+static GLsync APIENTRY nullFenceSync(GLenum, GLbitfield)
+{
+	return (GLsync)(size_t)nextName++;
+}
+
+static GLenum APIENTRY nullClientWaitSync(GLsync, GLbitfield, GLuint64)
+{
+	return GL_ALREADY_SIGNALED;
+}
+
+struct nullEntry
+{
+	const char* name;
+	void* proc;
+};
+
+static const nullEntry entries[] = {
+	{ "glGetString", (void*)&nullGetString },
+	{ "glGetStringi", (void*)&nullGetStringi },
+	{ "glGetIntegerv", (void*)&nullGetIntegerv },
+	{ "glViewport", (void*)&nullViewport },
+	{ "glGetFloatv", (void*)&nullGetFloatv },
+	{ "glGenBuffers", (void*)&nullGenNames },
+	{ "glGenVertexArrays", (void*)&nullGenNames },
+	{ "glGenTextures", (void*)&nullGenNames },
+	{ "glGenFramebuffers", (void*)&nullGenNames },
+	{ "glGenRenderbuffers", (void*)&nullGenNames },
+	{ "glGenQueries", (void*)&nullGenNames },
+	{ "glGenSamplers", (void*)&nullGenNames },
+	{ "glGenTransformFeedbacks", (void*)&nullGenNames },
+	{ "glCreateShader", (void*)&nullCreateShader },
+	{ "glCreateProgram", (void*)&nullCreateProgram },
+	{ "glGetShaderiv", (void*)&nullGetObjectiv },
+	{ "glGetProgramiv", (void*)&nullGetObjectiv },
+	{ "glGetShaderInfoLog", (void*)&nullGetInfoLog },
+	{ "glGetProgramInfoLog", (void*)&nullGetInfoLog },
+	{ "glGetUniformLocation", (void*)&nullGetLocation },
+	{ "glGetAttribLocation", (void*)&nullGetLocation },
+	{ "glGetUniformBlockIndex", (void*)&nullGetLocation },
+	{ "glGetFragDataLocation", (void*)&nullGetLocation },
+	{ "glGetError", (void*)&nullGetError },
+	{ "glCheckFramebufferStatus", (void*)&nullCheckFramebufferStatus },
+	{ "glUnmapBuffer", (void*)&nullTrue },
+	{ "glBufferData", (void*)&nullBufferData },
+	{ "glMapBuffer", (void*)&nullMapBuffer },
+	{ "glMapBufferRange", (void*)&nullMapBufferRange },
+	{ "glGetBufferParameteriv", (void*)&nullGetBufferParameteriv },
+	{ "glGetFramebufferAttachmentParameteriv", (void*)&nullGetFramebufferAttachmentParameteriv },
+	{ "glGetQueryObjectiv", (void*)&nullGetQueryObjectiv },
+	{ "glGetQueryObjectuiv", (void*)&nullGetQueryObjectiv },
+	{ "glGetQueryObjecti64v", (void*)&nullGetQueryObjectui64v },
+	{ "glGetQueryObjectui64v", (void*)&nullGetQueryObjectui64v },
+	{ "glFenceSync", (void*)&nullFenceSync },
+	{ "glClientWaitSync", (void*)&nullClientWaitSync },
+};
+
+void* nullGLGetProcAddress(const char* name)
+{
+	for (const nullEntry& entry : entries)
+	{
+		if (std::strcmp(entry.name, name) == 0)
+			return entry.proc;
+	}
+
+	// glIsBuffer, glIsEnabled, ... all answer yes
+	if (std::strncmp(name, "glIs", 4) == 0)
+		return (void*)&nullTrue;
+
+	return (void*)&nullNoop;
+}
+
+int nullGLLoad()
+{
+	return gladLoadGLLoader((GLADloadproc)nullGLGetProcAddress);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef NULL_GL_CLASS
+#define NULL_GL_CLASS
+
+#include <glad/glad.h>
+
+/*
+	A headless OpenGL "driver" for glad.
+
+	Every entry point is replaced by a stub that does no GPU work, so the CPU side of the
+	renderer (uniform updates, binds, draw submission, shader setup) can be run and timed
+	without a window, a context or a graphics driver.
+
+	Object names are handed out from a counter, compile / link status is always GL_TRUE,
+	glMapBuffer returns scratch memory, glGetIntegerv answers the usual limits and the last
+	glViewport, which is enough for the classes in this project.
+	It reports a 4.6 context, so loadGLModern (glModern.h) succeeds and the GPU driven paths
+	can be timed as well.
+*/
+
+// Points glad at the null backend, returns the same as gladLoadGLLoader
+int nullGLLoad();
+
+// Address of a null stub by name, usable directly as a GLADloadproc
+void* nullGLGetProcAddress(const char* name);
+
+#endif
@@ -0,0 +1,408 @@
+#include "occlusionCuller.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include "profiler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OCCLUSION_SSE
+#endif
+
+// Rows per rasterizer job, every job owns its rows so no two workers write the same pixel
+static const int bandRows = 8;
+
+// A box as 12 counter clockwise triangles seen from outside
+static const int boxTriangles[36] = {
+	0, 2, 1, 1, 2, 3,  // -z
+	4, 5, 6, 5, 7, 6,  // +z
+	0, 1, 4, 1, 5, 4,  // -y
+	2, 6, 3, 3, 6, 7,  // +y
+	0, 4, 2, 2, 4, 6,  // -x
+	1, 3, 5, 3, 7, 5,  // +x
+};
+
+occlusionCuller::occlusionCuller(int width, int height)
+{
+	width = std::max(4, (width + 3) & ~3);
+	height = std::max(1, height);
+
+	for (;;)
+	{
+		levels.push_back({ width, height, std::vector<float>((size_t)width * height, 1.0f) });
+		if (width == 1 && height == 1)
+			break;
+		width = std::max(1, (width + 1) / 2);
+		height = std::max(1, (height + 1) / 2);
+	}
+}
+
+int occlusionCuller::width() const
+{
+	return levels[0].width;
+}
+
+int occlusionCuller::height() const
+{
+	return levels[0].height;
+}
+
+const float* occlusionCuller::depth(int level) const
+{
+	return levels[level].depth.data();
+}
+
+void occlusionCuller::beginFrame(const glm::mat4& matrix)
+{
+	viewProjection = matrix;
+	candidates.clear();
+	occluders.clear();
+}
+
+// Clip space in, screen space out; back faces and anything crossing the near plane are dropped
+void occlusionCuller::addTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+{
+	const glm::vec4* clip[3] = { &a, &b, &c };
+	screenTriangle t;
+	t.z = 0.0f;
+
+	for (int k = 0; k < 3; k++)
+	{
+		const glm::vec4& p = *clip[k];
+		if (p.w <= 1e-5f || p.z < -p.w)
+			return;
+
+		float inverse = 1.0f / p.w;
+		t.x[k] = (p.x * inverse * 0.5f + 0.5f) * levels[0].width;
+		t.y[k] = (p.y * inverse * 0.5f + 0.5f) * levels[0].height;
+		t.z = std::max(t.z, p.z * inverse * 0.5f + 0.5f);
+	}
+
+	float area = (t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) - (t.x[2] - t.x[0]) * (t.y[1] - t.y[0]);
+	if (area <= 0.0f || t.z > 1.0f)
+		return;
+
+	candidates.push_back(t);
+	occluders.back().triangleCount++;
+	occluders.back().size += area;
+}
+
+void occlusionCuller::addOccluder(const glm::vec3& boxMin, const glm::vec3& boxMax)
+{
+	occluders.push_back({ candidates.size(), 0, 0.0f });
+
+	glm::vec4 corners[8];
+	for (int i = 0; i < 8; i++)
+	{
+		glm::vec3 p((i & 1) ? boxMax.x : boxMin.x, (i & 2) ? boxMax.y : boxMin.y, (i & 4) ? boxMax.z : boxMin.z);
+		corners[i] = viewProjection * glm::vec4(p, 1.0f);
+	}
+
+	for (int i = 0; i < 36; i += 3)
+		addTriangle(corners[boxTriangles[i]], corners[boxTriangles[i + 1]], corners[boxTriangles[i + 2]]);
+}
+
+void occlusionCuller::addOccluder(const float* vertices, size_t floatsPerVertex, const uint32_t* indices, size_t indexCount, const glm::mat4& model)
+{
+	occluders.push_back({ candidates.size(), 0, 0.0f });
+	glm::mat4 matrix = viewProjection * model;
+
+	for (size_t i = 0; i + 2 < indexCount; i += 3)
+	{
+		glm::vec4 clip[3];
+		for (int k = 0; k < 3; k++)
+		{
+			const float* p = vertices + (size_t)indices[i + k] * floatsPerVertex;
+			clip[k] = matrix * glm::vec4(p[0], p[1], p[2], 1.0f);
+		}
+		addTriangle(clip[0], clip[1], clip[2]);
+	}
+}
+
+void occlusionCuller::rasterizeRows(int rowBegin, int rowEnd)
+{
+	hizLevel& target = levels[0];
+	std::fill(target.depth.begin() + (size_t)rowBegin * target.width, target.depth.begin() + (size_t)rowEnd * target.width, 1.0f);
+
+	for (const screenTriangle& t : triangles)
+	{
+		float lowY = std::min(t.y[0], std::min(t.y[1], t.y[2]));
+		float highY = std::max(t.y[0], std::max(t.y[1], t.y[2]));
+		int y0 = std::max(rowBegin, (int)std::floor(std::max(lowY, 0.0f)));
+		int y1 = std::min(rowEnd - 1, (int)std::ceil(std::min(highY, (float)rowEnd)));
+		if (y0 > y1)
+			continue;
+
+		float lowX = std::min(t.x[0], std::min(t.x[1], t.x[2]));
+		float highX = std::max(t.x[0], std::max(t.x[1], t.x[2]));
+		int x0 = (int)std::floor(std::max(lowX, 0.0f)) & ~3;
+		int x1 = std::min(target.width - 1, (int)std::ceil(std::min(highX, (float)target.width)));
+		if (x0 > x1)
+			continue;
+
+		// Edge functions A x + B y + C, positive inside a counter clockwise triangle
+		float a[3], b[3], c[3];
+		for (int k = 0; k < 3; k++)
+		{
+			int n = (k + 1) % 3;
+			a[k] = t.y[k] - t.y[n];
+			b[k] = t.x[n] - t.x[k];
+			c[k] = -(a[k] * t.x[k] + b[k] * t.y[k]);
+		}
+
+		for (int y = y0; y <= y1; y++)
+		{
+			float* row = &target.depth[(size_t)y * target.width];
+			float py = y + 0.5f;
+
+#ifdef OCCLUSION_SSE
+			__m128 z = _mm_set1_ps(t.z);
+			__m128 zero = _mm_setzero_ps();
+			__m128 e[3], step[3];
+			for (int k = 0; k < 3; k++)
+			{
+				float start = a[k] * (x0 + 0.5f) + b[k] * py + c[k];
+				e[k] = _mm_add_ps(_mm_set1_ps(start), _mm_mul_ps(_mm_set1_ps(a[k]), _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f)));
+				step[k] = _mm_set1_ps(a[k] * 4.0f);
+			}
+
+			for (int x = x0; x <= x1; x += 4)
+			{
+				__m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(e[0], zero), _mm_cmpgt_ps(e[1], zero)), _mm_cmpgt_ps(e[2], zero));
+				__m128 old = _mm_loadu_ps(row + x);
+				__m128 nearer = _mm_min_ps(old, z);
+				_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+
+				for (int k = 0; k < 3; k++)
+					e[k] = _mm_add_ps(e[k], step[k]);
+			}
+#else
+			for (int x = x0; x <= x1; x++)
+			{
+				float px = x + 0.5f;
+				if (a[0] * px + b[0] * py + c[0] > 0.0f && a[1] * px + b[1] * py + c[1] > 0.0f && a[2] * px + b[2] * py + c[2] > 0.0f)
+					row[x] = std::min(row[x], t.z);
+			}
+#endif
+		}
+	}
+}
+
+// Farthest depth of the 2x2 block below every texel
+void occlusionCuller::buildLevel(int level, int rowBegin, int rowEnd)
+{
+	const hizLevel& source = levels[level - 1];
+	hizLevel& target = levels[level];
+
+	for (int y = rowBegin; y < rowEnd; y++)
+	{
+		const float* row0 = &source.depth[(size_t)std::min(2 * y, source.height - 1) * source.width];
+		const float* row1 = &source.depth[(size_t)std::min(2 * y + 1, source.height - 1) * source.width];
+		float* out = &target.depth[(size_t)y * target.width];
+
+		for (int x = 0; x < target.width; x++)
+		{
+			int x0 = std::min(2 * x, source.width - 1);
+			int x1 = std::min(2 * x + 1, source.width - 1);
+			out[x] = std::max(std::max(row0[x0], row0[x1]), std::max(row1[x0], row1[x1]));
+		}
+	}
+}
+
+void occlusionCuller::rasterize(jobSystem& jobs)
+{
+	PROFILE_SCOPE("occlusionCuller::rasterize");
+
+	// Largest occluders first, the small ones rarely hide anything
+	std::sort(occluders.begin(), occluders.end(), [](const occluder& a, const occluder& b) { return a.size > b.size; });
+
+	triangles.clear();
+	for (size_t i = 0; i < occluders.size() && i < (size_t)maxOccluders; i++)
+		triangles.insert(triangles.end(), candidates.begin() + occluders[i].firstTriangle, candidates.begin() + occluders[i].firstTriangle + occluders[i].triangleCount);
+
+	int height = levels[0].height;
+	jobs.parallelFor((size_t)(height + bandRows - 1) / bandRows, [&](size_t begin, size_t end)
+	{
+		rasterizeRows((int)begin * bandRows, std::min(height, (int)end * bandRows));
+	});
+
+	for (int level = 1; level < (int)levels.size(); level++)
+	{
+		jobs.parallelFor((size_t)levels[level].height, [&](size_t begin, size_t end)
+		{
+			buildLevel(level, (int)begin, (int)end);
+		}, 16);
+	}
+}
+
+// 0 visible, 1 hidden behind the occluders, 2 outside the view
+int occlusionCuller::classify(const glm::vec3& boxMin, const glm::vec3& boxMax) const
+{
+	const int levelCount = (int)levels.size();
+	const int width = levels[0].width;
+	const int height = levels[0].height;
+
+	// Corners as the clip position of boxMin plus any combination of the three edges
+	glm::vec4 origin = viewProjection * glm::vec4(boxMin, 1.0f);
+	glm::vec3 size = boxMax - boxMin;
+	glm::vec4 edges[3] = { viewProjection[0] * size.x, viewProjection[1] * size.y, viewProjection[2] * size.z };
+
+	float lowX, lowY, highX, highY, nearest;
+
+#ifdef OCCLUSION_SSE
+	// Corners 0-3 and 4-7 (the second four add the z edge), one SSE lane per corner
+	__m128 px = _mm_add_ps(_mm_set1_ps(origin.x), _mm_set_ps(edges[0].x + edges[1].x, edges[1].x, edges[0].x, 0.0f));
+	__m128 py = _mm_add_ps(_mm_set1_ps(origin.y), _mm_set_ps(edges[0].y + edges[1].y, edges[1].y, edges[0].y, 0.0f));
+	__m128 pz = _mm_add_ps(_mm_set1_ps(origin.z), _mm_set_ps(edges[0].z + edges[1].z, edges[1].z, edges[0].z, 0.0f));
+	__m128 pw = _mm_add_ps(_mm_set1_ps(origin.w), _mm_set_ps(edges[0].w + edges[1].w, edges[1].w, edges[0].w, 0.0f));
+	__m128 qx = _mm_add_ps(px, _mm_set1_ps(edges[2].x));
+	__m128 qy = _mm_add_ps(py, _mm_set1_ps(edges[2].y));
+	__m128 qz = _mm_add_ps(pz, _mm_set1_ps(edges[2].z));
+	__m128 qw = _mm_add_ps(pw, _mm_set1_ps(edges[2].w));
+
+	// All eight corners outside the same frustum plane
+	__m128 npw = _mm_sub_ps(_mm_setzero_ps(), pw), nqw = _mm_sub_ps(_mm_setzero_ps(), qw);
+	if (_mm_movemask_ps(_mm_and_ps(_mm_cmplt_ps(px, npw), _mm_cmplt_ps(qx, nqw))) == 15 ||
+		_mm_movemask_ps(_mm_and_ps(_mm_cmpgt_ps(px, pw), _mm_cmpgt_ps(qx, qw))) == 15 ||
+		_mm_movemask_ps(_mm_and_ps(_mm_cmplt_ps(py, npw), _mm_cmplt_ps(qy, nqw))) == 15 ||
+		_mm_movemask_ps(_mm_and_ps(_mm_cmpgt_ps(py, pw), _mm_cmpgt_ps(qy, qw))) == 15 ||
+		_mm_movemask_ps(_mm_and_ps(_mm_cmplt_ps(pz, npw), _mm_cmplt_ps(qz, nqw))) == 15 ||
+		_mm_movemask_ps(_mm_and_ps(_mm_cmpgt_ps(pz, pw), _mm_cmpgt_ps(qz, qw))) == 15)
+		return 2;
+
+	// Touching the near plane, nothing can be said
+	__m128 epsilon = _mm_set1_ps(1e-5f);
+	__m128 nearPlane = _mm_or_ps(
+		_mm_or_ps(_mm_cmple_ps(pw, epsilon), _mm_cmplt_ps(pz, npw)),
+		_mm_or_ps(_mm_cmple_ps(qw, epsilon), _mm_cmplt_ps(qz, nqw)));
+	if (_mm_movemask_ps(nearPlane))
+		return 0;
+
+	__m128 half = _mm_set1_ps(0.5f);
+	__m128 pInverse = _mm_div_ps(half, pw), qInverse = _mm_div_ps(half, qw);
+	__m128 sx = _mm_min_ps(_mm_mul_ps(px, pInverse), _mm_mul_ps(qx, qInverse));
+	__m128 tx = _mm_max_ps(_mm_mul_ps(px, pInverse), _mm_mul_ps(qx, qInverse));
+	__m128 sy = _mm_min_ps(_mm_mul_ps(py, pInverse), _mm_mul_ps(qy, qInverse));
+	__m128 ty = _mm_max_ps(_mm_mul_ps(py, pInverse), _mm_mul_ps(qy, qInverse));
+	__m128 sz = _mm_min_ps(_mm_mul_ps(pz, pInverse), _mm_mul_ps(qz, qInverse));
+
+	// Horizontal min / max of the four lanes
+	auto lanesMin = [](__m128 v)
+	{
+		v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(v);
+	};
+	auto lanesMax = [](__m128 v)
+	{
+		v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(v);
+	};
+
+	lowX = (lanesMin(sx) + 0.5f) * width;
+	highX = (lanesMax(tx) + 0.5f) * width;
+	lowY = (lanesMin(sy) + 0.5f) * height;
+	highY = (lanesMax(ty) + 0.5f) * height;
+	nearest = lanesMin(sz) + 0.5f;
+#else
+	lowX = lowY = nearest = 1e30f;
+	highX = highY = -1e30f;
+	bool left = true, right = true, below = true, above = true, front = true, behind = true, crossing = false;
+
+	for (int i = 0; i < 8; i++)
+	{
+		glm::vec4 p = origin;
+		if (i & 1) p += edges[0];
+		if (i & 2) p += edges[1];
+		if (i & 4) p += edges[2];
+
+		left = left && p.x < -p.w;
+		right = right && p.x > p.w;
+		below = below && p.y < -p.w;
+		above = above && p.y > p.w;
+		front = front && p.z < -p.w;
+		behind = behind && p.z > p.w;
+
+		// Touching the near plane, nothing can be said once the frustum test is done
+		if (p.w <= 1e-5f || p.z < -p.w)
+		{
+			crossing = true;
+			continue;
+		}
+
+		float inverse = 1.0f / p.w;
+		float x = (p.x * inverse * 0.5f + 0.5f) * width;
+		float y = (p.y * inverse * 0.5f + 0.5f) * height;
+		lowX = std::min(lowX, x);
+		highX = std::max(highX, x);
+		lowY = std::min(lowY, y);
+		highY = std::max(highY, y);
+		nearest = std::min(nearest, p.z * inverse * 0.5f + 0.5f);
+	}
+
+	if (left || right || below || above || front || behind)
+		return 2;
+	if (crossing)
+		return 0;
+#endif
+
+	lowX = std::max(lowX, 0.0f);
+	lowY = std::max(lowY, 0.0f);
+	highX = std::min(highX, (float)width - 1.0f);
+	highY = std::min(highY, (float)height - 1.0f);
+
+	// Level where the rectangle spans at most about two texels
+	float extent = std::max(highX - lowX, highY - lowY);
+	int level = 0;
+	while (level + 1 < levelCount && extent > 2.0f * (float)(1 << level))
+		level++;
+
+	int x0 = (int)lowX >> level, x1 = (int)highX >> level;
+	int y0 = (int)lowY >> level, y1 = (int)highY >> level;
+	const hizLevel& hiz = levels[level];
+	x1 = std::min(x1, hiz.width - 1);
+	y1 = std::min(y1, hiz.height - 1);
+
+	float farthest = 0.0f;
+	for (int y = y0; y <= y1; y++)
+	{
+		for (int x = x0; x <= x1; x++)
+			farthest = std::max(farthest, hiz.depth[(size_t)y * hiz.width + x]);
+	}
+
+	return nearest > farthest ? 1 : 0;
+}
+
+bool occlusionCuller::visible(const glm::vec3& boxMin, const glm::vec3& boxMax) const
+{
+	return classify(boxMin, boxMax) == 0;
+}
+
+void occlusionCuller::testBounds(const glm::vec3* boxMins, const glm::vec3* boxMaxs, size_t count, unsigned char* visibility, jobSystem& jobs)
+{
+	PROFILE_SCOPE("occlusionCuller::testBounds");
+
+	std::atomic<size_t> occluded{ 0 };
+	std::atomic<size_t> outside{ 0 };
+
+	jobs.parallelFor(count, [&](size_t begin, size_t end)
+	{
+		size_t hidden = 0, culled = 0;
+		for (size_t i = begin; i < end; i++)
+		{
+			int result = classify(boxMins[i], boxMaxs[i]);
+			visibility[i] = result == 0;
+			hidden += result == 1;
+			culled += result == 2;
+		}
+		occluded += hidden;
+		outside += culled;
+	}, 1024);
+
+	lastTested = count;
+	lastOccluded = occluded;
+	lastOutside = outside;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef OCCLUSION_CULLER_CLASS
+#define OCCLUSION_CULLER_CLASS
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "jobSystem.h"
+
+/*
+	Software occlusion culling on a small depth buffer.
+
+	Every frame:
+
+		culler.beginFrame(projection * view);
+		for (big boxes) culler.addOccluder(min, max);
+		culler.rasterize();                                   // occluders -> depth -> Hi-Z
+		culler.testBounds(mins, maxs, count, visible);        // before any draw is recorded
+
+	Only the largest occluders on screen are drawn (maxOccluders), their triangles are
+	rasterized with SSE four pixels at a time, every horizontal band of the buffer on its own
+	worker. Each triangle writes its farthest depth, so the buffer is never nearer than the
+	real occluders and nothing visible is culled. Triangles crossing the near plane are left
+	out for the same reason.
+
+	The Hi-Z pyramid keeps the farthest depth of every 2x2 block. An object is tested on the
+	level where its screen rectangle covers at most a few texels: hidden if its nearest depth
+	is behind the farthest depth of all those texels.
+
+	Depth is 0 at the near plane and 1 at the far plane, triangles are counter clockwise.
+*/
+
+class occlusionCuller
+{
+	public:
+		int maxOccluders = 64;
+
+		// Objects hidden / outside the view after the last testBounds
+		size_t lastTested = 0;
+		size_t lastOccluded = 0;
+		size_t lastOutside = 0;
+
+		// width is rounded up to a multiple of 4
+		occlusionCuller(int width = 256, int height = 128);
+
+		void beginFrame(const glm::mat4& viewProjection);
+
+		// World space box, e.g. a Cuboid
+		void addOccluder(const glm::vec3& boxMin, const glm::vec3& boxMax);
+		// Any closed triangle mesh, positions are the first three floats of every vertex
+		void addOccluder(const float* vertices, size_t floatsPerVertex, const uint32_t* indices, size_t indexCount, const glm::mat4& model);
+
+		void rasterize(jobSystem& jobs = jobSystem::shared());
+
+		bool visible(const glm::vec3& boxMin, const glm::vec3& boxMax) const;
+		// visibility[i] = 1 if box i may be visible
+		void testBounds(const glm::vec3* boxMins, const glm::vec3* boxMaxs, size_t count, unsigned char* visibility, jobSystem& jobs = jobSystem::shared());
+
+		int width() const;
+		int height() const;
+		// Level 0 is the full resolution depth buffer
+		const float* depth(int level = 0) const;
+
+	private:
+		struct screenTriangle
+		{
+			float x[3];
+			float y[3];
+			float z;     // farthest of the three
+		};
+
+		struct occluder
+		{
+			size_t firstTriangle;
+			size_t triangleCount;
+			float size;  // rough projected area, larger is drawn first
+		};
+
+		struct hizLevel
+		{
+			int width;
+			int height;
+			std::vector<float> depth;
+		};
+
+		glm::mat4 viewProjection = glm::mat4(1.0f);
+		std::vector<hizLevel> levels;
+		std::vector<screenTriangle> candidates;
+		std::vector<occluder> occluders;
+		std::vector<screenTriangle> triangles;
+
+		void addTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c);
+		void rasterizeRows(int rowBegin, int rowEnd);
+		void buildLevel(int level, int rowBegin, int rowEnd);
+		int classify(const glm::vec3& boxMin, const glm::vec3& boxMax) const;
+};
+
+#endif
@@ -0,0 +1,471 @@
+#include "perfHud.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "glInstrument.h"
+#include "gpuMemory.h"
+#include "profiler.h"
+
+/*
+	5x7 glyphs of ASCII 32 to 95, one byte per row from the top, bit 4 is the left column
+*/
+static const int firstGlyph = 32;
+static const int glyphCount = 64;
+static const unsigned char glyphRows[glyphCount][7] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // space
+	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 }, // !
+	{ 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00 }, // "
+	{ 0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a }, // #
+	{ 0x04, 0x0f, 0x14, 0x0e, 0x05, 0x1e, 0x04 }, // $
+	{ 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 }, // %
+	{ 0x0c, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0d }, // &
+	{ 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '
+	{ 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 }, // (
+	{ 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 }, // )
+	{ 0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00 }, // *
+	{ 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00 }, // +
+	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x08 }, // ,
+	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00 }, // -
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c }, // .
+	{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 }, // /
+	{ 0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e }, // 0
+	{ 0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e }, // 1
+	{ 0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f }, // 2
+	{ 0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e }, // 3
+	{ 0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02 }, // 4
+	{ 0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e }, // 5
+	{ 0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e }, // 6
+	{ 0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 }, // 7
+	{ 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e }, // 8
+	{ 0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c }, // 9
+	{ 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00 }, // :
+	{ 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x04, 0x08 }, // ;
+	{ 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02 }, // <
+	{ 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 }, // =
+	{ 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08 }, // >
+	{ 0x0e, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 }, // ?
+	{ 0x0e, 0x11, 0x01, 0x0d, 0x15, 0x15, 0x0e }, // @
+	{ 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11 }, // A
+	{ 0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e }, // B
+	{ 0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e }, // C
+	{ 0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c }, // D
+	{ 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f }, // E
+	{ 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10 }, // F
+	{ 0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f }, // G
+	{ 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11 }, // H
+	{ 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e }, // I
+	{ 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c }, // J
+	{ 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 }, // K
+	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f }, // L
+	{ 0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11 }, // M
+	{ 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 }, // N
+	{ 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e }, // O
+	{ 0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10 }, // P
+	{ 0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d }, // Q
+	{ 0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11 }, // R
+	{ 0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e }, // S
+	{ 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // T
+	{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e }, // U
+	{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04 }, // V
+	{ 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a }, // W
+	{ 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11 }, // X
+	{ 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04 }, // Y
+	{ 0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f }, // Z
+	{ 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e }, // [
+	{ 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 }, // backslash
+	{ 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e }, // ]
+	{ 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00 }, // ^
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f }, // _
+};
+
+// Atlas of 8x8 cells, 16 to a row, the cell after the last glyph is solid
+static const int cellSize = 8;
+static const int cellsPerRow = 16;
+static const int atlasWidth = cellsPerRow * cellSize;
+static const int atlasHeight = (glyphCount / cellsPerRow + 1) * cellSize;
+static const int solidU = (glyphCount % cellsPerRow) * cellSize + 1;
+static const int solidV = (glyphCount / cellsPerRow) * cellSize + 1;
+
+static const GLubyte panelColour[4] = { 0, 0, 0, 170 };
+static const GLubyte textColour[4] = { 230, 230, 230, 255 };
+static const GLubyte noteColour[4] = { 150, 150, 150, 255 };
+static const GLubyte cpuColour[4] = { 90, 220, 90, 255 };
+static const GLubyte gpuColour[4] = { 240, 160, 40, 255 };
+static const GLubyte budgetColour[4] = { 255, 255, 255, 90 };
+static const GLubyte histogramColour[4] = { 140, 140, 160, 255 };
+static const GLubyte p50Colour[4] = { 255, 255, 255, 255 };
+static const GLubyte p95Colour[4] = { 250, 220, 60, 255 };
+static const GLubyte p99Colour[4] = { 240, 70, 60, 255 };
+
+// 60 Hz, the line drawn across the graphs
+static const float budgetMs = 1000.0f / 60.0f;
+
+frameTimeHistory::frameTimeHistory(size_t capacity)
+	: samples(std::max(capacity, (size_t)1), 0.0f)
+{
+	sorted.reserve(samples.size());
+}
+
+// The sorted copy is kept up to date here, a memmove of at most the window instead of a sort
+// per frame
+void frameTimeHistory::add(float ms)
+{
+	if (count == samples.size())
+		sorted.erase(std::lower_bound(sorted.begin(), sorted.end(), samples[next]));
+	else
+		count++;
+
+	samples[next] = ms;
+	next = (next + 1) % samples.size();
+	sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), ms), ms);
+}
+
+void frameTimeHistory::clear()
+{
+	next = 0;
+	count = 0;
+	sorted.clear();
+}
+
+size_t frameTimeHistory::size() const
+{
+	return count;
+}
+
+size_t frameTimeHistory::capacity() const
+{
+	return samples.size();
+}
+
+float frameTimeHistory::at(size_t i) const
+{
+	// No modulo, it is called for every bar of every frame
+	size_t index = next + i + (next >= count ? 0 : samples.size()) - count;
+	return samples[index >= samples.size() ? index - samples.size() : index];
+}
+
+float frameTimeHistory::newest() const
+{
+	return count > 0 ? at(count - 1) : 0.0f;
+}
+
+float frameTimeHistory::maximum() const
+{
+	return count > 0 ? sorted.back() : 0.0f;
+}
+
+float frameTimeHistory::percentile(float p) const
+{
+	if (count == 0)
+		return 0.0f;
+
+	size_t rank = (size_t)std::ceil(std::min(std::max(p, 0.0f), 1.0f) * count);
+	return sorted[std::min(std::max(rank, (size_t)1), count) - 1];
+}
+
+perfHud::perfHud(const std::string& shaderDirectory)
+	: program((shaderDirectory + "perfHud.vert").c_str(), (shaderDirectory + "perfHud.frag").c_str())
+{
+	program.use();
+	glUniform1i(glGetUniformLocation(program.ID, "atlas"), 0);
+	screenSizeLocation = glGetUniformLocation(program.ID, "screenSize");
+
+	createAtlas();
+
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &instanceBuffer);
+
+	// Every attribute is per instance, the corners come from gl_VertexID
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	glVertexAttribPointer(0, 4, GL_SHORT, GL_FALSE, sizeof(quad), (void*)offsetof(quad, x));
+	glVertexAttribDivisor(0, 1);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(quad), (void*)offsetof(quad, u));
+	glVertexAttribDivisor(1, 1);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(quad), (void*)offsetof(quad, colour));
+	glVertexAttribDivisor(2, 1);
+	glEnableVertexAttribArray(2);
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void perfHud::createAtlas()
+{
+	std::vector<unsigned char> texels((size_t)atlasWidth * atlasHeight, 0);
+	for (int glyph = 0; glyph < glyphCount; glyph++)
+	{
+		int left = (glyph % cellsPerRow) * cellSize;
+		int top = (glyph / cellsPerRow) * cellSize;
+		for (int row = 0; row < 7; row++)
+		{
+			for (int column = 0; column < 5; column++)
+			{
+				if (glyphRows[glyph][row] & (0x10 >> column))
+					texels[(size_t)(top + row) * atlasWidth + left + column] = 255;
+			}
+		}
+	}
+
+	for (int row = 0; row < cellSize; row++)
+	{
+		for (int column = 0; column < cellSize; column++)
+			texels[(size_t)(solidV - 1 + row) * atlasWidth + solidU - 1 + column] = 255;
+	}
+
+	glGenTextures(1, &atlas);
+	glBindTexture(GL_TEXTURE_2D, atlas);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlasWidth, atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, texels.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	gpuMemoryAllocate(gpuMemoryTexture, GL_TEXTURE, atlas, texels.size(), "perfHud atlas");
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void perfHud::addCpuTime(float ms)
+{
+	cpu.add(ms);
+}
+
+void perfHud::addGpuTime(float ms)
+{
+	gpu.add(ms);
+}
+
+void perfHud::addRect(int left, int top, int width, int height, const GLubyte colour[4])
+{
+	quads.push_back({ (GLshort)left, (GLshort)top, (GLshort)width, (GLshort)height, (GLubyte)solidU, (GLubyte)solidV, 1, 1, { colour[0], colour[1], colour[2], colour[3] } });
+}
+
+int perfHud::addText(int left, int top, const char* text, const GLubyte colour[4])
+{
+	for (; *text; text++)
+	{
+		int c = (unsigned char)*text;
+		if (c >= 'a' && c <= 'z')
+			c -= 'a' - 'A';
+		if (c < firstGlyph || c >= firstGlyph + glyphCount)
+			c = '?';
+
+		if (c != ' ')
+		{
+			int glyph = c - firstGlyph;
+			GLubyte u = (GLubyte)((glyph % cellsPerRow) * cellSize);
+			GLubyte v = (GLubyte)((glyph / cellsPerRow) * cellSize);
+			quads.push_back({ (GLshort)left, (GLshort)top, (GLshort)(5 * scale), (GLshort)(7 * scale), u, v, 5, 7, { colour[0], colour[1], colour[2], colour[3] } });
+		}
+		left += 6 * scale;
+	}
+	return left;
+}
+
+// One bar per sample, the newest at the right edge
+void perfHud::addGraph(int left, int top, int width, int height, const frameTimeHistory& history, float topMs, const GLubyte colour[4])
+{
+	int barWidth = std::max(width / (int)history.capacity(), 1);
+	int first = left + (int)(history.capacity() - history.size()) * barWidth;
+	for (size_t i = 0; i < history.size(); i++)
+	{
+		int barHeight = std::max((int)(std::min(history.at(i) / topMs, 1.0f) * height), 1);
+		addRect(first + (int)i * barWidth, top + height - barHeight, barWidth, barHeight, colour);
+	}
+
+	if (budgetMs < topMs)
+		addRect(left, top + height - (int)(budgetMs / topMs * height), width, 1, budgetColour);
+}
+
+// Frame times binned from 0 to topMs, slower ones in the last bin
+void perfHud::addHistogram(int left, int top, int width, int height, const frameTimeHistory& history, float topMs)
+{
+	const int binCount = 48;
+	int counts[binCount] = {};
+	int most = 1;
+	for (size_t i = 0; i < history.size(); i++)
+	{
+		int bin = std::min((int)(history.at(i) / topMs * binCount), binCount - 1);
+		most = std::max(most, ++counts[bin]);
+	}
+
+	int binWidth = std::max(width / binCount, 1);
+	for (int bin = 0; bin < binCount; bin++)
+	{
+		if (counts[bin] == 0)
+			continue;
+		int barHeight = std::max(counts[bin] * height / most, 1);
+		addRect(left + bin * binWidth, top + height - barHeight, binWidth - 1, barHeight, histogramColour);
+	}
+
+	const float ranks[3] = { 0.5f, 0.95f, 0.99f };
+	const GLubyte* colours[3] = { p50Colour, p95Colour, p99Colour };
+	for (int i = 0; i < 3; i++)
+	{
+		float ms = std::min(history.percentile(ranks[i]), topMs);
+		addRect(left + (int)(ms / topMs * binCount * binWidth), top, scale, height, colours[i]);
+	}
+}
+
+static void formatBytes(char* text, size_t size, unsigned long long bytes)
+{
+	if (bytes >= 1024ull * 1024ull)
+		std::snprintf(text, size, "%.1f MB", bytes / (1024.0 * 1024.0));
+	else if (bytes >= 1024ull)
+		std::snprintf(text, size, "%.1f KB", bytes / 1024.0);
+	else
+		std::snprintf(text, size, "%llu B", bytes);
+}
+
+void perfHud::draw(int windowWidth, int windowHeight)
+{
+	PROFILE_SCOPE("perfHud::draw");
+
+	if (!visible)
+	{
+		lastDrawMs = 0.0f;
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	quads.clear();
+	// The panel behind everything, sized once the rest is laid out
+	addRect(x, y, 0, 0, panelColour);
+
+	int s = scale;
+	int line = 10 * s;
+	int left = x + 4 * s;
+	int top = y + 4 * s;
+	int graphWidth = (int)cpu.capacity() * s;
+	int graphHeight = 20 * s;
+	char text[128];
+
+	// Shared by both graphs and the histogram: the first of 8.3, 16.7, 33.3, ... ms over the slowest frame
+	float topMs = budgetMs * 0.5f;
+	float slowest = std::max(cpu.maximum(), gpu.maximum());
+	while (topMs < slowest && topMs < 1000.0f)
+		topMs *= 2.0f;
+
+	std::snprintf(text, sizeof(text), "CPU %6.2f MS  P50 %5.2f  P95 %5.2f  P99 %5.2f", cpu.newest(), cpu.percentile(0.5f), cpu.percentile(0.95f), cpu.percentile(0.99f));
+	addText(left, top, text, cpuColour);
+	top += line;
+
+	if (gpu.size() > 0)
+		std::snprintf(text, sizeof(text), "GPU %6.2f MS  P50 %5.2f  P95 %5.2f  P99 %5.2f", gpu.newest(), gpu.percentile(0.5f), gpu.percentile(0.95f), gpu.percentile(0.99f));
+	else
+		std::snprintf(text, sizeof(text), "GPU    N/A");
+	addText(left, top, text, gpuColour);
+	top += line;
+
+	addGraph(left, top, graphWidth, graphHeight, cpu, topMs, cpuColour);
+	top += graphHeight + 2 * s;
+	addGraph(left, top, graphWidth, graphHeight, gpu, topMs, gpuColour);
+	top += graphHeight + 4 * s;
+
+	addHistogram(left, top, graphWidth, graphHeight, cpu, topMs);
+	top += graphHeight + 2 * s;
+	std::snprintf(text, sizeof(text), "CPU 0-%.0f MS ", topMs);
+	int labelEnd = addText(left, top, text, noteColour);
+	labelEnd = addText(labelEnd, top, "P50 ", p50Colour);
+	labelEnd = addText(labelEnd, top, "P95 ", p95Colour);
+	addText(labelEnd, top, "P99", p99Colour);
+	top += line + 2 * s;
+
+#ifdef OGL_GL_INSTRUMENT
+	// The last frame, this overlay's own draw of that frame included
+	const glFrameCounters& calls = glInstrumentLastFrame();
+	char uploaded[32];
+	formatBytes(uploaded, sizeof(uploaded), (unsigned long long)calls.uploadBytes);
+	std::snprintf(text, sizeof(text), "DRAWS %llu  TRIS %llu  BINDS %llu", (unsigned long long)calls.draws, (unsigned long long)calls.triangles, (unsigned long long)calls.binds);
+	addText(left, top, text, textColour);
+	top += line;
+	std::snprintf(text, sizeof(text), "UPLOADS %llu  %s  GL CALLS %llu", (unsigned long long)calls.uploads, uploaded, (unsigned long long)calls.calls);
+	addText(left, top, text, textColour);
+	top += line;
+#else
+	addText(left, top, "GL COUNTERS NEED OGL_GL_INSTRUMENT", noteColour);
+	top += line;
+#endif
+
+	const gpuMemoryUsage& memory = gpuMemoryCurrent();
+	char current[32], peak[32];
+	formatBytes(current, sizeof(current), (unsigned long long)memory.currentTotal);
+	formatBytes(peak, sizeof(peak), (unsigned long long)memory.peakTotal);
+	std::snprintf(text, sizeof(text), "GPU MEMORY %s  PEAK %s", current, peak);
+	addText(left, top, text, textColour);
+	top += line;
+
+	std::snprintf(text, sizeof(text), "HUD %.3f MS  %llu QUADS", lastDrawMs, (unsigned long long)quads.size());
+	addText(left, top, text, noteColour);
+	top += line;
+
+	quads[0].width = (GLshort)(graphWidth + 8 * s);
+	quads[0].height = (GLshort)(top + 2 * s - y);
+
+	GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+	GLboolean blend = glIsEnabled(GL_BLEND);
+	glDisable(GL_DEPTH_TEST);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	program.use();
+	glUniform2f(screenSizeLocation, (float)windowWidth, (float)windowHeight);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, atlas);
+
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	if (quads.size() > instanceCapacity)
+	{
+		instanceCapacity = std::max(quads.size(), instanceCapacity * 2);
+		gpuMemoryAllocate(gpuMemoryVertex, GL_BUFFER, instanceBuffer, instanceCapacity * sizeof(quad), "perfHud quads");
+	}
+	// Orphaned every frame, the driver hands out fresh storage instead of waiting on the last draw
+	glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(quad), nullptr, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, quads.size() * sizeof(quad), quads.data());
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)quads.size());
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	if (depthTest)
+		glEnable(GL_DEPTH_TEST);
+	if (!blend)
+		glDisable(GL_BLEND);
+
+	lastDrawMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t perfHud::quadCount() const
+{
+	return quads.size();
+}
+
+float perfHud::drawMs() const
+{
+	return lastDrawMs;
+}
+
+void perfHud::del()
+{
+	program.del();
+
+	if (vao != 0)
+		glDeleteVertexArrays(1, &vao);
+	if (instanceBuffer != 0)
+	{
+		gpuMemoryRelease(GL_BUFFER, instanceBuffer);
+		glDeleteBuffers(1, &instanceBuffer);
+	}
+	if (atlas != 0)
+	{
+		gpuMemoryRelease(GL_TEXTURE, atlas);
+		glDeleteTextures(1, &atlas);
+	}
+	vao = instanceBuffer = atlas = 0;
+}
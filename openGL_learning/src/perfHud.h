@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef PERF_HUD_CLASS
+#define PERF_HUD_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "shader.h"
+
+/*
+	On screen performance overlay: CPU and GPU frame time with a rolling graph of each, a
+	histogram of the CPU frame times marked at p50 / p95 / p99, the GL counters of the last
+	frame (draws, triangles, binds, uploads) and the GPU memory of the ledger (gpuMemory.h).
+
+		perfHud hud(shaderDirectory);
+		... frame ...
+		hud.addCpuTime(cpuMs);
+		for (float gpuMs : resolution.arrivedGpuTimes())
+			hud.addGpuTime(gpuMs);
+		hud.draw(windowWidth, windowHeight);    // last, into the bound framebuffer
+
+	Everything is one instanced draw. Every glyph, bar and panel is a quad instance (pixel
+	rectangle, atlas rectangle, colour, 16 bytes) in a stream buffer, the vertex shader makes
+	the corners from gl_VertexID. The atlas is a 5x7 font of ASCII 32 to 95 (lower case is
+	drawn upper case) with one solid cell the bars sample.
+
+	The GL counters need OGL_GL_INSTRUMENT, other builds show a note in their place. With
+	visible off draw() returns at once, the times are still recorded.
+*/
+
+// Rolling window of frame times
+class frameTimeHistory
+{
+	public:
+		explicit frameTimeHistory(size_t capacity = 240);
+
+		void add(float ms);
+		void clear();
+
+		size_t size() const;
+		size_t capacity() const;
+		// 0 is the oldest sample
+		float at(size_t i) const;
+		float newest() const;
+		float maximum() const;
+
+		// Nearest rank, p in [0, 1], 0 when empty
+		float percentile(float p) const;
+
+	private:
+		std::vector<float> samples;
+		size_t next = 0;
+		size_t count = 0;
+
+		// The same samples in order
+		std::vector<float> sorted;
+};
+
+class perfHud
+{
+	public:
+		bool visible = true;
+		// Pixels per font texel
+		int scale = 2;
+		// Pixels from the top left corner of the window
+		int x = 8;
+		int y = 8;
+
+		frameTimeHistory cpu;
+		frameTimeHistory gpu;
+
+		explicit perfHud(const std::string& shaderDirectory);
+
+		void addCpuTime(float ms);
+		void addGpuTime(float ms);
+
+		// Builds the quads and draws them over whatever is bound, depth test and blending are
+		// restored after
+		void draw(int windowWidth, int windowHeight);
+
+		// Quads of the last draw() and the CPU time it took
+		size_t quadCount() const;
+		float drawMs() const;
+
+		void del();
+
+	private:
+		struct quad
+		{
+			GLshort x, y, width, height;
+			GLubyte u, v, uWidth, vHeight;
+			GLubyte colour[4];
+		};
+
+		shader program;
+		GLuint vao = 0;
+		GLuint instanceBuffer = 0;
+		GLuint atlas = 0;
+		GLint screenSizeLocation = -1;
+		size_t instanceCapacity = 0;
+
+		std::vector<quad> quads;
+		float lastDrawMs = 0.0f;
+
+		void createAtlas();
+
+		void addRect(int left, int top, int width, int height, const GLubyte colour[4]);
+		// Returns the x after the last glyph
+		int addText(int left, int top, const char* text, const GLubyte colour[4]);
+		void addGraph(int left, int top, int width, int height, const frameTimeHistory& history, float topMs, const GLubyte colour[4]);
+		void addHistogram(int left, int top, int width, int height, const frameTimeHistory& history, float topMs);
+};
+
+#endif
@@ -0,0 +1,430 @@
+#pragma once
+
+#ifndef PRIMITIVES_CLASS
+#define PRIMITIVES_CLASS
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+	Boxes, planes, spheres and cylinders generated by the compiler. Every generator is
+	constexpr and the result a constexpr object, so the vertices and indices sit in read only
+	data, already laid out for the VBO and already in the narrowest index type for the EBO:
+
+		static constexpr auto box = primitiveCorners<sceneLayout>({ 0.25f, 0.25f, 0.25f }, { 0.5f, 0.5f, 0.5f }, { 0.5f, 0.5f, 0.5f });
+		VBO vbo(box.vertices.data(), sizeof(box.vertices));
+		EBO ebo(box.indices.data(), sizeof(box.indices), box.indexType);
+
+	The layout is a template parameter: a struct with the floats per vertex, the offset of
+	each attribute (-1 when it has none, as in pulledFormat) and a constexpr write() putting
+	one primitivePoint into a vertex. The generators only make points and triangles.
+
+	Counts are template parameters too (segments of a sphere and so on), they size the arrays.
+	Triangles are counter clockwise seen from outside. Every vertex costs the compiler steps, a
+	big sphere can need a higher limit (/constexpr:steps on MSVC, -fconstexpr-ops-limit on gcc).
+*/
+
+struct primitiveVec3
+{
+	float x, y, z;
+};
+
+// One generated vertex, before the layout picks what it keeps
+struct primitivePoint
+{
+	primitiveVec3 position;
+	// Unit length, except for primitiveCorners (see there)
+	primitiveVec3 normal;
+	float u, v;
+	primitiveVec3 colour;
+};
+
+/*
+	Layouts
+*/
+
+// vertexShader.vert: position, colour and the normal split into xNormal, yNormal, zNormal
+struct sceneLayout
+{
+	static constexpr int floats = 15;
+	static constexpr int position = 0;
+	static constexpr int normal = -1;
+	static constexpr int uv = -1;
+	static constexpr int colour = 3;
+
+	static constexpr void write(float* out, const primitivePoint& p)
+	{
+		out[0] = p.position.x; out[1] = p.position.y; out[2] = p.position.z;
+		out[3] = p.colour.x; out[4] = p.colour.y; out[5] = p.colour.z;
+		out[6] = p.normal.x; out[7] = 0.0f; out[8] = 0.0f;
+		out[9] = 0.0f; out[10] = p.normal.y; out[11] = 0.0f;
+		out[12] = 0.0f; out[13] = 0.0f; out[14] = p.normal.z;
+	}
+};
+
+// The same with every normal zero, which vertexShader.vert draws in the flat colour (the lamp)
+struct sceneUnlitLayout
+{
+	static constexpr int floats = 15;
+	static constexpr int position = 0;
+	static constexpr int normal = -1;
+	static constexpr int uv = -1;
+	static constexpr int colour = 3;
+
+	static constexpr void write(float* out, const primitivePoint& p)
+	{
+		out[0] = p.position.x; out[1] = p.position.y; out[2] = p.position.z;
+		out[3] = p.colour.x; out[4] = p.colour.y; out[5] = p.colour.z;
+		for (int i = 6; i < 15; i++)
+			out[i] = 0.0f;
+	}
+};
+
+struct positionNormalLayout
+{
+	static constexpr int floats = 6;
+	static constexpr int position = 0;
+	static constexpr int normal = 3;
+	static constexpr int uv = -1;
+	static constexpr int colour = -1;
+
+	static constexpr void write(float* out, const primitivePoint& p)
+	{
+		out[0] = p.position.x; out[1] = p.position.y; out[2] = p.position.z;
+		out[3] = p.normal.x; out[4] = p.normal.y; out[5] = p.normal.z;
+	}
+};
+
+struct positionNormalUvLayout
+{
+	static constexpr int floats = 8;
+	static constexpr int position = 0;
+	static constexpr int normal = 3;
+	static constexpr int uv = 6;
+	static constexpr int colour = -1;
+
+	static constexpr void write(float* out, const primitivePoint& p)
+	{
+		out[0] = p.position.x; out[1] = p.position.y; out[2] = p.position.z;
+		out[3] = p.normal.x; out[4] = p.normal.y; out[5] = p.normal.z;
+		out[6] = p.u; out[7] = p.v;
+	}
+};
+
+/*
+	Meshes
+*/
+
+template <size_t VertexCount>
+using primitiveIndex = typename std::conditional<VertexCount <= 256, uint8_t,
+	typename std::conditional<VertexCount <= 65536, uint16_t, uint32_t>::type>::type;
+
+template <typename Layout, size_t VertexCount, size_t IndexCount>
+struct primitiveMesh
+{
+	typedef Layout layout;
+	typedef primitiveIndex<VertexCount> index;
+
+	static constexpr size_t vertexCount = VertexCount;
+	static constexpr size_t indexCount = IndexCount;
+	static constexpr GLenum indexType = sizeof(index) == 1 ? GL_UNSIGNED_BYTE : sizeof(index) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	static constexpr GLsizei stride = Layout::floats * sizeof(float);
+
+	std::array<float, VertexCount * Layout::floats> vertices{};
+	std::array<index, IndexCount> indices{};
+
+	constexpr void setVertex(size_t i, const primitivePoint& p)
+	{
+		Layout::write(vertices.data() + i * Layout::floats, p);
+	}
+
+	constexpr void setQuad(size_t first, size_t a, size_t b, size_t c, size_t d)
+	{
+		setTriangle(first, a, b, c);
+		setTriangle(first + 3, a, c, d);
+	}
+
+	constexpr void setTriangle(size_t first, size_t a, size_t b, size_t c)
+	{
+		indices[first] = (index)a;
+		indices[first + 1] = (index)b;
+		indices[first + 2] = (index)c;
+	}
+};
+
+/*
+	constexpr maths, std::sin and std::cos are not
+*/
+
+constexpr double primitivePi = 3.14159265358979323846;
+
+constexpr double primitiveSin(double x)
+{
+	while (x > primitivePi)
+		x -= 2.0 * primitivePi;
+	while (x < -primitivePi)
+		x += 2.0 * primitivePi;
+
+	// Taylor series, the 12th term is below 1e-12 over [-pi, pi]
+	double term = x;
+	double sum = x;
+	for (int n = 1; n < 12; n++)
+	{
+		term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+		sum += term;
+	}
+	return sum;
+}
+
+constexpr double primitiveCos(double x)
+{
+	return primitiveSin(x + primitivePi / 2.0);
+}
+
+constexpr primitiveVec3 primitiveAdd(const primitiveVec3& a, const primitiveVec3& b)
+{
+	return { a.x + b.x, a.y + b.y, a.z + b.z };
+}
+
+constexpr primitiveVec3 primitiveScale(const primitiveVec3& a, float s)
+{
+	return { a.x * s, a.y * s, a.z * s };
+}
+
+/*
+	Generators
+*/
+
+// Sign of the corners a - h along x, y and z, the names the hand written cuboids used
+inline constexpr float primitiveCornerSigns[8][3] = {
+	{ -1.0f,  1.0f, -1.0f }, // a
+	{  1.0f,  1.0f, -1.0f }, // b
+	{  1.0f, -1.0f, -1.0f }, // c
+	{ -1.0f, -1.0f, -1.0f }, // d
+	{ -1.0f,  1.0f,  1.0f }, // e
+	{  1.0f,  1.0f,  1.0f }, // f
+	{  1.0f, -1.0f,  1.0f }, // g
+	{ -1.0f, -1.0f,  1.0f }  // h
+};
+
+inline constexpr GLint primitiveCornerIndices[36] = {
+	3,0,1,  3,1,2, // North
+	6,5,4,  6,4,7, // South
+	7,4,0,  7,0,3, // East
+	2,1,5,  2,5,6, // West
+	0,4,5,  0,5,1, // Top
+	6,7,3,  6,3,2  // Bottom
+};
+
+// Box of 8 shared corners. A corner's normal is the sum of its three face normals (its
+// signs), which sceneLayout splits into the three per axis normals vertexShader.vert lights with
+template <typename Layout>
+constexpr primitiveMesh<Layout, 8, 36> primitiveCorners(const primitiveVec3& centre, const primitiveVec3& size, const primitiveVec3& colour)
+{
+	primitiveMesh<Layout, 8, 36> mesh;
+	for (size_t i = 0; i < 8; i++)
+	{
+		const float* sign = primitiveCornerSigns[i];
+		primitivePoint p = {};
+		p.position = { centre.x + sign[0] * size.x * 0.5f, centre.y + sign[1] * size.y * 0.5f, centre.z + sign[2] * size.z * 0.5f };
+		p.normal = { sign[0], sign[1], sign[2] };
+		p.u = sign[0] * 0.5f + 0.5f;
+		p.v = sign[1] * 0.5f + 0.5f;
+		p.colour = colour;
+		mesh.setVertex(i, p);
+	}
+	for (size_t i = 0; i < 36; i++)
+		mesh.indices[i] = (typename primitiveMesh<Layout, 8, 36>::index)primitiveCornerIndices[i];
+	return mesh;
+}
+
+// Box of 6 faces with 4 corners each, flat normals and a 0 - 1 uv square per face
+template <typename Layout>
+constexpr primitiveMesh<Layout, 24, 36> primitiveBox(const primitiveVec3& centre, const primitiveVec3& size, const primitiveVec3& colour)
+{
+	primitiveMesh<Layout, 24, 36> mesh;
+	const float half[3] = { size.x * 0.5f, size.y * 0.5f, size.z * 0.5f };
+	const float middle[3] = { centre.x, centre.y, centre.z };
+
+	for (int face = 0; face < 6; face++)
+	{
+		// u and v span the face, u x v points along +axis
+		int axis = face / 2;
+		int u = (axis + 1) % 3;
+		int v = (axis + 2) % 3;
+		float side = face % 2 ? 1.0f : -1.0f;
+
+		const float corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+		for (int c = 0; c < 4; c++)
+		{
+			// Counter clockwise from outside, so the negative faces go round the other way
+			const float* corner = corners[side > 0.0f ? c : 3 - c];
+			float position[3] = {};
+			float normal[3] = {};
+			position[axis] = middle[axis] + side * half[axis];
+			position[u] = middle[u] + corner[0] * half[u];
+			position[v] = middle[v] + corner[1] * half[v];
+			normal[axis] = side;
+
+			primitivePoint p = {};
+			p.position = { position[0], position[1], position[2] };
+			p.normal = { normal[0], normal[1], normal[2] };
+			p.u = corner[0] * 0.5f + 0.5f;
+			p.v = corner[1] * 0.5f + 0.5f;
+			p.colour = colour;
+			mesh.setVertex(face * 4 + c, p);
+		}
+		mesh.setQuad(face * 6, face * 4, face * 4 + 1, face * 4 + 2, face * 4 + 3);
+	}
+	return mesh;
+}
+
+// Flat grid facing +y, Divisions quads along x and along z
+template <typename Layout, size_t Divisions>
+constexpr primitiveMesh<Layout, (Divisions + 1) * (Divisions + 1), Divisions * Divisions * 6> primitivePlane(const primitiveVec3& centre, float width, float depth, const primitiveVec3& colour)
+{
+	primitiveMesh<Layout, (Divisions + 1) * (Divisions + 1), Divisions * Divisions * 6> mesh;
+	for (size_t z = 0; z <= Divisions; z++)
+	{
+		for (size_t x = 0; x <= Divisions; x++)
+		{
+			float u = (float)x / Divisions;
+			float v = (float)z / Divisions;
+			primitivePoint p = {};
+			p.position = { centre.x + (u - 0.5f) * width, centre.y, centre.z + (v - 0.5f) * depth };
+			p.normal = { 0.0f, 1.0f, 0.0f };
+			p.u = u;
+			p.v = v;
+			p.colour = colour;
+			mesh.setVertex(z * (Divisions + 1) + x, p);
+		}
+	}
+
+	size_t first = 0;
+	for (size_t z = 0; z < Divisions; z++)
+	{
+		for (size_t x = 0; x < Divisions; x++)
+		{
+			size_t corner = z * (Divisions + 1) + x;
+			mesh.setQuad(first, corner, corner + Divisions + 1, corner + Divisions + 2, corner + 1);
+			first += 6;
+		}
+	}
+	return mesh;
+}
+
+// UV sphere, Rings bands from pole to pole and Segments around. The seam and the poles repeat
+// vertices so the uvs are continuous, the pole bands are single triangles
+template <typename Layout, size_t Rings, size_t Segments>
+constexpr primitiveMesh<Layout, (Rings + 1) * (Segments + 1), Segments * (Rings - 1) * 6> primitiveSphere(const primitiveVec3& centre, float radius, const primitiveVec3& colour)
+{
+	static_assert(Rings >= 2 && Segments >= 3, "a sphere needs 2 rings and 3 segments");
+
+	primitiveMesh<Layout, (Rings + 1) * (Segments + 1), Segments * (Rings - 1) * 6> mesh;
+	for (size_t ring = 0; ring <= Rings; ring++)
+	{
+		double phi = primitivePi * ring / Rings;
+		float y = (float)primitiveCos(phi);
+		float ringRadius = (float)primitiveSin(phi);
+		for (size_t segment = 0; segment <= Segments; segment++)
+		{
+			double theta = 2.0 * primitivePi * segment / Segments;
+			primitivePoint p = {};
+			p.normal = { ringRadius * (float)primitiveCos(theta), y, ringRadius * (float)primitiveSin(theta) };
+			p.position = primitiveAdd(centre, primitiveScale(p.normal, radius));
+			p.u = (float)segment / Segments;
+			p.v = (float)ring / Rings;
+			p.colour = colour;
+			mesh.setVertex(ring * (Segments + 1) + segment, p);
+		}
+	}
+
+	size_t first = 0;
+	for (size_t ring = 0; ring < Rings; ring++)
+	{
+		for (size_t segment = 0; segment < Segments; segment++)
+		{
+			size_t above = ring * (Segments + 1) + segment;
+			size_t below = above + Segments + 1;
+			if (ring != 0)
+			{
+				mesh.setTriangle(first, above, above + 1, below);
+				first += 3;
+			}
+			if (ring != Rings - 1)
+			{
+				mesh.setTriangle(first, above + 1, below + 1, below);
+				first += 3;
+			}
+		}
+	}
+	return mesh;
+}
+
+// Cylinder along y with both caps, Segments around. The side and the caps have their own
+// vertices so the edges stay sharp
+template <typename Layout, size_t Segments>
+constexpr primitiveMesh<Layout, (Segments + 1) * 2 + (Segments + 1) * 2, Segments * 12> primitiveCylinder(const primitiveVec3& centre, float radius, float height, const primitiveVec3& colour)
+{
+	static_assert(Segments >= 3, "a cylinder needs 3 segments");
+
+	primitiveMesh<Layout, (Segments + 1) * 2 + (Segments + 1) * 2, Segments * 12> mesh;
+	const size_t ring = Segments + 1;
+	// Side bottom, side top, bottom cap, top cap: Segments + 1 each, the last the cap's centre
+	const size_t sideBottom = 0;
+	const size_t sideTop = ring;
+	const size_t capBottom = ring * 2;
+	const size_t capTop = ring * 3;
+
+	for (size_t segment = 0; segment <= Segments; segment++)
+	{
+		double theta = 2.0 * primitivePi * segment / Segments;
+		float x = (float)primitiveCos(theta);
+		float z = (float)primitiveSin(theta);
+
+		primitivePoint p = {};
+		p.colour = colour;
+		p.u = (float)segment / Segments;
+		for (int top = 0; top < 2; top++)
+		{
+			float y = top ? height * 0.5f : -height * 0.5f;
+			p.position = { centre.x + x * radius, centre.y + y, centre.z + z * radius };
+			p.normal = { x, 0.0f, z };
+			p.v = (float)top;
+			mesh.setVertex((top ? sideTop : sideBottom) + segment, p);
+
+			if (segment == Segments)
+			{
+				// The seam vertex is not needed on a cap, its slot holds the centre
+				p.position = { centre.x, centre.y + y, centre.z };
+				p.u = 0.5f;
+				p.v = 0.5f;
+			}
+			else
+			{
+				p.u = x * 0.5f + 0.5f;
+				p.v = z * 0.5f + 0.5f;
+			}
+			p.normal = { 0.0f, top ? 1.0f : -1.0f, 0.0f };
+			mesh.setVertex((top ? capTop : capBottom) + segment, p);
+			p.u = (float)segment / Segments;
+		}
+	}
+
+	size_t first = 0;
+	for (size_t segment = 0; segment < Segments; segment++)
+	{
+		size_t next = (segment + 1) % Segments;
+		mesh.setQuad(first, sideBottom + segment, sideTop + segment, sideTop + segment + 1, sideBottom + segment + 1);
+		mesh.setTriangle(first + 6, capTop + Segments, capTop + next, capTop + segment);
+		mesh.setTriangle(first + 9, capBottom + Segments, capBottom + segment, capBottom + next);
+		first += 12;
+	}
+	return mesh;
+}
+
+#endif
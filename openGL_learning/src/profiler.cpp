@@ -0,0 +1,291 @@
+#include "profiler.h"
+
+#ifdef OGL_PROFILE
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_RDTSC 1
+#endif
+
+struct profileEvent
+{
+	const char* name;
+	uint64_t begin;
+	uint64_t end;
+};
+
+// Written only by its thread, written counts every event ever so a reader knows which slots are valid
+struct profileThreadBuffer
+{
+	std::vector<profileEvent> events = std::vector<profileEvent>(profilerThreadEvents);
+	std::atomic<uint64_t> written{ 0 };
+	// Events before it were cleared, only read and written under threadsLock
+	uint64_t clearedTo = 0;
+	std::string name;
+	int id = 0;
+};
+
+static std::mutex threadsLock;
+static std::vector<std::unique_ptr<profileThreadBuffer>> threads;
+static thread_local profileThreadBuffer* threadBuffer = nullptr;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static const uint64_t startTicks = profilerTicks();
+
+static uint64_t steadyNanoseconds()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+uint64_t profilerTicks()
+{
+#ifdef PROFILER_RDTSC
+	return __rdtsc();
+#else
+	return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+static profileThreadBuffer* registerThread()
+{
+	std::lock_guard<std::mutex> guard(threadsLock);
+	threads.push_back(std::make_unique<profileThreadBuffer>());
+	profileThreadBuffer* buffer = threads.back().get();
+	buffer->id = (int)threads.size();
+	buffer->name = "thread " + std::to_string(buffer->id);
+	threadBuffer = buffer;
+	return buffer;
+}
+
+void profilerRecord(const char* name, uint64_t begin, uint64_t end)
+{
+	profileThreadBuffer* buffer = threadBuffer ? threadBuffer : registerThread();
+	uint64_t index = buffer->written.load(std::memory_order_relaxed);
+	buffer->events[index & (profilerThreadEvents - 1)] = { name, begin, end };
+	buffer->written.store(index + 1, std::memory_order_release);
+}
+
+void profilerThreadName(const char* name)
+{
+	profileThreadBuffer* buffer = threadBuffer ? threadBuffer : registerThread();
+	std::lock_guard<std::mutex> guard(threadsLock);
+	buffer->name = name;
+}
+
+uint64_t profilerCpuScopes()
+{
+	std::lock_guard<std::mutex> guard(threadsLock);
+	uint64_t scopes = 0;
+	for (const auto& buffer : threads)
+		scopes += buffer->written.load(std::memory_order_acquire);
+	return scopes;
+}
+
+// Ticks are taken as nanoseconds since startTime, scaled by how many went by against steady_clock
+static double ticksPerNanosecond()
+{
+#ifdef PROFILER_RDTSC
+	uint64_t nanoseconds = steadyNanoseconds();
+	uint64_t ticks = profilerTicks() - startTicks;
+	return nanoseconds > 0 ? (double)ticks / nanoseconds : 1.0;
+#else
+	return (double)std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num / 1e9;
+#endif
+}
+
+/*
+	GPU scopes, only ever touched on the GL thread
+*/
+
+struct gpuScope
+{
+	const char* name;
+	GLuint begin;
+	GLuint end;
+};
+
+// Nanoseconds since startTime
+struct gpuEvent
+{
+	const char* name;
+	uint64_t begin;
+	uint64_t end;
+};
+
+static std::vector<GLuint> freeQueries;
+// Opened scopes in order, read back from the front
+static std::deque<gpuScope> pendingScopes;
+static size_t pendingFirst = 0;
+static std::deque<gpuEvent> gpuEvents;
+static uint64_t gpuScopesRead = 0;
+
+static bool gpuSynced = false;
+static int64_t gpuSyncTime = 0;
+static uint64_t cpuSyncTime = 0;
+
+static GLuint takeQuery()
+{
+	if (freeQueries.empty())
+	{
+		freeQueries.resize(64);
+		glGenQueries((GLsizei)freeQueries.size(), freeQueries.data());
+	}
+
+	GLuint query = freeQueries.back();
+	freeQueries.pop_back();
+	return query;
+}
+
+gpuProfileScope::gpuProfileScope(const char* name)
+{
+	GLuint begin = takeQuery();
+	glQueryCounter(begin, GL_TIMESTAMP);
+	pending = pendingFirst + pendingScopes.size();
+	pendingScopes.push_back({ name, begin, 0 });
+}
+
+gpuProfileScope::~gpuProfileScope()
+{
+	GLuint end = takeQuery();
+	glQueryCounter(end, GL_TIMESTAMP);
+	pendingScopes[pending - pendingFirst].end = end;
+}
+
+void profilerEndFrame()
+{
+	// Its end query is the last one issued of a scope, so once it is available both are
+	while (!pendingScopes.empty() && pendingScopes.front().end != 0)
+	{
+		gpuScope& scope = pendingScopes.front();
+		GLint available = 0;
+		glGetQueryObjectiv(scope.end, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break;
+
+		GLuint64 begin = 0, end = 0;
+		glGetQueryObjectui64v(scope.begin, GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(scope.end, GL_QUERY_RESULT, &end);
+		freeQueries.push_back(scope.begin);
+		freeQueries.push_back(scope.end);
+
+		if (gpuSynced)
+		{
+			int64_t offset = (int64_t)cpuSyncTime - gpuSyncTime;
+			gpuEvents.push_back({ scope.name, (uint64_t)std::max<int64_t>((int64_t)begin + offset, 0), (uint64_t)std::max<int64_t>((int64_t)end + offset, 0) });
+			if (gpuEvents.size() > profilerThreadEvents)
+				gpuEvents.pop_front();
+		}
+		gpuScopesRead++;
+
+		pendingScopes.pop_front();
+		pendingFirst++;
+	}
+
+	// Where the GPU clock is now against ours, drift between the two stays small over a frame
+	GLint64 gpuNow = 0;
+	glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+	cpuSyncTime = steadyNanoseconds();
+	gpuSyncTime = gpuNow;
+	gpuSynced = true;
+}
+
+uint64_t profilerGpuScopes()
+{
+	return gpuScopesRead;
+}
+
+static void writeName(std::ofstream& out, const char* name)
+{
+	out << '"';
+	for (const char* c = name; *c; c++)
+	{
+		if (*c == '"' || *c == '\\')
+			out << '\\';
+		out << *c;
+	}
+	out << '"';
+}
+
+// Chrome trace event format, times in microseconds
+static void writeEvent(std::ofstream& out, bool& first, const char* name, int thread, double beginNs, double endNs)
+{
+	out << (first ? "\n" : ",\n") << "\t{ \"name\": ";
+	writeName(out, name);
+	out << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << thread << ", \"ts\": " << beginNs / 1000.0 << ", \"dur\": " << (endNs - beginNs) / 1000.0 << " }";
+	first = false;
+}
+
+static void writeThreadName(std::ofstream& out, bool& first, int thread, const char* name)
+{
+	out << (first ? "\n" : ",\n") << "\t{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread << ", \"args\": { \"name\": ";
+	writeName(out, name);
+	out << " } }";
+	first = false;
+}
+
+bool profilerExportChromeTrace(const char* path)
+{
+	std::ofstream out(path, std::ios::trunc);
+	if (!out)
+	{
+		std::cout << "ERROR::PROFILER::FILE_NOT_WRITABLE " << path << std::endl;
+		return false;
+	}
+
+	double scale = ticksPerNanosecond();
+	bool first = true;
+	out << std::fixed << std::setprecision(3) << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+	// The GPU is thread 0, listed first
+	writeThreadName(out, first, 0, "GPU");
+	for (const gpuEvent& event : gpuEvents)
+		writeEvent(out, first, event.name, 0, (double)event.begin, (double)event.end);
+
+	std::lock_guard<std::mutex> guard(threadsLock);
+	for (const auto& buffer : threads)
+	{
+		writeThreadName(out, first, buffer->id, buffer->name.c_str());
+
+		uint64_t written = buffer->written.load(std::memory_order_acquire);
+		uint64_t oldest = std::max(written > profilerThreadEvents ? written - profilerThreadEvents : 0, buffer->clearedTo);
+		for (uint64_t i = oldest; i < written; i++)
+		{
+			const profileEvent& event = buffer->events[i & (profilerThreadEvents - 1)];
+			// Ticks from before startTicks only happen for scopes opened during static initialisation
+			double begin = event.begin > startTicks ? (event.begin - startTicks) / scale : 0.0;
+			double end = event.end > startTicks ? (event.end - startTicks) / scale : 0.0;
+			writeEvent(out, first, event.name, buffer->id, begin, end);
+		}
+	}
+
+	out << "\n] }\n";
+	return (bool)out;
+}
+
+void profilerClear()
+{
+	std::lock_guard<std::mutex> guard(threadsLock);
+	// written belongs to the owning thread, the export starts after what is there now instead
+	for (const auto& buffer : threads)
+		buffer->clearedTo = buffer->written.load(std::memory_order_acquire);
+	gpuEvents.clear();
+}
+
+#endif
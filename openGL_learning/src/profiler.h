@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef PROFILER_CLASS
+#define PROFILER_CLASS
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Scoped CPU and GPU timing markers, built in only with OGL_PROFILE defined (cmake
+	-DOGL_PROFILE=ON, or the Debug configurations of the Visual Studio project). Without it
+	the macros expand to nothing and the functions below are empty inlines.
+
+		void cull()
+		{
+			PROFILE_SCOPE("cull");              // CPU time of the enclosing block
+			...
+		}
+
+		{
+			PROFILE_GPU_SCOPE("shadows");       // GPU time of the GL commands in the block
+			shadows.update(...);
+		}
+
+		... every frame, on the GL thread ...
+		profilerEndFrame();
+		profilerExportChromeTrace("frame.json");   // chrome://tracing or ui.perfetto.dev
+
+	Names must be string literals, only the pointer is kept.
+
+	Every thread records into its own ring of the last profilerThreadEvents scopes: one
+	timestamp (rdtsc on x86, steady_clock elsewhere) when the scope opens, one more and a
+	single store when it closes, no lock and no allocation. Nested scopes come out nested
+	because their times are. Exporting reads every ring as it is, so export between frames
+	while no job is running.
+
+	GPU scopes put a GL_TIMESTAMP query at each end, nesting freely, and may only be used on
+	the thread owning the context. profilerEndFrame collects the queries the GPU is done
+	with, never waiting on the rest, and moves them onto the CPU timeline: the GPU clock is
+	read against the CPU one (glGetInteger64v GL_TIMESTAMP) once a frame.
+*/
+
+// Scopes kept per thread, and GPU scopes kept in all
+const size_t profilerThreadEvents = 1 << 15;
+
+#ifdef OGL_PROFILE
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) profileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_GPU_SCOPE(name) gpuProfileScope PROFILE_CONCAT(gpuProfileScope_, __LINE__)(name)
+
+uint64_t profilerTicks();
+void profilerRecord(const char* name, uint64_t begin, uint64_t end);
+
+class profileScope
+{
+	public:
+		explicit profileScope(const char* name) : name(name), begin(profilerTicks()) {}
+		~profileScope() { profilerRecord(name, begin, profilerTicks()); }
+
+		profileScope(const profileScope&) = delete;
+		profileScope& operator=(const profileScope&) = delete;
+
+	private:
+		const char* name;
+		uint64_t begin;
+};
+
+class gpuProfileScope
+{
+	public:
+		explicit gpuProfileScope(const char* name);
+		~gpuProfileScope();
+
+		gpuProfileScope(const gpuProfileScope&) = delete;
+		gpuProfileScope& operator=(const gpuProfileScope&) = delete;
+
+	private:
+		size_t pending;
+};
+
+// Shown for the calling thread in the trace, "thread n" until set
+void profilerThreadName(const char* name);
+
+// On the GL thread, after the frame's last GPU scope closed
+void profilerEndFrame();
+
+// Scopes recorded so far on all threads (including those the rings dropped), and GPU scopes read back
+uint64_t profilerCpuScopes();
+uint64_t profilerGpuScopes();
+
+// Everything in the rings, CPU threads and the GPU as one timeline. False if the file can't be written
+bool profilerExportChromeTrace(const char* path);
+void profilerClear();
+
+#else
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_GPU_SCOPE(name)
+
+inline void profilerThreadName(const char*) {}
+inline void profilerEndFrame() {}
+inline uint64_t profilerCpuScopes() { return 0; }
+inline uint64_t profilerGpuScopes() { return 0; }
+inline bool profilerExportChromeTrace(const char*) { return false; }
+inline void profilerClear() {}
+
+#endif
+
+#endif
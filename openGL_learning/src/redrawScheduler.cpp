@@ -0,0 +1,248 @@
+#include "redrawScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <unordered_map>
+
+#include "profiler.h"
+
+// The scheduler of each window. The window user pointer is left to the application
+static std::unordered_map<GLFWwindow*, redrawScheduler*> schedulers;
+
+bool redrawProjectBox(const glm::vec3& min, const glm::vec3& max, const glm::mat4& viewProjection, int windowWidth, int windowHeight, redrawRect& out)
+{
+	glm::vec2 low(1.0f);
+	glm::vec2 high(-1.0f);
+	for (int corner = 0; corner < 8; corner++)
+	{
+		glm::vec3 p((corner & 1) ? max.x : min.x, (corner & 2) ? max.y : min.y, (corner & 4) ? max.z : min.z);
+		glm::vec4 clip = viewProjection * glm::vec4(p, 1.0f);
+		if (clip.w <= 1e-5f)
+			return false;
+
+		glm::vec2 ndc = glm::vec2(clip.x, clip.y) / clip.w;
+		low = glm::min(low, ndc);
+		high = glm::max(high, ndc);
+	}
+
+	low = glm::clamp(low, glm::vec2(-1.0f), glm::vec2(1.0f));
+	high = glm::clamp(high, glm::vec2(-1.0f), glm::vec2(1.0f));
+
+	// Whole pixels around it, one more on every side for the rasteriser's rounding
+	int x0 = (int)std::floor((low.x * 0.5f + 0.5f) * windowWidth) - 1;
+	int y0 = (int)std::floor((low.y * 0.5f + 0.5f) * windowHeight) - 1;
+	int x1 = (int)std::ceil((high.x * 0.5f + 0.5f) * windowWidth) + 1;
+	int y1 = (int)std::ceil((high.y * 0.5f + 0.5f) * windowHeight) + 1;
+	x0 = std::max(x0, 0);
+	y0 = std::max(y0, 0);
+	x1 = std::min(x1, windowWidth);
+	y1 = std::min(y1, windowHeight);
+
+	out.x = x0;
+	out.y = y0;
+	out.width = std::max(x1 - x0, 0);
+	out.height = std::max(y1 - y0, 0);
+	return true;
+}
+
+redrawScheduler::redrawScheduler(GLFWwindow* window)
+	: window(window)
+{
+	// A second one would chain to the first one's callbacks, which are its own
+	if (schedulers.count(window))
+	{
+		std::cout << "ERROR::REDRAW_SCHEDULER::WINDOW_ALREADY_SCHEDULED" << std::endl;
+		return;
+	}
+	schedulers[window] = this;
+	installed = true;
+
+	previousKey = glfwSetKeyCallback(window, keyCallback);
+	previousMouseButton = glfwSetMouseButtonCallback(window, mouseButtonCallback);
+	previousScroll = glfwSetScrollCallback(window, scrollCallback);
+	previousFramebufferSize = glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+	previousRefresh = glfwSetWindowRefreshCallback(window, refreshCallback);
+	previousFocus = glfwSetWindowFocusCallback(window, focusCallback);
+}
+
+redrawScheduler::~redrawScheduler()
+{
+	if (!installed)
+		return;
+
+	glfwSetKeyCallback(window, previousKey);
+	glfwSetMouseButtonCallback(window, previousMouseButton);
+	glfwSetScrollCallback(window, previousScroll);
+	glfwSetFramebufferSizeCallback(window, previousFramebufferSize);
+	glfwSetWindowRefreshCallback(window, previousRefresh);
+	glfwSetWindowFocusCallback(window, previousFocus);
+	schedulers.erase(window);
+}
+
+void redrawScheduler::invalidate()
+{
+	full = true;
+	rects.clear();
+}
+
+void redrawScheduler::invalidate(const redrawRect& rect)
+{
+	if (full || rect.width <= 0 || rect.height <= 0)
+		return;
+	if (!partialRedraw)
+	{
+		invalidate();
+		return;
+	}
+
+	rects.push_back(rect);
+	if (rects.size() > maxRects)
+	{
+		redrawRect bounds = damageBounds();
+		rects.assign(1, bounds);
+	}
+}
+
+void redrawScheduler::animate()
+{
+	animating = true;
+}
+
+void redrawScheduler::wait()
+{
+	PROFILE_SCOPE("redrawScheduler::wait");
+
+	if (!onDemand || due())
+	{
+		glfwPollEvents();
+		return;
+	}
+
+	glfwWaitEventsTimeout(idleTimeout);
+	if (!due())
+		idleCount++;
+}
+
+bool redrawScheduler::due() const
+{
+	return !onDemand || full || animating || keysHeld > 0 || !rects.empty();
+}
+
+bool redrawScheduler::fullFrame() const
+{
+	// Held keys drive the camera, which moves everything
+	return !onDemand || full || animating || keysHeld > 0;
+}
+
+const std::vector<redrawRect>& redrawScheduler::damage() const
+{
+	return rects;
+}
+
+redrawRect redrawScheduler::damageBounds() const
+{
+	redrawRect bounds;
+	if (rects.empty())
+		return bounds;
+
+	int x0 = rects[0].x, y0 = rects[0].y;
+	int x1 = x0 + rects[0].width, y1 = y0 + rects[0].height;
+	for (const redrawRect& rect : rects)
+	{
+		x0 = std::min(x0, rect.x);
+		y0 = std::min(y0, rect.y);
+		x1 = std::max(x1, rect.x + rect.width);
+		y1 = std::max(y1, rect.y + rect.height);
+	}
+
+	bounds.x = x0;
+	bounds.y = y0;
+	bounds.width = x1 - x0;
+	bounds.height = y1 - y0;
+	return bounds;
+}
+
+void redrawScheduler::drawn()
+{
+	full = false;
+	animating = false;
+	rects.clear();
+	drawnCount++;
+}
+
+size_t redrawScheduler::framesDrawn() const
+{
+	return drawnCount;
+}
+
+size_t redrawScheduler::idleWakeups() const
+{
+	return idleCount;
+}
+
+redrawScheduler* redrawScheduler::of(GLFWwindow* window)
+{
+	return schedulers.at(window);
+}
+
+void redrawScheduler::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+	redrawScheduler* redraw = of(window);
+	if (action == GLFW_PRESS)
+		redraw->keysHeld++;
+	else if (action == GLFW_RELEASE)
+		redraw->keysHeld = std::max(redraw->keysHeld - 1, 0);
+	redraw->invalidate();
+
+	if (redraw->previousKey)
+		redraw->previousKey(window, key, scancode, action, mods);
+}
+
+void redrawScheduler::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+	redrawScheduler* redraw = of(window);
+	redraw->invalidate();
+
+	if (redraw->previousMouseButton)
+		redraw->previousMouseButton(window, button, action, mods);
+}
+
+void redrawScheduler::scrollCallback(GLFWwindow* window, double x, double y)
+{
+	redrawScheduler* redraw = of(window);
+	redraw->invalidate();
+
+	if (redraw->previousScroll)
+		redraw->previousScroll(window, x, y);
+}
+
+void redrawScheduler::framebufferSizeCallback(GLFWwindow* window, int width, int height)
+{
+	redrawScheduler* redraw = of(window);
+	redraw->invalidate();
+
+	if (redraw->previousFramebufferSize)
+		redraw->previousFramebufferSize(window, width, height);
+}
+
+void redrawScheduler::refreshCallback(GLFWwindow* window)
+{
+	redrawScheduler* redraw = of(window);
+	redraw->invalidate();
+
+	if (redraw->previousRefresh)
+		redraw->previousRefresh(window);
+}
+
+void redrawScheduler::focusCallback(GLFWwindow* window, int focused)
+{
+	// Releases that happen while another window has the focus never arrive
+	redrawScheduler* redraw = of(window);
+	if (!focused)
+		redraw->keysHeld = 0;
+	redraw->invalidate();
+
+	if (redraw->previousFocus)
+		redraw->previousFocus(window, focused);
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef REDRAW_SCHEDULER_CLASS
+#define REDRAW_SCHEDULER_CLASS
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm.hpp>
+
+#include <cstddef>
+#include <vector>
+
+/*
+	Render on demand: the loop sleeps in glfwWaitEventsTimeout until something made the last
+	frame wrong, instead of drawing the same frame again every iteration.
+
+		redrawScheduler redraw(window);
+		while (!glfwWindowShouldClose(window))
+		{
+			redraw.wait();                      // events, and the sleep when nothing is due
+			if (somethingMoved)
+				redraw.invalidate();            // or invalidate(rect), or animate()
+			if (!redraw.due())
+				continue;
+			... draw, all of it or only redraw.damageBounds() ...
+			glfwSwapBuffers(window);
+			redraw.drawn();
+		}
+
+	The window callbacks invalidate by themselves: any key, mouse button or scroll, a resize
+	and a refresh request from the system. While a key is held frames keep coming, so input
+	that is polled with glfwGetKey (the camera) moves smoothly. Callbacks the window already
+	had are still called, and the window user pointer is left to the application.
+
+	Anything else that changes the picture calls invalidate() itself: animation, a hot
+	reloaded shader or texture, results arriving from the jobs. animate() asks for the next
+	frame too, for things that change every frame while they last. Work polled from the
+	loop (job results) is looked at again every idleTimeout at the latest.
+
+	Damage: invalidate(rect) only marks a rectangle of the window. As long as nothing marked
+	the whole frame, due() frames have fullFrame() false and the rectangles in damage(), so a
+	renderer that keeps the last frame (dynamicResolution's target) can scissor the redraw to
+	them. With partialRedraw off every rectangle counts as the whole frame.
+*/
+
+// Window pixels, lower left origin like glScissor
+struct redrawRect
+{
+	int x = 0;
+	int y = 0;
+	int width = 0;
+	int height = 0;
+};
+
+// Window rectangle covering the box seen through viewProjection, false when the box
+// reaches behind the camera (then only a full frame is safe)
+bool redrawProjectBox(const glm::vec3& min, const glm::vec3& max, const glm::mat4& viewProjection, int windowWidth, int windowHeight, redrawRect& out);
+
+class redrawScheduler
+{
+	public:
+		// Off draws every iteration, as without the scheduler
+		bool onDemand = true;
+		bool partialRedraw = true;
+		// Longest sleep in seconds
+		double idleTimeout = 0.1;
+		// More rectangles than this are merged into their bounds
+		size_t maxRects = 16;
+
+		explicit redrawScheduler(GLFWwindow* window);
+		// Puts back the callbacks the window had
+		~redrawScheduler();
+
+		redrawScheduler(const redrawScheduler&) = delete;
+		redrawScheduler& operator=(const redrawScheduler&) = delete;
+
+		void invalidate();
+		void invalidate(const redrawRect& rect);
+		// The next frame is due whatever else happens
+		void animate();
+
+		// Polls the events when a frame is due, sleeps in glfwWaitEventsTimeout until one is
+		// or idleTimeout passed otherwise
+		void wait();
+
+		bool due() const;
+		bool fullFrame() const;
+		const std::vector<redrawRect>& damage() const;
+		// Rectangle around every damage() rectangle
+		redrawRect damageBounds() const;
+
+		// The frame is on screen, clears what was due
+		void drawn();
+
+		size_t framesDrawn() const;
+		// wait() calls that came back with nothing to draw
+		size_t idleWakeups() const;
+
+	private:
+		GLFWwindow* window;
+		// False when the window already had a scheduler, this one then sees no window events
+		bool installed = false;
+
+		bool full = true;
+		bool animating = false;
+		int keysHeld = 0;
+		std::vector<redrawRect> rects;
+
+		size_t drawnCount = 0;
+		size_t idleCount = 0;
+
+		GLFWkeyfun previousKey = nullptr;
+		GLFWmousebuttonfun previousMouseButton = nullptr;
+		GLFWscrollfun previousScroll = nullptr;
+		GLFWframebuffersizefun previousFramebufferSize = nullptr;
+		GLFWwindowrefreshfun previousRefresh = nullptr;
+		GLFWwindowfocusfun previousFocus = nullptr;
+
+		static redrawScheduler* of(GLFWwindow* window);
+		static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+		static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+		static void scrollCallback(GLFWwindow* window, double x, double y);
+		static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
+		static void refreshCallback(GLFWwindow* window);
+		static void focusCallback(GLFWwindow* window, int focused);
+};
+
+#endif
@@ -0,0 +1,533 @@
+#include "renderGraph.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "gpuMemory.h"
+#include "profiler.h"
+
+static bool isDepthFormat(GLenum format)
+{
+	return format == GL_DEPTH_COMPONENT16 || format == GL_DEPTH_COMPONENT24 || format == GL_DEPTH_COMPONENT32F
+		|| format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8;
+}
+
+static bool hasStencil(GLenum format)
+{
+	return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8;
+}
+
+// Any matching format / type pair will do, there is never data to upload
+static void transferFormat(GLenum internalFormat, GLenum& format, GLenum& type)
+{
+	if (hasStencil(internalFormat))
+	{
+		format = GL_DEPTH_STENCIL;
+		type = internalFormat == GL_DEPTH24_STENCIL8 ? GL_UNSIGNED_INT_24_8 : GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+	}
+	else if (isDepthFormat(internalFormat))
+	{
+		format = GL_DEPTH_COMPONENT;
+		type = GL_FLOAT;
+	}
+	else
+	{
+		format = GL_RGBA;
+		type = GL_FLOAT;
+	}
+}
+
+GLuint renderPassContext::texture(int resource) const
+{
+	return graph->texture(resource);
+}
+
+renderGraph::renderGraph(int width, int height)
+	: width(std::max(width, 1)), height(std::max(height, 1))
+{
+}
+
+int renderGraph::createTexture(const std::string& name, const renderTextureDesc& desc)
+{
+	resource r;
+	r.name = name;
+	r.kind = transientTexture;
+	r.desc = desc;
+	resources.push_back(r);
+	dirty = true;
+	return (int)resources.size() - 1;
+}
+
+int renderGraph::importTexture(const std::string& name, GLuint texture, const renderTextureDesc& desc)
+{
+	resource r;
+	r.name = name;
+	r.kind = importedTexture;
+	r.desc = desc;
+	r.object = texture;
+	resources.push_back(r);
+	dirty = true;
+	return (int)resources.size() - 1;
+}
+
+int renderGraph::importFramebuffer(const std::string& name, GLuint framebuffer)
+{
+	resource r;
+	r.name = name;
+	r.kind = importedFramebuffer;
+	r.object = framebuffer;
+	resources.push_back(r);
+	dirty = true;
+	return (int)resources.size() - 1;
+}
+
+int renderGraph::addPass(const std::string& name, renderPassFunction execute)
+{
+	pass p;
+	p.name = name;
+	p.execute = execute;
+	passes.push_back(p);
+	dirty = true;
+	return (int)passes.size() - 1;
+}
+
+void renderGraph::read(int passIndex, int resourceIndex)
+{
+	passes[passIndex].reads.push_back(resourceIndex);
+	resources[resourceIndex].readers.push_back(passIndex);
+	dirty = true;
+}
+
+void renderGraph::write(int passIndex, int resourceIndex)
+{
+	passes[passIndex].writes.push_back(resourceIndex);
+	resources[resourceIndex].writers.push_back(passIndex);
+	dirty = true;
+}
+
+void renderGraph::keep(int passIndex)
+{
+	passes[passIndex].kept = true;
+	dirty = true;
+}
+
+void renderGraph::resize(int newWidth, int newHeight)
+{
+	newWidth = std::max(newWidth, 1);
+	newHeight = std::max(newHeight, 1);
+	if (newWidth == width && newHeight == height)
+		return;
+
+	width = newWidth;
+	height = newHeight;
+	dirty = true;
+}
+
+// Walks back from the passes with visible results through everything they read
+void renderGraph::cull(std::vector<char>& needed) const
+{
+	needed.assign(passes.size(), 0);
+	std::vector<int> stack;
+
+	for (size_t i = 0; i < passes.size(); i++)
+	{
+		bool root = passes[i].kept;
+		for (int r : passes[i].writes)
+			root = root || resources[r].kind != transientTexture;
+
+		if (root)
+		{
+			needed[i] = 1;
+			stack.push_back((int)i);
+		}
+	}
+
+	while (!stack.empty())
+	{
+		int p = stack.back();
+		stack.pop_back();
+
+		for (int r : passes[p].reads)
+		{
+			for (int writer : resources[r].writers)
+			{
+				if (!needed[writer])
+				{
+					needed[writer] = 1;
+					stack.push_back(writer);
+				}
+			}
+		}
+	}
+}
+
+// Topological order, the earliest added pass goes first whenever there is a choice
+void renderGraph::sort(const std::vector<char>& needed)
+{
+	std::vector<std::vector<int>> after(passes.size());
+	std::vector<int> incoming(passes.size(), 0);
+
+	auto edge = [&](int from, int to)
+	{
+		if (from == to)
+			return;
+		after[from].push_back(to);
+		incoming[to]++;
+	};
+
+	for (const resource& r : resources)
+	{
+		int previous = -1;
+		for (int writer : r.writers)
+		{
+			if (!needed[writer])
+				continue;
+			if (previous >= 0)
+				edge(previous, writer);
+			previous = writer;
+
+			for (int reader : r.readers)
+			{
+				// A pass both reading and writing is ordered with the writers
+				if (needed[reader] && std::find(r.writers.begin(), r.writers.end(), reader) == r.writers.end())
+					edge(writer, reader);
+			}
+		}
+
+		if (r.kind == transientTexture && previous < 0)
+		{
+			for (int reader : r.readers)
+			{
+				if (needed[reader])
+				{
+					std::cout << "ERROR::RENDER_GRAPH::READ_BEFORE_WRITE " << r.name << " in " << passes[reader].name << std::endl;
+					break;
+				}
+			}
+		}
+	}
+
+	passOrder.clear();
+	std::vector<char> done(passes.size(), 0);
+	for (;;)
+	{
+		int next = -1;
+		for (size_t i = 0; i < passes.size() && next < 0; i++)
+		{
+			if (needed[i] && !done[i] && incoming[i] == 0)
+				next = (int)i;
+		}
+		if (next < 0)
+			break;
+
+		done[next] = 1;
+		passOrder.push_back(next);
+		for (int to : after[next])
+			incoming[to]--;
+	}
+
+	// Whatever is left sits on a cycle, it runs in the order it was added
+	for (size_t i = 0; i < passes.size(); i++)
+	{
+		if (needed[i] && !done[i])
+		{
+			std::cout << "ERROR::RENDER_GRAPH::CYCLE " << passes[i].name << std::endl;
+			passOrder.push_back((int)i);
+		}
+	}
+}
+
+void renderGraph::alias()
+{
+	struct lifetime
+	{
+		int resource;
+		int first;
+		int last;
+	};
+
+	std::vector<lifetime> lifetimes;
+	std::vector<int> lifetimeOf(resources.size(), -1);
+	for (size_t position = 0; position < passOrder.size(); position++)
+	{
+		const pass& p = passes[passOrder[position]];
+		auto use = [&](int r)
+		{
+			if (resources[r].kind != transientTexture)
+				return;
+			if (lifetimeOf[r] < 0)
+			{
+				lifetimeOf[r] = (int)lifetimes.size();
+				lifetimes.push_back({ r, (int)position, (int)position });
+			}
+			lifetimes[lifetimeOf[r]].last = (int)position;
+		};
+
+		for (int r : p.reads)
+			use(r);
+		for (int r : p.writes)
+			use(r);
+	}
+
+	graphStats.transientTextures = lifetimes.size();
+	graphStats.transientBytes = 0;
+	graphStats.allocatedBytes = 0;
+	graphStats.peakLiveBytes = 0;
+
+	// Greedy: lifetimes start in order, each takes the first free texture of its kind
+	struct slot
+	{
+		GLenum format;
+		int width;
+		int height;
+		int last;
+	};
+	std::vector<slot> slots;
+	std::vector<size_t> liveBytes(passOrder.size(), 0);
+
+	for (const lifetime& l : lifetimes)
+	{
+		resource& r = resources[l.resource];
+		size_t bytes = (size_t)r.width * r.height * gpuMemoryFormatBytes(r.desc.format);
+		graphStats.transientBytes += bytes;
+		for (int position = l.first; position <= l.last; position++)
+			liveBytes[position] += bytes;
+
+		r.physical = -1;
+		for (size_t s = 0; s < slots.size() && r.physical < 0; s++)
+		{
+			if (slots[s].format == r.desc.format && slots[s].width == r.width && slots[s].height == r.height && slots[s].last < l.first)
+				r.physical = (int)s;
+		}
+
+		if (r.physical < 0)
+		{
+			r.physical = (int)slots.size();
+			slots.push_back({ r.desc.format, r.width, r.height, l.last });
+			graphStats.allocatedBytes += bytes;
+		}
+		else
+		{
+			slots[r.physical].last = l.last;
+		}
+	}
+
+	for (size_t bytes : liveBytes)
+		graphStats.peakLiveBytes = std::max(graphStats.peakLiveBytes, bytes);
+
+	// Textures of the last compile are kept where they still fit, only the rest is made again
+	std::vector<physicalTexture> previous;
+	previous.swap(physicals);
+	for (const slot& s : slots)
+	{
+		GLuint texture = 0;
+		for (physicalTexture& old : previous)
+		{
+			if (old.texture != 0 && old.format == s.format && old.width == s.width && old.height == s.height)
+			{
+				texture = old.texture;
+				old.texture = 0;
+				break;
+			}
+		}
+
+		if (texture == 0)
+		{
+			GLenum format, type;
+			transferFormat(s.format, format, type);
+			GLint filter = isDepthFormat(s.format) ? GL_NEAREST : GL_LINEAR;
+
+			glGenTextures(1, &texture);
+			glBindTexture(GL_TEXTURE_2D, texture);
+			glTexImage2D(GL_TEXTURE_2D, 0, s.format, s.width, s.height, 0, format, type, nullptr);
+			gpuMemoryAllocate(gpuMemoryRenderTarget, GL_TEXTURE, texture, (size_t)s.width * s.height * gpuMemoryFormatBytes(s.format), "renderGraph transient");
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+
+		physicals.push_back({ s.format, s.width, s.height, texture });
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	for (const physicalTexture& old : previous)
+	{
+		if (old.texture != 0)
+		{
+			gpuMemoryRelease(GL_TEXTURE, old.texture);
+			glDeleteTextures(1, &old.texture);
+		}
+	}
+
+	for (resource& r : resources)
+	{
+		if (r.kind == transientTexture)
+			r.object = r.physical >= 0 ? physicals[r.physical].texture : 0;
+	}
+
+	graphStats.physicalTextures = physicals.size();
+}
+
+void renderGraph::createFramebuffers()
+{
+	for (int index : passOrder)
+	{
+		pass& p = passes[index];
+		p.framebuffer = 0;
+		p.ownsFramebuffer = false;
+		p.width = width;
+		p.height = height;
+
+		bool screen = false;
+		for (int r : p.writes)
+		{
+			if (resources[r].kind == importedFramebuffer)
+			{
+				p.framebuffer = resources[r].object;
+				screen = true;
+			}
+		}
+		if (screen || p.writes.empty())
+			continue;
+
+		p.width = resources[p.writes[0]].width;
+		p.height = resources[p.writes[0]].height;
+
+		glGenFramebuffers(1, &p.framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, p.framebuffer);
+		p.ownsFramebuffer = true;
+
+		std::vector<GLenum> colours;
+		for (int r : p.writes)
+		{
+			GLenum format = resources[r].desc.format;
+			if (isDepthFormat(format))
+			{
+				GLenum attachment = hasStencil(format) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+				glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, resources[r].object, 0);
+			}
+			else
+			{
+				GLenum attachment = GL_COLOR_ATTACHMENT0 + (GLenum)colours.size();
+				glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, resources[r].object, 0);
+				colours.push_back(attachment);
+			}
+		}
+
+		if (colours.empty())
+			glDrawBuffer(GL_NONE);
+		else
+			glDrawBuffers((GLsizei)colours.size(), colours.data());
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			std::cout << "ERROR::RENDER_GRAPH::FRAMEBUFFER_INCOMPLETE " << p.name << std::endl;
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void renderGraph::deleteFramebuffers()
+{
+	for (pass& p : passes)
+	{
+		if (p.ownsFramebuffer)
+			glDeleteFramebuffers(1, &p.framebuffer);
+		p.framebuffer = 0;
+		p.ownsFramebuffer = false;
+	}
+}
+
+void renderGraph::compile()
+{
+	PROFILE_SCOPE("renderGraph::compile");
+
+	deleteFramebuffers();
+
+	for (resource& r : resources)
+	{
+		if (r.kind == importedFramebuffer)
+		{
+			r.width = width;
+			r.height = height;
+		}
+		else
+		{
+			r.width = r.desc.width > 0 ? r.desc.width : std::max((int)(width * r.desc.scale + 0.5f), 1);
+			r.height = r.desc.height > 0 ? r.desc.height : std::max((int)(height * r.desc.scale + 0.5f), 1);
+		}
+	}
+
+	std::vector<char> needed;
+	cull(needed);
+	sort(needed);
+	alias();
+	createFramebuffers();
+
+	graphStats.passes = passOrder.size();
+	graphStats.culledPasses = passes.size() - passOrder.size();
+	dirty = false;
+}
+
+void renderGraph::execute()
+{
+	PROFILE_SCOPE("renderGraph::execute");
+
+	if (dirty)
+		compile();
+
+	for (int index : passOrder)
+	{
+		const pass& p = passes[index];
+		if (!p.writes.empty())
+		{
+			glBindFramebuffer(GL_FRAMEBUFFER, p.framebuffer);
+			glViewport(0, 0, p.width, p.height);
+		}
+
+		renderPassContext context = { this, p.framebuffer, p.width, p.height };
+		p.execute(context);
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void renderGraph::clear()
+{
+	deleteFramebuffers();
+	passes.clear();
+	resources.clear();
+	passOrder.clear();
+	dirty = true;
+}
+
+GLuint renderGraph::texture(int resource) const
+{
+	return resources[resource].object;
+}
+
+const std::vector<int>& renderGraph::order() const
+{
+	return passOrder;
+}
+
+const renderGraphStats& renderGraph::stats() const
+{
+	return graphStats;
+}
+
+const std::string& renderGraph::passName(int pass) const
+{
+	return passes[pass].name;
+}
+
+void renderGraph::del()
+{
+	deleteFramebuffers();
+	for (const physicalTexture& p : physicals)
+	{
+		gpuMemoryRelease(GL_TEXTURE, p.texture);
+		glDeleteTextures(1, &p.texture);
+	}
+	physicals.clear();
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#ifndef RENDER_GRAPH_CLASS
+#define RENDER_GRAPH_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+	Frame graph: passes say which textures they read and write, the graph works out the rest.
+
+		renderGraph graph(width, height);
+		int depth = graph.createTexture("depth", { GL_DEPTH24_STENCIL8 });
+		int hdr = graph.createTexture("hdr", { GL_RGBA16F });
+		int screen = graph.importFramebuffer("screen", 0);
+
+		int scene = graph.addPass("scene", [&](const renderPassContext& pass) { ... });
+		graph.write(scene, hdr);
+		graph.write(scene, depth);
+
+		int tonemap = graph.addPass("tonemap", [&](const renderPassContext& pass)
+		{
+			glBindTexture(GL_TEXTURE_2D, pass.texture(hdr));
+			...
+		});
+		graph.read(tonemap, hdr);
+		graph.write(tonemap, screen);
+
+		graph.execute();        // every frame
+
+	On compile (the first execute after anything changed):
+
+	- Passes whose results never reach an imported resource or a keep() pass are culled.
+	  A pass only depends on what it reads, one that draws on top of what an earlier pass
+	  left in a texture reads that texture as well as writing it.
+	- Passes are ordered so every writer of a texture runs before its readers, writers of
+	  the same texture keep the order they were added in. Otherwise the order they were added
+	  in wins.
+	- Transient textures (createTexture) get a GL texture only for the span of passes that
+	  use them. Two transients with the same size and format whose spans don't overlap share
+	  one texture, so their memory is aliased. The contents of a transient are undefined
+	  when its first writer starts.
+
+	Every pass gets a framebuffer with the textures it writes attached (colour in the order
+	of the write calls, a depth format as depth), bound with the viewport set before the
+	pass runs. A pass writing an imported framebuffer is given that framebuffer.
+
+	resize() only marks the graph, the textures that depend on the size are made again on
+	the next execute, so it can be called straight from the GLFW size callback.
+*/
+
+struct renderTextureDesc
+{
+	GLenum format = GL_RGBA8;
+	// Fraction of the graph size, used when width / height are 0
+	float scale = 1.0f;
+	int width = 0;
+	int height = 0;
+};
+
+class renderGraph;
+
+struct renderPassContext
+{
+	const renderGraph* graph;
+	GLuint framebuffer;
+	int width;
+	int height;
+
+	GLuint texture(int resource) const;
+};
+
+typedef std::function<void(const renderPassContext&)> renderPassFunction;
+
+struct renderGraphStats
+{
+	size_t passes = 0;
+	size_t culledPasses = 0;
+	size_t transientTextures = 0;
+	size_t physicalTextures = 0;
+	// Every transient in its own texture
+	size_t transientBytes = 0;
+	// What the aliased textures take
+	size_t allocatedBytes = 0;
+	// Largest total of transients alive at the same time, the best aliasing could do
+	size_t peakLiveBytes = 0;
+
+	size_t savedBytes() const { return transientBytes - allocatedBytes; }
+};
+
+class renderGraph
+{
+	public:
+		renderGraph(int width, int height);
+
+		int createTexture(const std::string& name, const renderTextureDesc& desc);
+		int importTexture(const std::string& name, GLuint texture, const renderTextureDesc& desc);
+		// Written by a pass means drawn into this framebuffer, 0 is the window
+		int importFramebuffer(const std::string& name, GLuint framebuffer);
+
+		int addPass(const std::string& name, renderPassFunction execute);
+		void read(int pass, int resource);
+		void write(int pass, int resource);
+		// Work outside the graph (readbacks, captures), never culled
+		void keep(int pass);
+
+		void resize(int width, int height);
+
+		// Compiles when something changed, then runs the passes that survived
+		void execute();
+		void compile();
+
+		// Passes and resources go, the GL textures stay for the next compile to reuse
+		void clear();
+
+		GLuint texture(int resource) const;
+		const std::vector<int>& order() const;
+		const renderGraphStats& stats() const;
+		const std::string& passName(int pass) const;
+
+		void del();
+
+	private:
+		enum resourceKind
+		{
+			transientTexture,
+			importedTexture,
+			importedFramebuffer
+		};
+
+		struct resource
+		{
+			std::string name;
+			resourceKind kind;
+			renderTextureDesc desc;
+			GLuint object = 0;
+			int width = 0;
+			int height = 0;
+			// Index into physicals for transients
+			int physical = -1;
+			std::vector<int> writers;
+			std::vector<int> readers;
+		};
+
+		struct pass
+		{
+			std::string name;
+			renderPassFunction execute;
+			std::vector<int> reads;
+			std::vector<int> writes;
+			bool kept = false;
+			GLuint framebuffer = 0;
+			bool ownsFramebuffer = false;
+			int width = 0;
+			int height = 0;
+		};
+
+		struct physicalTexture
+		{
+			GLenum format;
+			int width;
+			int height;
+			GLuint texture;
+		};
+
+		int width;
+		int height;
+		bool dirty = true;
+
+		std::vector<resource> resources;
+		std::vector<pass> passes;
+		std::vector<int> passOrder;
+		std::vector<physicalTexture> physicals;
+		renderGraphStats graphStats;
+
+		void cull(std::vector<char>& needed) const;
+		void sort(const std::vector<char>& needed);
+		void alias();
+		void createFramebuffers();
+		void deleteFramebuffers();
+};
+
+#endif
@@ -1,5 +1,7 @@
 #include "shader.h"
 
+#include "glModern.h"
+
 // FILE (ifstream) -> OPEN(ACCESSED) -> STRING STREAM (rdbuf()) -> STRING (str()) -> ACTUAL SHADER CODE STRING (c_str())
 
 shader::shader(const char* vertexPath, const char* fragmentPath)
@@ -81,7 +83,83 @@ shader::shader(const char* vertexPath, const char* fragmentPath)
 	glDeleteShader(vertexShader);
 	glDeleteShader(fragmentShader);
 }
- 
+
+shader::shader(const char* computePath)
+{
+	std::string computeCode;
+	std::ifstream cShaderFile;
+
+	cShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+	try
+	{
+		cShaderFile.open(computePath);
+
+		std::stringstream cShaderStream;
+		cShaderStream << cShaderFile.rdbuf();
+		computeCode = cShaderStream.str();
+	}
+
+	catch(std::ifstream::failure f)
+	{
+		std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ" << std::endl;
+		std::cout << f.what() << std::endl;
+	}
+
+	const char* computeShaderCode = computeCode.c_str();
+
+	int success;
+	char infoLog[512];
+
+	GLuint computeShader;
+	computeShader = glCreateShader(GL_COMPUTE_SHADER);
+	glShaderSource(computeShader, 1, &computeShaderCode, NULL);
+	glCompileShader(computeShader);
+
+	glGetShaderiv(computeShader, GL_COMPILE_STATUS, &success);
+	if (!success)
+	{
+		glGetShaderInfoLog(computeShader, 512, NULL, infoLog);
+		std::cout << "ERROR::SHADER::COMPUTE::COMPILATION_FAILED" << infoLog << std::endl;
+	}
+
+	ID = glCreateProgram();
+	glAttachShader(ID, computeShader);
+
+	glLinkProgram(ID);
+
+	glGetProgramiv(ID, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glGetProgramInfoLog(ID, 512, NULL, infoLog);
+		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+	}
+
+	glDeleteShader(computeShader);
+}
+
+shader::~shader()
+{
+	del();
+}
+
+shader::shader(shader&& other) noexcept
+{
+	ID = other.ID;
+	other.ID = 0;
+}
+
+shader& shader::operator=(shader&& other) noexcept
+{
+	if (this != &other)
+	{
+		del();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
+}
+
 void shader::use()
 {
 	glUseProgram(ID);
@@ -89,5 +167,9 @@ void shader::use()
 
 void shader::del()
 {
+	if (ID == 0)
+		return;
+
 	glDeleteProgram(ID);
+	ID = 0;
 }
\ No newline at end of file
@@ -10,19 +10,29 @@
 #include <sstream>
 #include <iostream>
 
+// Owns the program: deleted with the object, moved but never copied
 class shader
 {
 public:
 	// Program ID
-	GLuint ID;
+	GLuint ID = 0;
 
 public:
 	// Constructor reads and builds the shader
 	shader(const char* vertexPath, const char* fragmentPath);
+	// Compute program, needs GL 4.3 (glModern.compute)
+	shader(const char* computePath);
+	~shader();
+
+	shader(shader&& other) noexcept;
+	shader& operator=(shader&& other) noexcept;
+	shader(const shader&) = delete;
+	shader& operator=(const shader&) = delete;
 	
 	// Use the shader
 	void use();
 
+	// Deletes the program now instead of in the destructor
 	void del();
 	// Utility uniform functions
 	void setBool(const std::string& name, bool value) const;
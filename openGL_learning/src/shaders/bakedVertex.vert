@@ -0,0 +1,21 @@
+#version 330 core
+
+// vertexShader.vert for baked lighting: the colour was lit on the CPU (lightBaker) and
+// only passed on here.
+
+layout (location = 0) in vec3 aPos;
+layout (location = 5) in vec3 aBaked;
+
+uniform mat4 proview;
+
+out vec3 eachColor;
+out float times;
+out vec3 worldPos;
+
+void main()
+{
+	gl_Position = proview * vec4(aPos, 1.0);
+	eachColor = aBaked;
+	times = 0.0;
+	worldPos = aPos;
+}
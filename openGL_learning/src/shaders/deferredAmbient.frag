@@ -0,0 +1,31 @@
+#version 330 core
+in vec2 uv;
+
+out vec4 fragColor;
+
+uniform sampler2D albedoMap;
+uniform sampler2D normalMap;
+
+uniform vec3 ambient;
+uniform vec3 sunDirection;
+uniform vec3 sunColour;
+
+vec3 octahedralDecode(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	if (n.z < 0.0)
+		n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+	return normalize(n);
+}
+
+void main()
+{
+	vec4 albedo = texture(albedoMap, uv);
+	// Nothing was drawn here
+	if (albedo.a == 0.0)
+		discard;
+
+	vec3 n = octahedralDecode(texture(normalMap, uv).rg);
+	vec3 light = ambient + sunColour * max(dot(n, -normalize(sunDirection)), 0.0);
+	fragColor = vec4(albedo.rgb * light, 1.0);
+}
@@ -0,0 +1,23 @@
+#version 330 core
+in vec3 albedo;
+in vec3 normal;
+in vec3 worldPos;
+
+layout (location = 0) out vec4 albedoOut;
+layout (location = 1) out vec2 normalOut;
+
+// Unit vector to two numbers in [-1, 1], fits an RG16_SNORM target
+vec2 octahedralEncode(vec3 n)
+{
+	n /= abs(n.x) + abs(n.y) + abs(n.z);
+	vec2 e = n.xy;
+	if (n.z < 0.0)
+		e = (1.0 - abs(n.yx)) * vec2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);
+	return e;
+}
+
+void main()
+{
+	albedoOut = vec4(albedo, 1.0);
+	normalOut = octahedralEncode(normalize(normal));
+}
@@ -0,0 +1,22 @@
+#version 330 core
+
+// Scene geometry for both the G-buffer and the forward light loop
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec3 aNormal;
+
+out vec3 albedo;
+out vec3 normal;
+out vec3 worldPos;
+
+uniform mat4 model;
+uniform mat4 viewProjection;
+
+void main()
+{
+	vec4 world = model * vec4(aPos, 1.0);
+	worldPos = world.xyz;
+	albedo = aColor;
+	normal = mat3(model) * aNormal;
+	gl_Position = viewProjection * world;
+}
@@ -0,0 +1,40 @@
+#version 330 core
+flat in vec4 lightPositionRadius;
+flat in vec4 lightColour;
+
+out vec4 fragColor;
+
+uniform sampler2D albedoMap;
+uniform sampler2D normalMap;
+uniform sampler2D depthMap;
+
+uniform mat4 inverseViewProjection;
+uniform vec2 screenSize;
+
+vec3 octahedralDecode(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	if (n.z < 0.0)
+		n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+	return normalize(n);
+}
+
+void main()
+{
+	vec2 uv = gl_FragCoord.xy / screenSize;
+	float depth = texture(depthMap, uv).r;
+
+	// World position back from the depth buffer
+	vec4 world = inverseViewProjection * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+	vec3 position = world.xyz / world.w;
+
+	vec3 toLight = lightPositionRadius.xyz - position;
+	float distance = length(toLight);
+	float falloff = clamp(1.0 - distance / lightPositionRadius.w, 0.0, 1.0);
+	if (falloff == 0.0)
+		discard;
+
+	vec3 n = octahedralDecode(texture(normalMap, uv).rg);
+	vec3 albedo = texture(albedoMap, uv).rgb;
+	fragColor = vec4(albedo * lightColour.rgb * lightColour.a * falloff * falloff * max(dot(n, toLight / distance), 0.0), 0.0);
+}
@@ -0,0 +1,18 @@
+#version 330 core
+
+// Unit volume, scaled and moved per light instance
+layout (location = 0) in vec3 aPos;
+layout (location = 3) in vec4 positionRadius;
+layout (location = 4) in vec4 colourIntensity;
+
+flat out vec4 lightPositionRadius;
+flat out vec4 lightColour;
+
+uniform mat4 viewProjection;
+
+void main()
+{
+	lightPositionRadius = positionRadius;
+	lightColour = colourIntensity;
+	gl_Position = viewProjection * vec4(positionRadius.xyz + aPos * positionRadius.w, 1.0);
+}
@@ -0,0 +1,31 @@
+#version 330 core
+in vec3 albedo;
+in vec3 normal;
+in vec3 worldPos;
+
+out vec4 fragColor;
+
+uniform vec3 ambient;
+uniform vec3 sunDirection;
+uniform vec3 sunColour;
+
+// xyz position, w radius / rgb colour, a intensity
+uniform int lightCount;
+uniform vec4 lightPositionRadius[64];
+uniform vec4 lightColour[64];
+
+void main()
+{
+	vec3 n = normalize(normal);
+	vec3 light = ambient + sunColour * max(dot(n, -normalize(sunDirection)), 0.0);
+
+	for (int i = 0; i < lightCount; i++)
+	{
+		vec3 toLight = lightPositionRadius[i].xyz - worldPos;
+		float distance = length(toLight);
+		float falloff = clamp(1.0 - distance / lightPositionRadius[i].w, 0.0, 1.0);
+		light += lightColour[i].rgb * lightColour[i].a * falloff * falloff * max(dot(n, toLight / distance), 0.0);
+	}
+
+	fragColor = vec4(albedo * light, 1.0);
+}
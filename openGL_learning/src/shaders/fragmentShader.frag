@@ -2,12 +2,33 @@
 in vec3 eachColor;
 out vec4 fragColor;
 in float times;
+in vec3 worldPos;
+
+// Point light shadow from the shadow atlas, one matrix per cube face (+X -X +Y -Y +Z -Z)
+uniform int shadowsOn;
+uniform sampler2DShadow shadowMap;
+uniform mat4 shadowMatrices[6];
+uniform vec3 shadowLight;
+
+float shadowFactor()
+{
+	if (shadowsOn == 0)
+		return 1.0;
+
+	vec3 d = worldPos - shadowLight;
+	vec3 a = abs(d);
+	int face = (a.x >= a.y && a.x >= a.z) ? (d.x > 0.0 ? 0 : 1) : (a.y >= a.z ? (d.y > 0.0 ? 2 : 3) : (d.z > 0.0 ? 4 : 5));
+
+	vec4 p = shadowMatrices[face] * vec4(worldPos, 1.0);
+	return texture(shadowMap, p.xyz / p.w);
+}
+
 void main()
 {
 	//eachColor.x += sin(times * 0.5) * 0.5;
 	//vec3 newColor = fract(eachColor);
 	
-	fragColor = vec4(eachColor, 1.0f);
+	fragColor = vec4(eachColor * (0.5 + 0.5 * shadowFactor()), 1.0f);
 //	fragColor.r = sin(eachColor.r + times * 1.5) / 2.0;
 //	fragColor.g = cos(eachColor.g + times * 1.5) / 2.0;
 //	fragColor.b = sin(eachColor.b + times * 0.5) * 0.5;
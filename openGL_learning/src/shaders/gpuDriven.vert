@@ -0,0 +1,58 @@
+#version 430 core
+
+// vertexShader.vert for the GPU driven path: the model matrix comes from the object buffer,
+// the object index from a per instance attribute offset by the draw's baseInstance.
+// The lighting is vertexShader.vert's, so both paths draw the same image.
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec3 xNormal;
+layout (location = 3) in vec3 yNormal;
+layout (location = 4) in vec3 zNormal;
+layout (location = 5) in uint objectIndex;
+
+struct objectData
+{
+	mat4 model;
+	vec3 boundsMin;
+	uint mesh;
+	vec3 boundsMax;
+	uint pad;
+	vec4 cone;
+};
+
+layout (std430, binding = 0) readonly buffer objects { objectData object[]; };
+
+uniform mat4 proview;
+uniform vec3 direction;
+uniform float intensity;
+
+out vec3 eachColor;
+out float times;
+out vec3 worldPos;
+
+// The three face normals of a box corner, each lit when it lies on its own axis. A corner
+// without normals keeps its colour
+vec3 cornerLighting(vec3 colour)
+{
+	if (xNormal == vec3(0.0) && yNormal == vec3(0.0) && zNormal == vec3(0.0))
+		return colour;
+
+	float thetaX = dot(-xNormal, direction) / (length(-xNormal) * length(direction));
+	float thetaY = dot(-yNormal, direction) / (length(-yNormal) * length(direction));
+	float thetaZ = dot(-zNormal, direction) / (length(-zNormal) * length(direction));
+
+	float a = abs(dot(xNormal, vec3(1.0, 0.0, 0.0))) == 1.0 ? 1.0 : 0.0;
+	float b = abs(dot(yNormal, vec3(0.0, 1.0, 0.0))) == 1.0 ? 1.0 : 0.0;
+	float c = abs(dot(zNormal, vec3(0.0, 0.0, 1.0))) == 1.0 ? 1.0 : 0.0;
+
+	return colour * intensity * (thetaX * a + thetaY * b + thetaZ * c + 0.5);
+}
+
+void main()
+{
+	worldPos = (object[objectIndex].model * vec4(aPos, 1.0)).xyz;
+	gl_Position = proview * vec4(worldPos, 1.0);
+	eachColor = cornerLighting(aColor);
+	times = 0.0;
+}
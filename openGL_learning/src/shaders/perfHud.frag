@@ -0,0 +1,14 @@
+#version 330 core
+
+in vec2 atlasCoord;
+in vec4 quadColour;
+
+out vec4 fragColor;
+
+// Glyph coverage in red, the bars sample a solid cell
+uniform sampler2D atlas;
+
+void main()
+{
+	fragColor = vec4(quadColour.rgb, quadColour.a * texture(atlas, atlasCoord).r);
+}
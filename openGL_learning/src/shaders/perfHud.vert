@@ -0,0 +1,22 @@
+#version 330 core
+
+// One quad per instance, a triangle strip of 4 corners made from gl_VertexID
+layout (location = 0) in vec4 rect;        // pixels from the top left of the window
+layout (location = 1) in vec4 atlasRect;   // texels
+layout (location = 2) in vec4 colour;
+
+out vec2 atlasCoord;
+out vec4 quadColour;
+
+uniform vec2 screenSize;
+uniform sampler2D atlas;
+
+void main()
+{
+	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+	vec2 pixel = rect.xy + corner * rect.zw;
+
+	atlasCoord = (atlasRect.xy + corner * atlasRect.zw) / vec2(textureSize(atlas, 0));
+	quadColour = colour;
+	gl_Position = vec4(pixel / screenSize * vec2(2.0, -2.0) + vec2(-1.0, 1.0), 0.0, 1.0);
+}
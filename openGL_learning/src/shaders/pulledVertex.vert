@@ -0,0 +1,71 @@
+#version 330 core
+
+// vertexShader.vert with programmable vertex pulling: no vertex attributes, everything is
+// read from the shared vertex buffer with the layout of the mesh being drawn. The lighting
+// is vertexShader.vert's, so both paths draw the same image.
+
+uniform samplerBuffer vertexData;
+
+// Floats per vertex, and the offsets of position, normal, uv and colour (-1 when missing)
+uniform int stride;
+uniform ivec4 offsets;
+// 3 when every corner has the normals of its three faces one after the other
+uniform int normalCount;
+
+uniform mat4 model;
+uniform mat4 proview;
+
+uniform vec3 direction;
+uniform float intensity;
+
+out vec3 eachColor;
+out float times;
+out vec3 worldPos;
+
+vec3 fetch3(int base, int offset)
+{
+	return vec3(texelFetch(vertexData, base + offset).r, texelFetch(vertexData, base + offset + 1).r, texelFetch(vertexData, base + offset + 2).r);
+}
+
+// The face normals of a corner, each lit when it lies on its own axis. A corner without
+// normals keeps its colour
+vec3 cornerLighting(vec3 colour, vec3 xNormal, vec3 yNormal, vec3 zNormal)
+{
+	if (xNormal == vec3(0.0) && yNormal == vec3(0.0) && zNormal == vec3(0.0))
+		return colour;
+
+	float thetaX = dot(-xNormal, direction) / (length(-xNormal) * length(direction));
+	float thetaY = dot(-yNormal, direction) / (length(-yNormal) * length(direction));
+	float thetaZ = dot(-zNormal, direction) / (length(-zNormal) * length(direction));
+
+	float a = abs(dot(xNormal, vec3(1.0, 0.0, 0.0))) == 1.0 ? 1.0 : 0.0;
+	float b = abs(dot(yNormal, vec3(0.0, 1.0, 0.0))) == 1.0 ? 1.0 : 0.0;
+	float c = abs(dot(zNormal, vec3(0.0, 0.0, 1.0))) == 1.0 ? 1.0 : 0.0;
+
+	return colour * intensity * (thetaX * a + thetaY * b + thetaZ * c + 0.5);
+}
+
+void main()
+{
+	int base = gl_VertexID * stride;
+
+	vec3 position = fetch3(base, offsets.x);
+	vec3 colour = vec3(1.0);
+	if (offsets.w >= 0)
+		colour = fetch3(base, offsets.w);
+
+	if (offsets.y >= 0 && normalCount == 3)
+		colour = cornerLighting(colour, fetch3(base, offsets.y), fetch3(base, offsets.y + 3), fetch3(base, offsets.y + 6));
+	else if (offsets.y >= 0)
+	{
+		// One normal, lit like a corner's face on its own axis
+		vec3 normal = fetch3(base, offsets.y);
+		if (normal != vec3(0.0))
+			colour *= intensity * (dot(-normal, direction) / (length(normal) * length(direction)) + 0.5);
+	}
+
+	gl_Position = proview * model * vec4(position, 1.0);
+	eachColor = colour;
+	times = 0.0;
+	worldPos = (model * vec4(position, 1.0)).xyz;
+}
@@ -0,0 +1,6 @@
+#version 330 core
+
+// Depth only, the colour attachment does not exist
+void main()
+{
+}
@@ -9,6 +9,7 @@ layout (location = 3) in vec3 yNormal;
 layout (location = 4) in vec3 zNormal;
 
 out vec3 eachColor;
+out vec3 worldPos;
 
 uniform float time;
 
@@ -49,6 +50,7 @@ void main()
 	int c = 0;
 
 	gl_Position = position;
+	worldPos = aPos;
 	
 	if(xNormal == 0.0 && yNormal == 0.0 && zNormal == 0.0 )
 	{
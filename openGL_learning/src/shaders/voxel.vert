@@ -0,0 +1,32 @@
+#version 330 core
+
+// Greedy meshed voxel faces (voxelWorld.h): a corner in voxel units, the face it belongs to
+// and its block, coloured from the palette and lit like vertexShader.vert.
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in uvec2 aFaceBlock;
+
+uniform mat4 proview;
+uniform float voxelSize;
+uniform vec3 worldOrigin;
+uniform sampler2D palette;
+
+uniform vec3 direction;
+uniform float intensity;
+
+out vec3 eachColor;
+out float times;
+out vec3 worldPos;
+
+const vec3 normals[6] = vec3[6](vec3(-1.0, 0.0, 0.0), vec3(1.0, 0.0, 0.0), vec3(0.0, -1.0, 0.0), vec3(0.0, 1.0, 0.0), vec3(0.0, 0.0, -1.0), vec3(0.0, 0.0, 1.0));
+
+void main()
+{
+	worldPos = worldOrigin + aPos * voxelSize;
+	gl_Position = proview * vec4(worldPos, 1.0);
+
+	vec3 normal = normals[aFaceBlock.x];
+	vec3 colour = texelFetch(palette, ivec2(int(aFaceBlock.y), 0), 0).rgb;
+	eachColor = colour * intensity * (max(dot(normal, -normalize(direction)), 0.0) + 0.5);
+	times = 0.0;
+}
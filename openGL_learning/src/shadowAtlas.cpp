@@ -0,0 +1,337 @@
+#include "shadowAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+#include <gtc/matrix_transform.hpp>
+#include <gtc/type_ptr.hpp>
+
+#include "gpuMemory.h"
+#include "profiler.h"
+
+static GLuint createDepthAtlas(int size, GLuint& framebuffer)
+{
+	GLuint texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, size, size, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+	gpuMemoryAllocate(gpuMemoryRenderTarget, GL_TEXTURE, texture, (size_t)size * size * 4, "shadowAtlas");
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	// sampler2DShadow, filtered comparisons
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texture, 0);
+	glDrawBuffer(GL_NONE);
+	glReadBuffer(GL_NONE);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		std::cout << "ERROR::SHADOW_ATLAS::FRAMEBUFFER_INCOMPLETE" << std::endl;
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	return texture;
+}
+
+// x and y of a Morton (z-order) index, every other bit
+static int compact(unsigned v)
+{
+	v &= 0x55555555u;
+	v = (v | (v >> 1)) & 0x33333333u;
+	v = (v | (v >> 2)) & 0x0F0F0F0Fu;
+	v = (v | (v >> 4)) & 0x00FF00FFu;
+	v = (v | (v >> 8)) & 0x0000FFFFu;
+	return (int)v;
+}
+
+shadowAtlas::shadowAtlas(const char* depthVertexPath, const char* depthFragmentPath, int size, int minTile)
+	: atlasSize(size), minTile(minTile), depth(depthVertexPath, depthFragmentPath)
+{
+	lightViewProjectionLocation = glGetUniformLocation(depth.ID, "lightViewProjection");
+
+	staticTexture = createDepthAtlas(atlasSize, staticFramebuffer);
+	shadowTexture = createDepthAtlas(atlasSize, shadowFramebuffer);
+}
+
+int shadowAtlas::addLight(shadowType type, int resolution)
+{
+	shadowLight l;
+	l.type = type;
+	l.resolution = minTile;
+	while (l.resolution < resolution && l.resolution < atlasSize)
+		l.resolution *= 2;
+
+	lights.push_back(l);
+	pack();
+	updateMatrices(lights.back());
+	return (int)lights.size() - 1;
+}
+
+void shadowAtlas::pack()
+{
+	std::vector<int> order(lights.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return lights[a].resolution > lights[b].resolution; });
+
+	// In units of minTile x minTile cells, largest tiles first keeps every tile aligned
+	unsigned cursor = 0;
+	unsigned cells = (unsigned)(atlasSize / minTile) * (unsigned)(atlasSize / minTile);
+
+	for (int index : order)
+	{
+		shadowLight& l = lights[index];
+		unsigned tileCells = (unsigned)(l.resolution / minTile) * (unsigned)(l.resolution / minTile);
+
+		for (int face = 0; face < faceCount(index); face++)
+		{
+			if (cursor + tileCells > cells)
+			{
+				std::cout << "ERROR::SHADOW_ATLAS::ATLAS_FULL" << std::endl;
+				l.tiles[face] = { 0, 0, 0 };
+				continue;
+			}
+
+			l.tiles[face] = { compact(cursor) * minTile, compact(cursor >> 1) * minTile, l.resolution };
+			cursor += tileCells;
+		}
+
+		l.staticDirty = true;
+		l.hasDynamic = false;
+	}
+}
+
+void shadowAtlas::setDirectional(int light, const glm::vec3& direction, const glm::vec3& sceneCentre, float sceneRadius)
+{
+	shadowLight& l = lights[light];
+	if (l.direction == direction && l.position == sceneCentre && l.range == sceneRadius)
+		return;
+
+	l.direction = direction;
+	l.position = sceneCentre;
+	l.range = sceneRadius;
+	l.staticDirty = true;
+	updateMatrices(l);
+}
+
+void shadowAtlas::setSpot(int light, const glm::vec3& position, const glm::vec3& direction, float outerDegrees, float range)
+{
+	shadowLight& l = lights[light];
+	if (l.position == position && l.direction == direction && l.angle == outerDegrees && l.range == range)
+		return;
+
+	l.position = position;
+	l.direction = direction;
+	l.angle = outerDegrees;
+	l.range = range;
+	l.staticDirty = true;
+	updateMatrices(l);
+}
+
+void shadowAtlas::setPoint(int light, const glm::vec3& position, float range)
+{
+	shadowLight& l = lights[light];
+	if (l.position == position && l.range == range)
+		return;
+
+	l.position = position;
+	l.range = range;
+	l.staticDirty = true;
+	updateMatrices(l);
+}
+
+void shadowAtlas::updateMatrices(shadowLight& l)
+{
+	float nearPlane = l.range * 0.01f;
+
+	if (l.type == pointShadow)
+	{
+		static const glm::vec3 directions[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+		static const glm::vec3 ups[6] = { { 0, -1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 }, { 0, -1, 0 }, { 0, -1, 0 } };
+
+		glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, nearPlane, l.range);
+		for (int face = 0; face < 6; face++)
+			l.viewProjection[face] = projection * glm::lookAt(l.position, l.position + directions[face], ups[face]);
+		return;
+	}
+
+	glm::vec3 direction = glm::normalize(l.direction);
+	glm::vec3 up = std::fabs(direction.y) > 0.99f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+
+	if (l.type == spotShadow)
+	{
+		glm::mat4 projection = glm::perspective(glm::radians(std::min(l.angle * 2.0f, 170.0f)), 1.0f, nearPlane, l.range);
+		l.viewProjection[0] = projection * glm::lookAt(l.position, l.position + direction, up);
+	}
+	else
+	{
+		// Covers the scene sphere, from just outside it
+		glm::mat4 projection = glm::ortho(-l.range, l.range, -l.range, l.range, 0.0f, 2.0f * l.range);
+		l.viewProjection[0] = projection * glm::lookAt(l.position - direction * l.range, l.position, up);
+	}
+}
+
+bool shadowAtlas::inRange(const shadowLight& l, const glm::vec3& boxMin, const glm::vec3& boxMax) const
+{
+	if (l.type == directionalShadow)
+		return true;
+
+	// Sphere around the light against the box, spot lights included
+	glm::vec3 nearest = glm::clamp(l.position, boxMin, boxMax);
+	return glm::dot(nearest - l.position, nearest - l.position) <= l.range * l.range;
+}
+
+void shadowAtlas::staticGeometryChanged()
+{
+	for (shadowLight& l : lights)
+		l.staticDirty = true;
+}
+
+void shadowAtlas::staticGeometryChanged(const glm::vec3& boxMin, const glm::vec3& boxMax)
+{
+	for (shadowLight& l : lights)
+	{
+		if (inRange(l, boxMin, boxMax))
+			l.staticDirty = true;
+	}
+}
+
+void shadowAtlas::addDynamicCaster(const glm::vec3& boxMin, const glm::vec3& boxMax)
+{
+	dynamicMins.push_back(boxMin);
+	dynamicMaxs.push_back(boxMax);
+}
+
+void shadowAtlas::renderTile(GLuint framebuffer, const tile& t, const glm::mat4& viewProjection, bool clear, bool dynamicCasters, const shadowCasterFunction& drawCasters)
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glViewport(t.x, t.y, t.size, t.size);
+
+	if (clear)
+		glClear(GL_DEPTH_BUFFER_BIT);
+
+	glUniformMatrix4fv(lightViewProjectionLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
+	drawCasters(viewProjection, dynamicCasters);
+}
+
+void shadowAtlas::update(const shadowCasterFunction& drawCasters)
+{
+	PROFILE_SCOPE("shadowAtlas::update");
+
+	lastStaticRenders = 0;
+	lastDynamicRenders = 0;
+
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	depth.use();
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_SCISSOR_TEST);
+	glEnable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(2.0f, 4.0f);
+
+	for (int index = 0; index < (int)lights.size(); index++)
+	{
+		shadowLight& l = lights[index];
+		int faces = faceCount(index);
+
+		bool dynamicInRange = false;
+		for (size_t i = 0; i < dynamicMins.size() && !dynamicInRange; i++)
+			dynamicInRange = inRange(l, dynamicMins[i], dynamicMaxs[i]);
+
+		// Nothing moved for this light: last frame's tiles are still right
+		if (!l.staticDirty && !dynamicInRange && !l.hasDynamic)
+			continue;
+
+		for (int face = 0; face < faces; face++)
+		{
+			const tile& t = l.tiles[face];
+			if (t.size == 0)
+				continue;
+
+			// Clears and blits are clipped by the scissor as well
+			glScissor(t.x, t.y, t.size, t.size);
+
+			if (l.staticDirty)
+			{
+				renderTile(staticFramebuffer, t, l.viewProjection[face], true, false, drawCasters);
+				lastStaticRenders++;
+			}
+
+			// Static depth as the starting point, dynamic casters on top
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, staticFramebuffer);
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, shadowFramebuffer);
+			glBlitFramebuffer(t.x, t.y, t.x + t.size, t.y + t.size, t.x, t.y, t.x + t.size, t.y + t.size, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+
+			if (dynamicInRange)
+			{
+				renderTile(shadowFramebuffer, t, l.viewProjection[face], false, true, drawCasters);
+				lastDynamicRenders++;
+			}
+		}
+
+		l.staticDirty = false;
+		l.hasDynamic = dynamicInRange;
+	}
+
+	glDisable(GL_POLYGON_OFFSET_FILL);
+	glDisable(GL_SCISSOR_TEST);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	dynamicMins.clear();
+	dynamicMaxs.clear();
+}
+
+GLuint shadowAtlas::texture() const
+{
+	return shadowTexture;
+}
+
+shader& shadowAtlas::depthShader()
+{
+	return depth;
+}
+
+int shadowAtlas::faceCount(int light) const
+{
+	return lights[light].type == pointShadow ? 6 : 1;
+}
+
+glm::mat4 shadowAtlas::lightViewProjection(int light, int face) const
+{
+	return lights[light].viewProjection[face];
+}
+
+glm::mat4 shadowAtlas::atlasMatrix(int light, int face) const
+{
+	const tile& t = lights[light].tiles[face];
+	float scale = (float)t.size / atlasSize;
+
+	// Clip space -> [0, 1] inside the tile -> place of the tile in the atlas
+	glm::mat4 bias(1.0f);
+	bias[0][0] = 0.5f * scale;
+	bias[1][1] = 0.5f * scale;
+	bias[2][2] = 0.5f;
+	bias[3] = glm::vec4((float)t.x / atlasSize + 0.5f * scale, (float)t.y / atlasSize + 0.5f * scale, 0.5f, 1.0f);
+
+	return bias * lights[light].viewProjection[face];
+}
+
+void shadowAtlas::del()
+{
+	depth.del();
+	glDeleteFramebuffers(1, &staticFramebuffer);
+	glDeleteFramebuffers(1, &shadowFramebuffer);
+	gpuMemoryRelease(GL_TEXTURE, staticTexture);
+	gpuMemoryRelease(GL_TEXTURE, shadowTexture);
+	glDeleteTextures(1, &staticTexture);
+	glDeleteTextures(1, &shadowTexture);
+	staticTexture = 0;
+	shadowTexture = 0;
+}
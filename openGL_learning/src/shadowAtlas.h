@@ -0,0 +1,124 @@
+#pragma once
+
+#ifndef SHADOW_ATLAS_CLASS
+#define SHADOW_ATLAS_CLASS
+
+#include <glad/glad.h>
+
+#include <functional>
+#include <vector>
+
+#include <glm.hpp>
+
+#include "shader.h"
+
+/*
+	Cached shadow maps for directional, spot and point lights, all in one depth atlas.
+
+	A directional or spot light takes one square tile, a point light six (one per cube
+	face, +X -X +Y -Y +Z -Z), sized by the resolution asked for. Tiles are powers of two
+	and handed out largest first in Morton order, which packs them without gaps.
+
+	Static casters are rendered into a second atlas with the same layout, once, and only
+	again when the light changes or staticGeometryChanged touches its range. Every frame a
+	light that has a dynamic caster in range gets its static tile copied over and the
+	dynamic casters drawn on top, lights without one are not touched at all.
+
+		atlas.setPoint(lamp, lightCentre, 5.0f);        // no-op while the light stays put
+		atlas.addDynamicCaster(playerMin, playerMax);
+		atlas.update([&](const glm::mat4& lightViewProjection, bool dynamicCasters) {
+			... draw static or dynamic casters with atlas.depthShader() ...
+		});
+
+	Receivers transform their world position with atlasMatrix(light, face) and sample
+	texture() as a sampler2DShadow: xy is the place in the atlas, z the depth to compare.
+*/
+
+enum shadowType
+{
+	directionalShadow,
+	spotShadow,
+	pointShadow
+};
+
+// Draws the casters with the given light matrix, static ones or dynamic ones
+typedef std::function<void(const glm::mat4& lightViewProjection, bool dynamicCasters)> shadowCasterFunction;
+
+class shadowAtlas
+{
+	public:
+		// Faces rendered / copied by the last update
+		size_t lastStaticRenders = 0;
+		size_t lastDynamicRenders = 0;
+
+		shadowAtlas(const char* depthVertexPath, const char* depthFragmentPath, int size = 4096, int minTile = 128);
+
+		// resolution is rounded up to a power of two, all tiles are repacked
+		int addLight(shadowType type, int resolution);
+
+		// The static cache of a light is only dropped when these actually change it
+		void setDirectional(int light, const glm::vec3& direction, const glm::vec3& sceneCentre, float sceneRadius);
+		void setSpot(int light, const glm::vec3& position, const glm::vec3& direction, float outerDegrees, float range);
+		void setPoint(int light, const glm::vec3& position, float range);
+
+		void staticGeometryChanged();
+		void staticGeometryChanged(const glm::vec3& boxMin, const glm::vec3& boxMax);
+
+		// Dynamic casters of this frame, cleared by update
+		void addDynamicCaster(const glm::vec3& boxMin, const glm::vec3& boxMax);
+
+		void update(const shadowCasterFunction& drawCasters);
+
+		GLuint texture() const;
+		shader& depthShader();
+
+		int faceCount(int light) const;
+		glm::mat4 lightViewProjection(int light, int face) const;
+		glm::mat4 atlasMatrix(int light, int face) const;
+
+		void del();
+
+	private:
+		struct tile
+		{
+			int x, y, size;
+		};
+
+		struct shadowLight
+		{
+			shadowType type;
+			int resolution;
+			glm::vec3 position = glm::vec3(0.0f);
+			glm::vec3 direction = glm::vec3(0.0f, -1.0f, 0.0f);
+			float angle = 45.0f;
+			float range = 1.0f;
+
+			tile tiles[6];
+			glm::mat4 viewProjection[6];
+
+			bool staticDirty = true;
+			// The shadow tile holds dynamic casters from an earlier frame
+			bool hasDynamic = false;
+		};
+
+		int atlasSize;
+		int minTile;
+		std::vector<shadowLight> lights;
+		std::vector<glm::vec3> dynamicMins;
+		std::vector<glm::vec3> dynamicMaxs;
+
+		shader depth;
+		GLint lightViewProjectionLocation = -1;
+
+		GLuint staticTexture = 0;
+		GLuint shadowTexture = 0;
+		GLuint staticFramebuffer = 0;
+		GLuint shadowFramebuffer = 0;
+
+		void pack();
+		void updateMatrices(shadowLight& l);
+		bool inRange(const shadowLight& l, const glm::vec3& boxMin, const glm::vec3& boxMax) const;
+		void renderTile(GLuint framebuffer, const tile& t, const glm::mat4& viewProjection, bool clear, bool dynamicCasters, const shadowCasterFunction& drawCasters);
+};
+
+#endif
@@ -0,0 +1,349 @@
+#include "transformHierarchy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <type_traits>
+
+#include "profiler.h"
+
+// Nodes per job, a level smaller than this is done on the calling thread
+static const size_t hierarchyGrain = 2048;
+
+void transformHierarchy::add(entity e, entity parent, const glm::vec3& p, const glm::vec3& r, const glm::vec3& s)
+{
+	if (has(e))
+	{
+		std::cout << "ERROR::TRANSFORM_HIERARCHY::ALREADY_ADDED " << e.index << std::endl;
+		return;
+	}
+
+	uint32_t parentOf = slot(parent);
+	uint32_t added = (uint32_t)owner.size();
+
+	owner.push_back(e);
+	parentSlot.push_back(parentOf);
+	localPosition.push_back(p);
+	localRotation.push_back(r);
+	localScale.push_back(s);
+	worldMatrix.push_back(glm::mat4(1.0f));
+	dirty.push_back(1);
+	recomputedIn.push_back(0);
+
+	if (e.index >= sparse.size())
+		sparse.resize(std::max((size_t)e.index + 1, sparse.size() * 2), npos);
+	sparse[e.index] = added;
+
+	if (reorder)
+		return;
+
+	// Still breadth first if it lands on the last level or starts a new one below it
+	if (levelStart.empty())
+		levelStart.push_back(0);
+	size_t depth = parentOf == npos ? 0 : level(parentOf) + 1;
+	if (depth == levels())
+	{
+		levelStart.push_back(added + 1);
+		levelDirty.push_back(1);
+	}
+	else if (depth + 1 == levels())
+	{
+		levelStart.back() = added + 1;
+		levelDirty.back()++;
+	}
+	else
+		reorder = true;
+}
+
+void transformHierarchy::remove(entity e)
+{
+	uint32_t s = slot(e);
+	if (s == npos)
+		return;
+
+	// A removed node keeps its slot with a null owner until rebuild()
+	auto drop = [&](uint32_t dropped)
+	{
+		sparse[owner[dropped].index] = npos;
+		owner[dropped] = entity();
+		removed++;
+	};
+	auto isDropped = [&](uint32_t node) { return owner[node].index == npos; };
+
+	drop(s);
+
+	// Breadth first, every node below s comes after it. Out of order, go over it until nothing is left
+	bool more = true;
+	while (more)
+	{
+		more = false;
+		for (uint32_t i = reorder ? 0 : s + 1; i < owner.size(); i++)
+		{
+			if (!isDropped(i) && parentSlot[i] != npos && isDropped(parentSlot[i]))
+			{
+				drop(i);
+				more = reorder;
+			}
+		}
+	}
+
+	reorder = true;
+}
+
+bool transformHierarchy::setParent(entity e, entity parent)
+{
+	uint32_t s = slot(e);
+	if (s == npos)
+		return false;
+
+	uint32_t parentOf = slot(parent);
+	for (uint32_t above = parentOf; above != npos; above = parentSlot[above])
+	{
+		if (above == s)
+		{
+			std::cout << "ERROR::TRANSFORM_HIERARCHY::PARENT_IS_DESCENDANT " << e.index << std::endl;
+			return false;
+		}
+	}
+
+	if (parentSlot[s] == parentOf)
+		return true;
+
+	parentSlot[s] = parentOf;
+	reorder = true;
+	markDirty(s);
+	return true;
+}
+
+bool transformHierarchy::has(entity e) const
+{
+	return slot(e) != npos;
+}
+
+uint32_t transformHierarchy::slot(entity e) const
+{
+	if (e.index >= sparse.size())
+		return npos;
+
+	uint32_t s = sparse[e.index];
+	return s != npos && owner[s].generation == e.generation ? s : npos;
+}
+
+entity transformHierarchy::parent(entity e) const
+{
+	uint32_t s = slot(e);
+	return s != npos && parentSlot[s] != npos ? owner[parentSlot[s]] : entity();
+}
+
+void transformHierarchy::setPosition(entity e, const glm::vec3& p)
+{
+	uint32_t s = slot(e);
+	localPosition[s] = p;
+	markDirty(s);
+}
+
+void transformHierarchy::setRotation(entity e, const glm::vec3& r)
+{
+	uint32_t s = slot(e);
+	localRotation[s] = r;
+	markDirty(s);
+}
+
+void transformHierarchy::setScale(entity e, const glm::vec3& scale)
+{
+	uint32_t s = slot(e);
+	localScale[s] = scale;
+	markDirty(s);
+}
+
+const glm::vec3& transformHierarchy::position(entity e) const
+{
+	return localPosition[slot(e)];
+}
+
+const glm::vec3& transformHierarchy::rotation(entity e) const
+{
+	return localRotation[slot(e)];
+}
+
+const glm::vec3& transformHierarchy::scale(entity e) const
+{
+	return localScale[slot(e)];
+}
+
+const glm::mat4& transformHierarchy::world(entity e) const
+{
+	return worldMatrix[slot(e)];
+}
+
+void transformHierarchy::update(jobSystem& jobs)
+{
+	PROFILE_SCOPE("transformHierarchy::update");
+
+	changedSlots.clear();
+	if (reorder)
+		rebuild();
+
+	const uint32_t current = ++updates;
+	std::vector<size_t> updatedLevels;
+	bool aboveChanged = false;
+
+	for (size_t l = 0; l < levels(); l++)
+	{
+		// Nothing set here and nothing moved above, every world matrix of the level stands
+		if (levelDirty[l] == 0 && !aboveChanged)
+			continue;
+
+		uint32_t begin = levelStart[l];
+		std::atomic<bool> levelChanged{ false };
+		jobs.parallelFor(levelStart[l + 1] - begin, [&](size_t first, size_t last)
+		{
+			bool any = false;
+			for (size_t i = begin + first; i < begin + last; i++)
+			{
+				uint32_t p = parentSlot[i];
+				bool parentChanged = p != npos && recomputedIn[p] == current;
+				if (!dirty[i] && !parentChanged)
+					continue;
+
+				glm::mat4 local = transformMatrix(localPosition[i], localRotation[i], localScale[i]);
+				worldMatrix[i] = p == npos ? local : worldMatrix[p] * local;
+				recomputedIn[i] = current;
+				dirty[i] = 0;
+				any = true;
+			}
+			if (any)
+				levelChanged.store(true, std::memory_order_relaxed);
+		}, hierarchyGrain);
+
+		levelDirty[l] = 0;
+		aboveChanged = levelChanged.load();
+		if (aboveChanged)
+			updatedLevels.push_back(l);
+	}
+
+	for (size_t l : updatedLevels)
+	{
+		for (uint32_t i = levelStart[l]; i < levelStart[l + 1]; i++)
+		{
+			if (recomputedIn[i] == current)
+				changedSlots.push_back(i);
+		}
+	}
+}
+
+const std::vector<uint32_t>& transformHierarchy::changed() const
+{
+	return changedSlots;
+}
+
+const std::vector<entity>& transformHierarchy::owners() const
+{
+	return owner;
+}
+
+const std::vector<glm::mat4>& transformHierarchy::worlds() const
+{
+	return worldMatrix;
+}
+
+size_t transformHierarchy::size() const
+{
+	return owner.size() - removed;
+}
+
+size_t transformHierarchy::levels() const
+{
+	return levelStart.empty() ? 0 : levelStart.size() - 1;
+}
+
+uint32_t transformHierarchy::level(uint32_t s) const
+{
+	return (uint32_t)(std::upper_bound(levelStart.begin(), levelStart.end(), s) - levelStart.begin()) - 1;
+}
+
+void transformHierarchy::markDirty(uint32_t s)
+{
+	if (dirty[s])
+		return;
+
+	dirty[s] = 1;
+	if (!reorder)
+		levelDirty[level(s)]++;
+}
+
+// Breadth first order again: the roots in slot order, then their children, and so on
+void transformHierarchy::rebuild()
+{
+	PROFILE_SCOPE("transformHierarchy::rebuild");
+
+	const size_t count = owner.size();
+
+	// Children of every slot, grouped by parent in slot order
+	std::vector<uint32_t> childStart(count + 1, 0);
+	std::vector<uint32_t> children(count);
+	std::vector<uint32_t> order;
+	order.reserve(count - removed);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (owner[i].index == npos)
+			continue;
+		if (parentSlot[i] == npos)
+			order.push_back(i);
+		else
+			childStart[parentSlot[i] + 1]++;
+	}
+	for (size_t i = 0; i < count; i++)
+		childStart[i + 1] += childStart[i];
+	{
+		std::vector<uint32_t> fill(childStart.begin(), childStart.end() - 1);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (owner[i].index != npos && parentSlot[i] != npos)
+				children[fill[parentSlot[i]]++] = i;
+		}
+	}
+
+	levelStart.assign(1, 0);
+	for (size_t levelBegin = 0; levelBegin < order.size();)
+	{
+		size_t levelEnd = order.size();
+		levelStart.push_back((uint32_t)levelEnd);
+		for (size_t i = levelBegin; i < levelEnd; i++)
+			order.insert(order.end(), children.begin() + childStart[order[i]], children.begin() + childStart[order[i] + 1]);
+		levelBegin = levelEnd;
+	}
+
+	std::vector<uint32_t> newSlot(count, npos);
+	for (uint32_t i = 0; i < order.size(); i++)
+		newSlot[order[i]] = i;
+
+	auto permute = [&](auto& field)
+	{
+		typename std::remove_reference<decltype(field)>::type moved(order.size());
+		for (size_t i = 0; i < order.size(); i++)
+			moved[i] = field[order[i]];
+		field.swap(moved);
+	};
+	permute(owner);
+	permute(parentSlot);
+	permute(localPosition);
+	permute(localRotation);
+	permute(localScale);
+	permute(worldMatrix);
+	permute(dirty);
+	recomputedIn.assign(order.size(), 0);
+
+	levelDirty.assign(levels(), 0);
+	for (uint32_t i = 0; i < order.size(); i++)
+	{
+		if (parentSlot[i] != npos)
+			parentSlot[i] = newSlot[parentSlot[i]];
+		sparse[owner[i].index] = i;
+		if (dirty[i])
+			levelDirty[level(i)]++;
+	}
+
+	removed = 0;
+	reorder = false;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef TRANSFORM_HIERARCHY_CLASS
+#define TRANSFORM_HIERARCHY_CLASS
+
+#include <glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "entityStore.h"
+#include "jobSystem.h"
+
+/*
+	Parent / child transforms of entities. A node's local position, rotation and scale are
+	relative to its parent, its world matrix is the parent's world times its own matrix
+	(transformMatrix in entityStore.h).
+
+		transformHierarchy hierarchy;
+		hierarchy.add(car, entity(), glm::vec3(0.0f, 0.0f, 5.0f));
+		hierarchy.add(wheel, car, glm::vec3(1.0f, -0.5f, 1.0f));
+
+		hierarchy.setPosition(car, ...);          // the car and its wheels are dirty
+		hierarchy.update(jobs);
+		for (uint32_t slot : hierarchy.changed())
+			... upload hierarchy.worlds()[slot] for hierarchy.owners()[slot] ...
+
+	Nodes are stored breadth first: every root, then every node one level down, and so on,
+	each field in a vector of its own. A level only needs the level before it, so update()
+	goes level by level and splits each one over the jobs. A node is recomputed when it was
+	set since the last update or its parent was recomputed this update, nothing else is
+	touched, and a level with neither is skipped as a whole.
+
+	Adding below the deepest level keeps the order. Anything else that changes the shape
+	(reparenting, removing, adding a root after children) is put off and the order rebuilt
+	once, at the start of the next update. Slots only move then.
+*/
+
+class transformHierarchy
+{
+	public:
+		static constexpr uint32_t npos = 0xffffffff;
+
+		// Appends e under parent, as a root when parent is not in the hierarchy
+		void add(entity e, entity parent, const glm::vec3& position, const glm::vec3& rotation = glm::vec3(0.0f), const glm::vec3& scale = glm::vec3(1.0f));
+		// Removes e and everything below it
+		void remove(entity e);
+		// Moves e with its subtree under parent (a root for a null entity). False if parent is
+		// e or below it
+		bool setParent(entity e, entity parent);
+
+		bool has(entity e) const;
+		// Current slot of e, npos if it is not in the hierarchy
+		uint32_t slot(entity e) const;
+		entity parent(entity e) const;
+
+		void setPosition(entity e, const glm::vec3& position);
+		void setRotation(entity e, const glm::vec3& rotation);
+		void setScale(entity e, const glm::vec3& scale);
+		// e must be in the hierarchy
+		const glm::vec3& position(entity e) const;
+		const glm::vec3& rotation(entity e) const;
+		const glm::vec3& scale(entity e) const;
+		// As of the last update
+		const glm::mat4& world(entity e) const;
+
+		void update(jobSystem& jobs = jobSystem::shared());
+
+		// Slots whose world matrix the last update changed, ascending
+		const std::vector<uint32_t>& changed() const;
+
+		// By slot, a removed node stays until the next update with a null owner
+		const std::vector<entity>& owners() const;
+		const std::vector<glm::mat4>& worlds() const;
+
+		size_t size() const;
+		size_t levels() const;
+
+	private:
+		std::vector<entity> owner;
+		// Slot of the parent, npos for roots
+		std::vector<uint32_t> parentSlot;
+		std::vector<glm::vec3> localPosition;
+		std::vector<glm::vec3> localRotation;
+		std::vector<glm::vec3> localScale;
+		std::vector<glm::mat4> worldMatrix;
+		// Set since the last update, written by the setters
+		std::vector<unsigned char> dirty;
+		// Number of the last update that recomputed the node, read by the level below
+		std::vector<uint32_t> recomputedIn;
+		uint32_t updates = 0;
+
+		// First slot of every level, and one past the last
+		std::vector<uint32_t> levelStart;
+		// Dirty nodes per level
+		std::vector<uint32_t> levelDirty;
+
+		// Entity index to slot
+		std::vector<uint32_t> sparse;
+
+		std::vector<uint32_t> changedSlots;
+		size_t removed = 0;
+		bool reorder = false;
+
+		uint32_t level(uint32_t slot) const;
+		void markDirty(uint32_t slot);
+		void rebuild();
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "vertexPuller.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "EBO.h"
+
+vertexPuller::vertexPuller(GLsizeiptr vertexBytes, GLsizeiptr indexBytes)
+	: vertexData(GL_TEXTURE_BUFFER, vertexBytes), indexData(GL_ELEMENT_ARRAY_BUFFER, indexBytes)
+{
+	glGenVertexArrays(1, &vao);
+	glGenTextures(1, &texture);
+	glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+
+	attach();
+}
+
+// The VAO and the texture hold on to buffer names, both change when an arena grows
+void vertexPuller::attach()
+{
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexData.buffer());
+	glBindVertexArray(0);
+
+	glBindTexture(GL_TEXTURE_BUFFER, texture);
+	glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, vertexData.buffer());
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+	vertexGeneration = vertexData.generation();
+	indexGeneration = indexData.generation();
+
+	if (maxTexels > 0 && vertexData.capacity() / (GLsizeiptr)sizeof(float) > maxTexels)
+		std::cout << "ERROR::VERTEX_PULLER::BUFFER_LARGER_THAN_TEXTURE_BUFFER_LIMIT" << std::endl;
+}
+
+pulledMesh vertexPuller::add(const float* vertices, size_t vertexCount, const pulledFormat& format, const uint32_t* indices, size_t indexCount)
+{
+	pulledMesh mesh = {};
+	mesh.vertexOffset = -1;
+	mesh.indexOffset = -1;
+	mesh.format = format;
+	mesh.indexCount = (GLsizei)indexCount;
+
+	GLsizeiptr vertexSize = (GLsizeiptr)format.stride * sizeof(float);
+	GLsizeiptr vertexBytes = (GLsizeiptr)vertexCount * vertexSize;
+	GLintptr vertexOffset = vertexData.allocate(vertexBytes, vertexSize);
+	if (vertexOffset < 0)
+		return mesh;
+
+	uint32_t maxIndex = 0;
+	for (size_t i = 0; i < indexCount; i++)
+		maxIndex = indices[i] > maxIndex ? indices[i] : maxIndex;
+
+	std::vector<unsigned char> narrowed;
+	mesh.indexType = EBO::narrowestType(maxIndex);
+	EBO::narrow(indices, indexCount, mesh.indexType, narrowed);
+
+	GLintptr indexOffset = indexData.allocate((GLsizeiptr)narrowed.size(), EBO::typeSize(mesh.indexType));
+	if (indexOffset < 0)
+	{
+		vertexData.release(vertexOffset);
+		return mesh;
+	}
+
+	vertexData.upload(vertexOffset, vertices, vertexBytes);
+	indexData.upload(indexOffset, narrowed.data(), (GLsizeiptr)narrowed.size());
+
+	mesh.vertexOffset = vertexOffset;
+	mesh.indexOffset = indexOffset;
+	mesh.baseVertex = (GLint)(vertexOffset / vertexSize);
+	return mesh;
+}
+
+void vertexPuller::remove(const pulledMesh& mesh)
+{
+	if (!mesh.valid())
+		return;
+
+	vertexData.release(mesh.vertexOffset);
+	indexData.release(mesh.indexOffset);
+}
+
+void vertexPuller::begin(const shader& program)
+{
+	if (vertexGeneration != vertexData.generation() || indexGeneration != indexData.generation())
+		attach();
+
+	glUseProgram(program.ID);
+	strideLocation = glGetUniformLocation(program.ID, "stride");
+	offsetsLocation = glGetUniformLocation(program.ID, "offsets");
+	normalCountLocation = glGetUniformLocation(program.ID, "normalCount");
+	glUniform1i(glGetUniformLocation(program.ID, "vertexData"), textureUnit);
+	current = { -1, -1, -1, -1, -1, -1 };
+
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_BUFFER, texture);
+	glBindVertexArray(vao);
+}
+
+void vertexPuller::draw(const pulledMesh& mesh)
+{
+	if (!mesh.valid())
+		return;
+
+	const pulledFormat& f = mesh.format;
+	if (std::memcmp(&f, &current, sizeof(pulledFormat)) != 0)
+	{
+		glUniform1i(strideLocation, f.stride);
+		glUniform4i(offsetsLocation, f.position, f.normal, f.uv, f.color);
+		glUniform1i(normalCountLocation, f.normalCount);
+		current = f;
+	}
+
+	glDrawElementsBaseVertex(GL_TRIANGLES, mesh.indexCount, mesh.indexType, (void*)mesh.indexOffset, mesh.baseVertex);
+}
+
+void vertexPuller::end()
+{
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+const bufferArena& vertexPuller::vertexArena() const
+{
+	return vertexData;
+}
+
+const bufferArena& vertexPuller::indexArena() const
+{
+	return indexData;
+}
+
+void vertexPuller::del()
+{
+	glDeleteVertexArrays(1, &vao);
+	glDeleteTextures(1, &texture);
+	vertexData.del();
+	indexData.del();
+}
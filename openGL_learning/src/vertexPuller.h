@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef VERTEX_PULLER_CLASS
+#define VERTEX_PULLER_CLASS
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bufferArena.h"
+#include "shader.h"
+
+/*
+	Programmable vertex pulling: every mesh, whatever its vertex layout, is drawn with the
+	same VAO and no attribute setup.
+
+	Vertices of all meshes live in one float buffer read through a texture buffer, indices
+	in one shared element buffer attached to the single VAO. The vertex shader
+	(shaders/pulledVertex.vert) reads its attributes with texelFetch at
+	gl_VertexID * stride + offset, the layout of the mesh being drawn is two uniforms that
+	are only set when it changes.
+
+		vertexPuller puller;
+		pulledMesh cube = puller.add(vertices, vertexCount, format, indices, indexCount);
+		...
+		puller.begin(pulledShader);
+		puller.draw(cube);
+		puller.draw(sphere);
+		puller.end();
+
+	Vertex ranges are aligned to the vertex size, so baseVertex turns gl_VertexID straight
+	into the vertex's place in the buffer. Texture buffers are core in 3.3, so this runs on
+	the same contexts as the rest of the project.
+*/
+
+// Float offsets of the attributes inside a vertex, -1 when the mesh has none
+struct pulledFormat
+{
+	int stride;
+	int position;
+	int normal;
+	int uv;
+	int color;
+	// 3 for box corners carrying the normals of their three faces one after the other, lit
+	// like vertexShader.vert lights them
+	int normalCount = 1;
+};
+
+struct pulledMesh
+{
+	GLintptr vertexOffset;
+	GLintptr indexOffset;
+	GLint baseVertex;
+	GLsizei indexCount;
+	GLenum indexType;
+	pulledFormat format;
+
+	// False when an arena could not take the mesh
+	bool valid() const { return vertexOffset >= 0 && indexOffset >= 0; }
+};
+
+class vertexPuller
+{
+	public:
+		// Texture unit the vertex buffer is bound to while drawing
+		GLint textureUnit = 0;
+
+		vertexPuller(GLsizeiptr vertexBytes = 16 << 20, GLsizeiptr indexBytes = 4 << 20);
+
+		// Indices are stored as the narrowest type for the mesh, check valid() on the result
+		pulledMesh add(const float* vertices, size_t vertexCount, const pulledFormat& format, const uint32_t* indices, size_t indexCount);
+		void remove(const pulledMesh& mesh);
+
+		void begin(const shader& program);
+		void draw(const pulledMesh& mesh);
+		void end();
+
+		const bufferArena& vertexArena() const;
+		const bufferArena& indexArena() const;
+
+		void del();
+
+	private:
+		bufferArena vertexData;
+		bufferArena indexData;
+
+		GLuint vao = 0;
+		GLuint texture = 0;
+		unsigned vertexGeneration = 0;
+		unsigned indexGeneration = 0;
+		GLint maxTexels = 0;
+
+		GLint strideLocation = -1;
+		GLint offsetsLocation = -1;
+		GLint normalCountLocation = -1;
+		pulledFormat current = { -1, -1, -1, -1, -1, -1 };
+
+		void attach();
+};
+
+#endif
@@ -0,0 +1,545 @@
+#include "voxelWorld.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include <gtc/type_ptr.hpp>
+
+#include "gpuMemory.h"
+#include "profiler.h"
+
+static const int chunkVoxels = voxelChunkSize * voxelChunkSize * voxelChunkSize;
+static const int paddedVoxels = voxelPaddedSize * voxelPaddedSize * voxelPaddedSize;
+
+size_t voxelGreedyMesh(const uint8_t* padded, const glm::ivec3& origin, std::vector<voxelVertex>& out, size_t* visibleFaces)
+{
+	const int n = voxelChunkSize;
+	const int stride[3] = { 1, voxelPaddedSize, voxelPaddedSize * voxelPaddedSize };
+
+	uint8_t mask[voxelChunkSize * voxelChunkSize];
+	size_t quads = 0;
+	size_t faces = 0;
+
+	for (int d = 0; d < 3; d++)
+	{
+		// u and v span the slice, u x v points along +d
+		int u = (d + 1) % 3;
+		int v = (d + 2) % 3;
+
+		for (int side = 0; side < 2; side++)
+		{
+			int step = side ? stride[d] : -stride[d];
+			GLubyte face = (GLubyte)(d * 2 + side);
+
+			for (int s = 0; s < n; s++)
+			{
+				// Faces of this slice whose neighbour on that side is air
+				size_t count = 0;
+				int p[3];
+				p[d] = s;
+				for (int j = 0; j < n; j++)
+				{
+					p[v] = j;
+					p[u] = 0;
+					int at = voxelPaddedIndex(p[0], p[1], p[2]);
+					for (int i = 0; i < n; i++, at += stride[u])
+					{
+						uint8_t block = padded[at];
+						uint8_t visible = block != 0 && padded[at + step] == 0 ? block : 0;
+						mask[i + j * n] = visible;
+						count += visible != 0;
+					}
+				}
+				faces += count;
+				if (count == 0)
+					continue;
+
+				// Widest run along u, then as many rows along v as match it
+				for (int j = 0; j < n; j++)
+				{
+					for (int i = 0; i < n;)
+					{
+						uint8_t block = mask[i + j * n];
+						if (block == 0)
+						{
+							i++;
+							continue;
+						}
+
+						int width = 1;
+						while (i + width < n && mask[i + width + j * n] == block)
+							width++;
+
+						int height = 1;
+						for (; j + height < n; height++)
+						{
+							const uint8_t* row = mask + i + (j + height) * n;
+							bool same = true;
+							for (int k = 0; k < width && same; k++)
+								same = row[k] == block;
+							if (!same)
+								break;
+						}
+
+						for (int h = 0; h < height; h++)
+							std::memset(mask + i + (j + h) * n, 0, width);
+
+						int corners[4][2] = { { i, j }, { i + width, j }, { i + width, j + height }, { i, j + height } };
+						for (int c = 0; c < 4; c++)
+						{
+							// Counter clockwise seen from outside, so the back faces run the other way
+							const int* corner = corners[side ? c : 3 - c];
+							int q[3];
+							q[d] = s + side;
+							q[u] = corner[0];
+							q[v] = corner[1];
+							out.push_back({ (GLshort)(origin.x + q[0]), (GLshort)(origin.y + q[1]), (GLshort)(origin.z + q[2]), face, block });
+						}
+
+						quads++;
+						i += width;
+					}
+				}
+			}
+		}
+	}
+
+	if (visibleFaces)
+		*visibleFaces = faces;
+	return quads;
+}
+
+voxelWorld::voxelWorld(const glm::ivec3& chunks, jobSystem& jobs)
+	: jobs(jobs), vertices(GL_ARRAY_BUFFER, 4 << 20)
+{
+	chunkCount = glm::ivec3(std::max(chunks.x, 1), std::max(chunks.y, 1), std::max(chunks.z, 1));
+	if (chunkCount.x > 1023 || chunkCount.y > 1023 || chunkCount.z > 1023)
+	{
+		std::cout << "ERROR::VOXEL_WORLD::TOO_MANY_CHUNKS" << std::endl;
+		chunkCount = glm::ivec3(std::min(chunkCount.x, 1023), std::min(chunkCount.y, 1023), std::min(chunkCount.z, 1023));
+	}
+	this->chunks.resize((size_t)chunkCount.x * chunkCount.y * chunkCount.z);
+
+	std::memset(colours, 255, sizeof(colours));
+
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &quadIndices);
+
+	glGenTextures(1, &palette);
+	glBindTexture(GL_TEXTURE_2D, palette);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 256, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, colours);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	gpuMemoryAllocate(gpuMemoryTexture, GL_TEXTURE, palette, sizeof(colours), "voxelWorld palette");
+	paletteChanged = false;
+
+	attach();
+}
+
+voxelWorld::~voxelWorld()
+{
+	// The jobs write into this object
+	std::unique_lock<std::mutex> guard(resultLock);
+	resultReady.wait(guard, [&] { return inFlight == 0; });
+}
+
+int voxelWorld::chunkIndex(const glm::ivec3& c) const
+{
+	if (c.x < 0 || c.y < 0 || c.z < 0 || c.x >= chunkCount.x || c.y >= chunkCount.y || c.z >= chunkCount.z)
+		return -1;
+	return c.x + chunkCount.x * (c.y + chunkCount.y * c.z);
+}
+
+static glm::ivec3 chunkOf(const glm::ivec3& voxel)
+{
+	// Callers only pass voxels inside the world, which are never negative
+	return glm::ivec3(voxel.x / voxelChunkSize, voxel.y / voxelChunkSize, voxel.z / voxelChunkSize);
+}
+
+static int localIndex(const glm::ivec3& voxel)
+{
+	return voxel.x % voxelChunkSize + voxelChunkSize * (voxel.y % voxelChunkSize + voxelChunkSize * (voxel.z % voxelChunkSize));
+}
+
+uint8_t voxelWorld::get(const glm::ivec3& voxel) const
+{
+	if (voxel.x < 0 || voxel.y < 0 || voxel.z < 0)
+		return 0;
+
+	int index = chunkIndex(chunkOf(voxel));
+	if (index < 0 || chunks[index].voxels.empty())
+		return 0;
+	return chunks[index].voxels[localIndex(voxel)];
+}
+
+bool voxelWorld::write(const glm::ivec3& voxel, uint8_t block)
+{
+	if (voxel.x < 0 || voxel.y < 0 || voxel.z < 0)
+		return false;
+
+	int index = chunkIndex(chunkOf(voxel));
+	if (index < 0)
+		return false;
+
+	chunk& c = chunks[index];
+	if (c.voxels.empty())
+	{
+		// Chunks that were never written hold no memory
+		if (block == 0)
+			return false;
+		c.voxels.assign(chunkVoxels, 0);
+	}
+
+	uint8_t& stored = c.voxels[localIndex(voxel)];
+	if (stored == block)
+		return false;
+
+	if (stored == 0)
+	{
+		c.solid++;
+		solidTotal++;
+	}
+	else if (block == 0)
+	{
+		c.solid--;
+		solidTotal--;
+	}
+	stored = block;
+	return true;
+}
+
+void voxelWorld::set(const glm::ivec3& voxel, uint8_t block)
+{
+	if (!write(voxel, block))
+		return;
+
+	// A voxel on the border is also in the padding of the chunk next to it
+	glm::ivec3 c = chunkOf(voxel);
+	markDirty(c);
+	for (int axis = 0; axis < 3; axis++)
+	{
+		glm::ivec3 neighbour = c;
+		if (voxel[axis] % voxelChunkSize == 0)
+			neighbour[axis]--;
+		else if (voxel[axis] % voxelChunkSize == voxelChunkSize - 1)
+			neighbour[axis]++;
+		else
+			continue;
+		markDirty(neighbour);
+	}
+}
+
+void voxelWorld::fill(const glm::ivec3& min, const glm::ivec3& max, uint8_t block)
+{
+	glm::ivec3 last = size() - glm::ivec3(1);
+	glm::ivec3 lo(std::max(min.x, 0), std::max(min.y, 0), std::max(min.z, 0));
+	glm::ivec3 hi(std::min(max.x, last.x), std::min(max.y, last.y), std::min(max.z, last.z));
+	if (lo.x > hi.x || lo.y > hi.y || lo.z > hi.z)
+		return;
+
+	bool changed = false;
+	for (int z = lo.z; z <= hi.z; z++)
+		for (int y = lo.y; y <= hi.y; y++)
+			for (int x = lo.x; x <= hi.x; x++)
+				changed |= write(glm::ivec3(x, y, z), block);
+	if (!changed)
+		return;
+
+	// Every chunk the box touches, and those whose padding it reaches
+	glm::ivec3 first = chunkOf(lo);
+	glm::ivec3 end = chunkOf(hi + glm::ivec3(1));
+	for (int axis = 0; axis < 3; axis++)
+	{
+		if (lo[axis] % voxelChunkSize == 0)
+			first[axis]--;
+	}
+	for (int z = first.z; z <= end.z; z++)
+		for (int y = first.y; y <= end.y; y++)
+			for (int x = first.x; x <= end.x; x++)
+				markDirty(glm::ivec3(x, y, z));
+}
+
+void voxelWorld::setColour(uint8_t block, const glm::vec3& colour)
+{
+	for (int i = 0; i < 3; i++)
+		colours[block * 4 + i] = (GLubyte)(std::min(std::max(colour[i], 0.0f), 1.0f) * 255.0f + 0.5f);
+	paletteChanged = true;
+}
+
+void voxelWorld::markDirty(const glm::ivec3& chunkPosition)
+{
+	int index = chunkIndex(chunkPosition);
+	if (index < 0 || chunks[index].listed)
+		return;
+
+	chunks[index].listed = true;
+	dirtyChunks.push_back(index);
+}
+
+void voxelWorld::dispatch(int index)
+{
+	chunk& c = chunks[index];
+	c.listed = false;
+	c.meshing = true;
+
+	if (c.solid == 0)
+	{
+		ready.push_back({ index, {}, 0, 0 });
+		return;
+	}
+
+	glm::ivec3 position(index % chunkCount.x, (index / chunkCount.x) % chunkCount.y, index / (chunkCount.x * chunkCount.y));
+	glm::ivec3 origin = position * voxelChunkSize;
+
+	// The copy the job meshes: the chunk row by row, the border voxel by voxel
+	std::vector<uint8_t> padded(paddedVoxels, 0);
+	for (int z = 0; z < voxelChunkSize; z++)
+		for (int y = 0; y < voxelChunkSize; y++)
+			std::memcpy(&padded[voxelPaddedIndex(0, y, z)], &c.voxels[voxelChunkSize * (y + voxelChunkSize * z)], voxelChunkSize);
+	for (int z = -1; z <= voxelChunkSize; z++)
+	{
+		for (int y = -1; y <= voxelChunkSize; y++)
+		{
+			bool inside = z >= 0 && z < voxelChunkSize && y >= 0 && y < voxelChunkSize;
+			for (int x = -1; x <= voxelChunkSize; x += inside ? voxelChunkSize + 1 : 1)
+				padded[voxelPaddedIndex(x, y, z)] = get(origin + glm::ivec3(x, y, z));
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(resultLock);
+		inFlight++;
+	}
+
+	jobs.submit([this, index, origin, padded = std::move(padded)]()
+	{
+		PROFILE_SCOPE("voxelGreedyMesh");
+
+		meshResult result = { index, {}, 0, 0 };
+		result.quads = voxelGreedyMesh(padded.data(), origin, result.vertices, &result.faces);
+
+		std::lock_guard<std::mutex> guard(resultLock);
+		results.push_back(std::move(result));
+		inFlight--;
+		resultReady.notify_all();
+	});
+}
+
+void voxelWorld::update()
+{
+	PROFILE_SCOPE("voxelWorld::update");
+
+	{
+		std::lock_guard<std::mutex> guard(resultLock);
+		for (meshResult& result : results)
+			ready.push_back(std::move(result));
+		results.clear();
+	}
+
+	uploaded.clear();
+	size_t uploads = std::min(ready.size(), (size_t)std::max(uploadsPerUpdate, 0));
+	for (size_t i = 0; i < uploads; i++)
+		upload(ready[i]);
+	ready.erase(ready.begin(), ready.begin() + uploads);
+
+	// A chunk edited while its mesh is on the way goes out again once that mesh is in
+	std::vector<int> waiting;
+	std::vector<int> dirty;
+	dirty.swap(dirtyChunks);
+	for (int index : dirty)
+	{
+		if (chunks[index].meshing)
+			waiting.push_back(index);
+		else
+			dispatch(index);
+	}
+	dirtyChunks.insert(dirtyChunks.end(), waiting.begin(), waiting.end());
+}
+
+void voxelWorld::upload(meshResult& result)
+{
+	chunk& c = chunks[result.chunk];
+	c.meshing = false;
+	uploaded.push_back(glm::ivec3(result.chunk % chunkCount.x, (result.chunk / chunkCount.x) % chunkCount.y, result.chunk / (chunkCount.x * chunkCount.y)));
+
+	if (c.vertexOffset >= 0)
+		vertices.release(c.vertexOffset);
+	c.vertexOffset = -1;
+	quadTotal -= c.quads;
+	faceTotal -= c.faces;
+
+	if (!result.vertices.empty())
+	{
+		GLsizeiptr bytes = (GLsizeiptr)(result.vertices.size() * sizeof(voxelVertex));
+		c.vertexOffset = vertices.allocate(bytes, sizeof(voxelVertex));
+		vertices.upload(c.vertexOffset, result.vertices.data(), bytes);
+		growQuadIndices(result.quads);
+	}
+
+	c.quads = (GLsizei)result.quads;
+	c.faces = result.faces;
+	quadTotal += c.quads;
+	faceTotal += c.faces;
+}
+
+// The VAO holds on to the arena's buffer name, which changes when the arena grows
+void voxelWorld::attach()
+{
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, vertices.buffer());
+	glVertexAttribPointer(0, 3, GL_SHORT, GL_FALSE, sizeof(voxelVertex), (void*)0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribIPointer(1, 2, GL_UNSIGNED_BYTE, sizeof(voxelVertex), (void*)(3 * sizeof(GLshort)));
+	glEnableVertexAttribArray(1);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndices);
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	vertexGeneration = vertices.generation();
+}
+
+void voxelWorld::growQuadIndices(size_t quads)
+{
+	if (quads <= quadIndexCapacity)
+		return;
+
+	size_t capacity = std::max(quads, std::max(quadIndexCapacity * 2, (size_t)4096));
+	std::vector<GLuint> indices(capacity * 6);
+	for (size_t q = 0; q < capacity; q++)
+	{
+		GLuint corner = (GLuint)(q * 4);
+		GLuint* quad = &indices[q * 6];
+		quad[0] = corner;
+		quad[1] = corner + 1;
+		quad[2] = corner + 2;
+		quad[3] = corner;
+		quad[4] = corner + 2;
+		quad[5] = corner + 3;
+	}
+
+	// Through the copy target, the name the VAO holds stays the same
+	glBindBuffer(GL_COPY_WRITE_BUFFER, quadIndices);
+	glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(indices.size() * sizeof(GLuint)), indices.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	if (quadIndexCapacity > 0)
+		gpuMemoryRelease(GL_BUFFER, quadIndices);
+	gpuMemoryAllocate(gpuMemoryIndex, GL_BUFFER, quadIndices, indices.size() * sizeof(GLuint), "voxelWorld quad indices");
+	quadIndexCapacity = capacity;
+}
+
+void voxelWorld::draw(const shader& program)
+{
+	PROFILE_SCOPE("voxelWorld::draw");
+
+	if (vertexGeneration != vertices.generation())
+		attach();
+
+	if (paletteChanged)
+	{
+		glBindTexture(GL_TEXTURE_2D, palette);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 256, 1, GL_RGBA, GL_UNSIGNED_BYTE, colours);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		paletteChanged = false;
+	}
+
+	drawCounts.clear();
+	drawOffsets.clear();
+	drawBaseVertices.clear();
+	for (const chunk& c : chunks)
+	{
+		if (c.quads == 0)
+			continue;
+		drawCounts.push_back(c.quads * 6);
+		drawOffsets.push_back(nullptr);
+		drawBaseVertices.push_back((GLint)(c.vertexOffset / (GLintptr)sizeof(voxelVertex)));
+	}
+	if (drawCounts.empty())
+		return;
+
+	glUseProgram(program.ID);
+	glUniform1f(glGetUniformLocation(program.ID, "voxelSize"), voxelSize);
+	glUniform3fv(glGetUniformLocation(program.ID, "worldOrigin"), 1, glm::value_ptr(origin));
+	glUniform1i(glGetUniformLocation(program.ID, "palette"), paletteUnit);
+
+	glActiveTexture(GL_TEXTURE0 + paletteUnit);
+	glBindTexture(GL_TEXTURE_2D, palette);
+	glBindVertexArray(vao);
+	glMultiDrawElementsBaseVertex(GL_TRIANGLES, drawCounts.data(), GL_UNSIGNED_INT, drawOffsets.data(), (GLsizei)drawCounts.size(), drawBaseVertices.data());
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void voxelWorld::finish()
+{
+	while (pendingChunks() > 0)
+	{
+		update();
+
+		std::unique_lock<std::mutex> guard(resultLock);
+		resultReady.wait(guard, [&] { return !results.empty() || inFlight == 0; });
+	}
+}
+
+glm::ivec3 voxelWorld::size() const
+{
+	return chunkCount * voxelChunkSize;
+}
+
+size_t voxelWorld::solidVoxels() const
+{
+	return solidTotal;
+}
+
+size_t voxelWorld::quadCount() const
+{
+	return quadTotal;
+}
+
+size_t voxelWorld::visibleFaces() const
+{
+	return faceTotal;
+}
+
+size_t voxelWorld::pendingChunks() const
+{
+	std::lock_guard<std::mutex> guard(resultLock);
+	return dirtyChunks.size() + ready.size() + results.size() + (size_t)inFlight;
+}
+
+const std::vector<glm::ivec3>& voxelWorld::uploadedChunks() const
+{
+	return uploaded;
+}
+
+void voxelWorld::chunkBounds(const glm::ivec3& chunkPosition, glm::vec3& min, glm::vec3& max) const
+{
+	min = origin + glm::vec3(chunkPosition * voxelChunkSize) * voxelSize;
+	max = min + glm::vec3((float)voxelChunkSize * voxelSize);
+}
+
+const bufferArena& voxelWorld::vertexArena() const
+{
+	return vertices;
+}
+
+void voxelWorld::del()
+{
+	{
+		std::unique_lock<std::mutex> guard(resultLock);
+		resultReady.wait(guard, [&] { return inFlight == 0; });
+	}
+
+	vertices.del();
+	glDeleteVertexArrays(1, &vao);
+	if (quadIndexCapacity > 0)
+		gpuMemoryRelease(GL_BUFFER, quadIndices);
+	glDeleteBuffers(1, &quadIndices);
+	gpuMemoryRelease(GL_TEXTURE, palette);
+	glDeleteTextures(1, &palette);
+	vao = quadIndices = palette = 0;
+	quadIndexCapacity = 0;
+}
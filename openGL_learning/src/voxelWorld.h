@@ -0,0 +1,176 @@
+#pragma once
+
+#ifndef VOXEL_WORLD_CLASS
+#define VOXEL_WORLD_CLASS
+
+#include <glad/glad.h>
+#include <glm.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "bufferArena.h"
+#include "jobSystem.h"
+#include "shader.h"
+
+/*
+	A world of boxes as voxels: a fixed grid of 32^3 chunks of one byte blocks, 0 is air.
+
+		voxelWorld world(glm::ivec3(8, 2, 8));
+		world.setColour(1, glm::vec3(0.4f, 0.7f, 0.3f));
+		world.fill(glm::ivec3(0), glm::ivec3(255, 10, 255), 1);
+		... every frame, on the GL thread ...
+		world.update();                    // hands edited chunks to the jobs, uploads what came back
+		world.draw(voxelShader);           // shaders/voxel.vert with fragmentShader.frag
+
+	Edits only mark their chunk (and the neighbour, on a border) dirty. update() copies each
+	dirty chunk with a one voxel border from its neighbours and meshes the copy on a worker,
+	so editing goes on while the jobs run. Finished meshes are uploaded into one vertex arena
+	(bufferArena.h), uploadsPerUpdate of them a call, and the old range is released.
+
+	Meshing is greedy: per slice, the faces whose neighbour is air form a mask, and runs of
+	the same block are grown into rectangles, first along one axis and then the other. A flat
+	floor of a chunk is 1 quad instead of 1024 faces, faces between two solid voxels are
+	never made. A vertex is 8 bytes: its corner in voxel units, the face it belongs to and the
+	block, which the shader turns into a colour through a 256 texel palette.
+
+	Every chunk uses the same index pattern (0 1 2 0 2 3 per quad), so there is one shared
+	index buffer and the whole world is one glMultiDrawElementsBaseVertex.
+*/
+
+const int voxelChunkSize = 32;
+// A chunk with the neighbouring voxel on every side, what the mesher reads
+const int voxelPaddedSize = voxelChunkSize + 2;
+
+struct voxelVertex
+{
+	// Voxel units from the world origin
+	GLshort x, y, z;
+	// -X +X -Y +Y -Z +Z
+	GLubyte face;
+	GLubyte block;
+};
+
+// Index of a voxel in a padded chunk, every coordinate in [-1, voxelChunkSize]
+inline int voxelPaddedIndex(int x, int y, int z)
+{
+	return (x + 1) + (y + 1) * voxelPaddedSize + (z + 1) * voxelPaddedSize * voxelPaddedSize;
+}
+
+// Appends 4 vertices a quad for the chunk at origin (in voxels), returns the quads. visibleFaces
+// gets the faces there would be without merging
+size_t voxelGreedyMesh(const uint8_t* padded, const glm::ivec3& origin, std::vector<voxelVertex>& out, size_t* visibleFaces = nullptr);
+
+class voxelWorld
+{
+	public:
+		// Size of a voxel and where voxel 0 0 0 is, in world units
+		float voxelSize = 0.05f;
+		glm::vec3 origin = glm::vec3(0.0f);
+		// Finished meshes uploaded per update(), the rest wait for the next one
+		int uploadsPerUpdate = 16;
+		// Texture unit of the palette while drawing
+		GLint paletteUnit = 1;
+
+		// chunks along x, y and z, at most 1023 along each (positions are shorts)
+		explicit voxelWorld(const glm::ivec3& chunks, jobSystem& jobs = jobSystem::shared());
+		~voxelWorld();
+
+		voxelWorld(const voxelWorld&) = delete;
+		voxelWorld& operator=(const voxelWorld&) = delete;
+
+		// Outside the world reads as air and writes are ignored
+		uint8_t get(const glm::ivec3& voxel) const;
+		void set(const glm::ivec3& voxel, uint8_t block);
+		// Every voxel of the box from min to max, both included
+		void fill(const glm::ivec3& min, const glm::ivec3& max, uint8_t block);
+		void setColour(uint8_t block, const glm::vec3& colour);
+
+		// On the GL thread
+		void update();
+		void draw(const shader& program);
+		// Blocks until no chunk is dirty or being meshed, and everything is uploaded
+		void finish();
+
+		glm::ivec3 size() const;
+		size_t solidVoxels() const;
+		// As drawn, and what meshing face by face would have made
+		size_t quadCount() const;
+		size_t visibleFaces() const;
+		// Chunks waiting to be meshed or uploaded
+		size_t pendingChunks() const;
+		// Chunks (in chunk units) whose new mesh the last update() uploaded
+		const std::vector<glm::ivec3>& uploadedChunks() const;
+		// World box of a chunk
+		void chunkBounds(const glm::ivec3& chunkPosition, glm::vec3& min, glm::vec3& max) const;
+		const bufferArena& vertexArena() const;
+
+		void del();
+
+	private:
+		struct chunk
+		{
+			std::vector<uint8_t> voxels;
+			uint32_t solid = 0;
+			// In dirtyChunks, and handed to a job and not uploaded yet
+			bool listed = false;
+			bool meshing = false;
+
+			GLintptr vertexOffset = -1;
+			GLsizei quads = 0;
+			size_t faces = 0;
+		};
+
+		struct meshResult
+		{
+			int chunk;
+			std::vector<voxelVertex> vertices;
+			size_t quads;
+			size_t faces;
+		};
+
+		jobSystem& jobs;
+		glm::ivec3 chunkCount;
+		std::vector<chunk> chunks;
+		std::vector<int> dirtyChunks;
+		std::vector<glm::ivec3> uploaded;
+
+		// Written by the jobs
+		mutable std::mutex resultLock;
+		std::condition_variable resultReady;
+		std::vector<meshResult> results;
+		int inFlight = 0;
+		// Taken out of results but not uploaded yet
+		std::vector<meshResult> ready;
+
+		bufferArena vertices;
+		GLuint vao = 0;
+		GLuint quadIndices = 0;
+		GLuint palette = 0;
+		unsigned vertexGeneration = 0;
+		size_t quadIndexCapacity = 0;
+		bool paletteChanged = true;
+		GLubyte colours[256 * 4] = {};
+
+		size_t quadTotal = 0;
+		size_t faceTotal = 0;
+		size_t solidTotal = 0;
+
+		std::vector<GLsizei> drawCounts;
+		std::vector<const void*> drawOffsets;
+		std::vector<GLint> drawBaseVertices;
+
+		int chunkIndex(const glm::ivec3& chunkPosition) const;
+		// Stores the block without marking anything, true if it changed
+		bool write(const glm::ivec3& voxel, uint8_t block);
+		void markDirty(const glm::ivec3& chunkPosition);
+		void dispatch(int index);
+		void upload(meshResult& result);
+		void attach();
+		void growQuadIndices(size_t quads);
+};
+
+#endif
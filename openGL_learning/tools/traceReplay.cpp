@@ -0,0 +1,198 @@
+/*
+	Replays a trace written by glTraceStart (glTrace.h) and times every frame of its range.
+
+		openGL_learning_replay frames.ogltrace [--repeat n] [--size WxH] [--null]
+
+	The calls before the range run once, then the range is replayed "repeat" times. Per frame
+	it prints the CPU time spent submitting, the wall time once glFinish returns and the GPU
+	time between two timestamp queries (GL_TIME_ELAPSED would clash with the trace's own),
+	then the median of each over all repeats.
+
+	The replay draws into the default framebuffer of a hidden window of the given size (the
+	size of the window the trace came from, 800x600 unless told). With --null it runs on the
+	null backend (nullGL.h) instead, no window, no driver: the CPU cost of decoding and
+	submitting the calls alone, the same every run.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "glModern.h"
+#include "glTrace.h"
+#include "mappedFile.h"
+#include "nullGL.h"
+
+struct replayTiming
+{
+	double cpuMs;
+	double wallMs;
+	double gpuMs;
+};
+
+static double median(std::vector<double> values)
+{
+	if (values.empty())
+		return 0.0;
+
+	std::sort(values.begin(), values.end());
+	return values[values.size() / 2];
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	const char* path = nullptr;
+	int repeat = 10;
+	int width = 800, height = 600;
+	bool null = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+			repeat = std::max(1, std::atoi(argv[++i]));
+		else if (std::strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+		{
+			const char* size = argv[++i];
+			width = std::atoi(size);
+			const char* by = std::strchr(size, 'x');
+			height = by ? std::atoi(by + 1) : width;
+		}
+		else if (std::strcmp(argv[i], "--null") == 0)
+			null = true;
+		else
+			path = argv[i];
+	}
+
+	if (!path)
+	{
+		std::cout << "usage: openGL_learning_replay trace [--repeat n] [--size WxH] [--null]" << std::endl;
+		return 1;
+	}
+
+	mappedFile file(path);
+	if (!file.valid())
+	{
+		std::cout << "ERROR::REPLAY::FILE_NOT_READ " << path << std::endl;
+		return 1;
+	}
+
+	GLFWwindow* window = nullptr;
+	if (null)
+	{
+		nullGLLoad();
+		loadGLModern((GLADloadproc)nullGLGetProcAddress);
+	}
+	else
+	{
+		if (!glfwInit())
+		{
+			std::cout << "ERROR::REPLAY::GLFW_INIT" << std::endl;
+			return 1;
+		}
+
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		window = glfwCreateWindow(width, height, "replay", nullptr, nullptr);
+		if (!window)
+		{
+			std::cout << "ERROR::REPLAY::WINDOW" << std::endl;
+			glfwTerminate();
+			return 1;
+		}
+
+		glfwMakeContextCurrent(window);
+		glfwSwapInterval(0);
+		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+		{
+			std::cout << "ERROR::REPLAY::GLAD" << std::endl;
+			return 1;
+		}
+		loadGLModern((GLADloadproc)glfwGetProcAddress);
+	}
+
+	glTraceReplayer replayer;
+	if (!replayer.open(file.data(), (size_t)file.size()))
+		return 1;
+
+	std::cout << path << ": " << replayer.setupFrames() << " frames of setup, " << replayer.frames() << " to replay" << std::endl;
+
+	auto setupStart = std::chrono::steady_clock::now();
+	if (!replayer.replaySetup())
+		return 1;
+	glFinish();
+	std::cout << "setup " << replayer.callsReplayed() << " calls, " << std::fixed << std::setprecision(2) << millisecondsSince(setupStart) << " ms" << std::endl;
+
+	// Made outside the trace, so they take no name the trace expects
+	GLuint queries[2] = {};
+	glGenQueries(2, queries);
+
+	int frames = replayer.frames();
+	std::vector<std::vector<replayTiming>> timings(frames);
+	uint64_t setupCalls = replayer.callsReplayed();
+
+	for (int pass = 0; pass < repeat; pass++)
+	{
+		replayer.rewind();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			glQueryCounter(queries[0], GL_TIMESTAMP);
+			auto start = std::chrono::steady_clock::now();
+			if (!replayer.replayFrame())
+				return 1;
+			double cpuMs = millisecondsSince(start);
+			glQueryCounter(queries[1], GL_TIMESTAMP);
+			glFinish();
+			double wallMs = millisecondsSince(start);
+
+			GLuint64 gpuStart = 0, gpuEnd = 0;
+			glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &gpuStart);
+			glGetQueryObjectui64v(queries[1], GL_QUERY_RESULT, &gpuEnd);
+			timings[frame].push_back({ cpuMs, wallMs, (gpuEnd - gpuStart) / 1000000.0 });
+
+			if (window)
+				glfwSwapBuffers(window);
+		}
+	}
+
+	std::cout << "frame      cpu ms     wall ms      gpu ms   (median of " << repeat << ")" << std::endl;
+	std::vector<double> cpu, wall, gpu;
+	for (int frame = 0; frame < frames; frame++)
+	{
+		std::vector<double> frameCpu, frameWall, frameGpu;
+		for (const replayTiming& timing : timings[frame])
+		{
+			frameCpu.push_back(timing.cpuMs);
+			frameWall.push_back(timing.wallMs);
+			frameGpu.push_back(timing.gpuMs);
+		}
+		cpu.insert(cpu.end(), frameCpu.begin(), frameCpu.end());
+		wall.insert(wall.end(), frameWall.begin(), frameWall.end());
+		gpu.insert(gpu.end(), frameGpu.begin(), frameGpu.end());
+
+		std::cout << std::setw(5) << frame << std::setw(12) << median(frameCpu) << std::setw(12) << median(frameWall) << std::setw(12) << median(frameGpu) << std::endl;
+	}
+	std::cout << "  all" << std::setw(12) << median(cpu) << std::setw(12) << median(wall) << std::setw(12) << median(gpu) << std::endl;
+	std::cout << (replayer.callsReplayed() - setupCalls) / std::max(1, repeat) << " calls per pass" << std::endl;
+
+	glDeleteQueries(2, queries);
+	if (window)
+	{
+		glfwDestroyWindow(window);
+		glfwTerminate();
+	}
+	return 0;
+}